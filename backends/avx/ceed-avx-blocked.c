@@ -8,6 +8,7 @@
 #include <ceed/backend.h>
 #include <ceed/ceed.h>
 #include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "ceed-avx.h"
@@ -16,23 +17,34 @@
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Avx(const char *resource, Ceed ceed) {
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/avx") && strcmp(resource, "/cpu/self/avx/blocked")) {
+  char *resource_root;
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  if (strcmp(resource_root, "/cpu/self") && strcmp(resource_root, "/cpu/self/avx") && strcmp(resource_root, "/cpu/self/avx/blocked")) {
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND, "AVX backend cannot use resource: %s", resource);
     // LCOV_EXCL_STOP
   }
+  CeedCallBackend(CeedFree(&resource_root));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
-  Ceed ceed_ref;
-  CeedCallBackend(CeedInit("/cpu/self/opt/blocked", &ceed_ref));
+  //   Backend options, such as ":blk_size=N", are forwarded to the delegate
+  Ceed        ceed_ref;
+  const char *options = strchr(resource, ':');
+  char        delegate_resource[CEED_MAX_RESOURCE_LEN];
+  snprintf(delegate_resource, sizeof(delegate_resource), "/cpu/self/opt/blocked%s", options ? options : "");
+  CeedCallBackend(CeedInit(delegate_resource, &ceed_ref));
   CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
 
-  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP64) {
-    CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_f64_Avx));
-  } else {
-    CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_f32_Avx));
+  // Use the AVX-512 kernels when compiled in and supported by the host CPU
+  int (*tensor_create)(CeedBasis, CeedTensorContract) =
+      CEED_SCALAR_TYPE == CEED_SCALAR_FP64 ? CeedTensorContractCreate_f64_Avx : CeedTensorContractCreate_f32_Avx;
+#ifdef CEED_AVX512
+  if (__builtin_cpu_supports("avx512f")) {
+    tensor_create = CEED_SCALAR_TYPE == CEED_SCALAR_FP64 ? CeedTensorContractCreate_f64_Avx512 : CeedTensorContractCreate_f32_Avx512;
   }
+#endif
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", tensor_create));
 
   return CEED_ERROR_SUCCESS;
 }
@@ -28,11 +28,15 @@ static int CeedInit_Avx(const char *resource, Ceed ceed) {
   CeedCallBackend(CeedInit("/cpu/self/opt/serial", &ceed_ref));
   CeedCallBackend(CeedSetDelegate(ceed, ceed_ref));
 
-  if (CEED_SCALAR_TYPE == CEED_SCALAR_FP64) {
-    CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_f64_Avx));
-  } else {
-    CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", CeedTensorContractCreate_f32_Avx));
+  // Use the AVX-512 kernels when compiled in and supported by the host CPU
+  int (*tensor_create)(CeedBasis, CeedTensorContract) =
+      CEED_SCALAR_TYPE == CEED_SCALAR_FP64 ? CeedTensorContractCreate_f64_Avx : CeedTensorContractCreate_f32_Avx;
+#ifdef CEED_AVX512
+  if (__builtin_cpu_supports("avx512f")) {
+    tensor_create = CEED_SCALAR_TYPE == CEED_SCALAR_FP64 ? CeedTensorContractCreate_f64_Avx512 : CeedTensorContractCreate_f32_Avx512;
   }
+#endif
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "TensorContractCreate", tensor_create));
 
   return CEED_ERROR_SUCCESS;
 }
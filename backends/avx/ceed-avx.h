@@ -13,5 +13,9 @@
 
 CEED_INTERN int CeedTensorContractCreate_f32_Avx(CeedBasis basis, CeedTensorContract contract);
 CEED_INTERN int CeedTensorContractCreate_f64_Avx(CeedBasis basis, CeedTensorContract contract);
+#ifdef CEED_AVX512
+CEED_INTERN int CeedTensorContractCreate_f32_Avx512(CeedBasis basis, CeedTensorContract contract);
+CEED_INTERN int CeedTensorContractCreate_f64_Avx512(CeedBasis basis, CeedTensorContract contract);
+#endif
 
 #endif  // _ceed_avx_h
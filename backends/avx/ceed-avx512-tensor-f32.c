@@ -0,0 +1,207 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <immintrin.h>
+#include <stdbool.h>
+
+#include "ceed-avx.h"
+
+// c += a * b
+#define fmadd(c, a, b) (c) = _mm512_fmadd_ps((a), (b), (c))
+
+// Largest 1D matrix transposed into a stack buffer by the C=1 kernel
+#define CEED_AVX512_MAX_T_SIZE 1024
+
+//------------------------------------------------------------------------------
+// Mask for the first n lanes of a vector
+//------------------------------------------------------------------------------
+static inline __mmask16 CeedMask_Avx512(CeedInt n) { return n >= 16 ? (__mmask16)0xFFFF : (__mmask16)((1u << n) - 1); }
+
+//------------------------------------------------------------------------------
+// Output Tiles, Vectorized Over c
+//   v[jj][c] += t[jj][b] u[b][c] for 4 or 1 rows jj, accumulated in registers
+//------------------------------------------------------------------------------
+static inline void CeedTensorContract_Avx512_Tile_4x32(CeedInt B, const float *restrict t, CeedInt t_stride_0, CeedInt t_stride_1,
+                                                       const float *restrict u, float *restrict v, CeedInt C) {
+  __m512 v00 = _mm512_loadu_ps(&v[0 * C]), v01 = _mm512_loadu_ps(&v[0 * C + 16]);
+  __m512 v10 = _mm512_loadu_ps(&v[1 * C]), v11 = _mm512_loadu_ps(&v[1 * C + 16]);
+  __m512 v20 = _mm512_loadu_ps(&v[2 * C]), v21 = _mm512_loadu_ps(&v[2 * C + 16]);
+  __m512 v30 = _mm512_loadu_ps(&v[3 * C]), v31 = _mm512_loadu_ps(&v[3 * C + 16]);
+
+  for (CeedInt b = 0; b < B; b++) {
+    const __m512 u0 = _mm512_loadu_ps(&u[b * C]), u1 = _mm512_loadu_ps(&u[b * C + 16]);
+    const __m512 t0 = _mm512_set1_ps(t[0 * t_stride_0 + b * t_stride_1]), t1 = _mm512_set1_ps(t[1 * t_stride_0 + b * t_stride_1]);
+    const __m512 t2 = _mm512_set1_ps(t[2 * t_stride_0 + b * t_stride_1]), t3 = _mm512_set1_ps(t[3 * t_stride_0 + b * t_stride_1]);
+
+    fmadd(v00, t0, u0);
+    fmadd(v01, t0, u1);
+    fmadd(v10, t1, u0);
+    fmadd(v11, t1, u1);
+    fmadd(v20, t2, u0);
+    fmadd(v21, t2, u1);
+    fmadd(v30, t3, u0);
+    fmadd(v31, t3, u1);
+  }
+  _mm512_storeu_ps(&v[0 * C], v00);
+  _mm512_storeu_ps(&v[0 * C + 16], v01);
+  _mm512_storeu_ps(&v[1 * C], v10);
+  _mm512_storeu_ps(&v[1 * C + 16], v11);
+  _mm512_storeu_ps(&v[2 * C], v20);
+  _mm512_storeu_ps(&v[2 * C + 16], v21);
+  _mm512_storeu_ps(&v[3 * C], v30);
+  _mm512_storeu_ps(&v[3 * C + 16], v31);
+}
+
+static inline void CeedTensorContract_Avx512_Tile_4x16(CeedInt B, const float *restrict t, CeedInt t_stride_0, CeedInt t_stride_1,
+                                                      const float *restrict u, float *restrict v, CeedInt C, __mmask16 mask) {
+  __m512 v0 = _mm512_maskz_loadu_ps(mask, &v[0 * C]), v1 = _mm512_maskz_loadu_ps(mask, &v[1 * C]);
+  __m512 v2 = _mm512_maskz_loadu_ps(mask, &v[2 * C]), v3 = _mm512_maskz_loadu_ps(mask, &v[3 * C]);
+
+  for (CeedInt b = 0; b < B; b++) {
+    const __m512 uu = _mm512_maskz_loadu_ps(mask, &u[b * C]);
+
+    fmadd(v0, _mm512_set1_ps(t[0 * t_stride_0 + b * t_stride_1]), uu);
+    fmadd(v1, _mm512_set1_ps(t[1 * t_stride_0 + b * t_stride_1]), uu);
+    fmadd(v2, _mm512_set1_ps(t[2 * t_stride_0 + b * t_stride_1]), uu);
+    fmadd(v3, _mm512_set1_ps(t[3 * t_stride_0 + b * t_stride_1]), uu);
+  }
+  _mm512_mask_storeu_ps(&v[0 * C], mask, v0);
+  _mm512_mask_storeu_ps(&v[1 * C], mask, v1);
+  _mm512_mask_storeu_ps(&v[2 * C], mask, v2);
+  _mm512_mask_storeu_ps(&v[3 * C], mask, v3);
+}
+
+static inline void CeedTensorContract_Avx512_Tile_1x16(CeedInt B, const float *restrict t, CeedInt t_stride_1, const float *restrict u,
+                                                      float *restrict v, CeedInt C, __mmask16 mask) {
+  __m512 vv = _mm512_maskz_loadu_ps(mask, v);
+
+  for (CeedInt b = 0; b < B; b++) fmadd(vv, _mm512_set1_ps(t[b * t_stride_1]), _mm512_maskz_loadu_ps(mask, &u[b * C]));
+  _mm512_mask_storeu_ps(v, mask, vv);
+}
+
+//------------------------------------------------------------------------------
+// Blocked Tensor Contract
+//   Tiles of 4 rows by 32 or 16 columns, with masked remainder columns and single remainder rows
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Blocked(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,
+                                                    const float *restrict t, CeedTransposeMode t_mode, const CeedInt add, const float *restrict u,
+                                                    float *restrict v) {
+  CeedInt t_stride_0 = B, t_stride_1 = 1;
+  if (t_mode == CEED_TRANSPOSE) {
+    t_stride_0 = 1;
+    t_stride_1 = J;
+  }
+  const CeedInt J_break = (J / 4) * 4;
+
+  for (CeedInt a = 0; a < A; a++) {
+    const float *u_a = &u[a * B * C];
+    float       *v_a = &v[a * J * C];
+
+    // Blocks of 4 rows
+    for (CeedInt j = 0; j < J_break; j += 4) {
+      CeedInt c = 0;
+      for (; c + 32 <= C; c += 32) CeedTensorContract_Avx512_Tile_4x32(B, &t[j * t_stride_0], t_stride_0, t_stride_1, &u_a[c], &v_a[j * C + c], C);
+      for (; c < C; c += 16) {
+        CeedTensorContract_Avx512_Tile_4x16(B, &t[j * t_stride_0], t_stride_0, t_stride_1, &u_a[c], &v_a[j * C + c], C, CeedMask_Avx512(C - c));
+      }
+    }
+    // Remainder of rows
+    for (CeedInt j = J_break; j < J; j++) {
+      for (CeedInt c = 0; c < C; c += 16) {
+        CeedTensorContract_Avx512_Tile_1x16(B, &t[j * t_stride_0], t_stride_1, &u_a[c], &v_a[j * C + c], C, CeedMask_Avx512(C - c));
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Serial Tensor Contract C=1
+//   Vectorized over j with t stored as t_T[b][j], in tiles of 4 rows a by 16 columns j
+//------------------------------------------------------------------------------
+static inline int CeedTensorContract_Avx512_Single(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+                                                   CeedTransposeMode t_mode, const CeedInt add, const float *restrict u, float *restrict v) {
+  float        t_buffer[CEED_AVX512_MAX_T_SIZE];
+  const float *t_T = t;
+
+  if (t_mode == CEED_NOTRANSPOSE) {
+    if (B * J > CEED_AVX512_MAX_T_SIZE) return CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, t_mode, add, u, v);
+    for (CeedInt j = 0; j < J; j++) {
+      for (CeedInt b = 0; b < B; b++) t_buffer[b * J + j] = t[j * B + b];
+    }
+    t_T = t_buffer;
+  }
+  const CeedInt A_break = (A / 4) * 4;
+
+  // Blocks of 4 rows
+  for (CeedInt a = 0; a < A_break; a += 4) {
+    for (CeedInt j = 0; j < J; j += 16) {
+      const __mmask16 mask = CeedMask_Avx512(J - j);
+      __m512          v0 = _mm512_maskz_loadu_ps(mask, &v[(a + 0) * J + j]), v1 = _mm512_maskz_loadu_ps(mask, &v[(a + 1) * J + j]);
+      __m512          v2 = _mm512_maskz_loadu_ps(mask, &v[(a + 2) * J + j]), v3 = _mm512_maskz_loadu_ps(mask, &v[(a + 3) * J + j]);
+
+      for (CeedInt b = 0; b < B; b++) {
+        const __m512 tt = _mm512_maskz_loadu_ps(mask, &t_T[b * J + j]);
+
+        fmadd(v0, tt, _mm512_set1_ps(u[(a + 0) * B + b]));
+        fmadd(v1, tt, _mm512_set1_ps(u[(a + 1) * B + b]));
+        fmadd(v2, tt, _mm512_set1_ps(u[(a + 2) * B + b]));
+        fmadd(v3, tt, _mm512_set1_ps(u[(a + 3) * B + b]));
+      }
+      _mm512_mask_storeu_ps(&v[(a + 0) * J + j], mask, v0);
+      _mm512_mask_storeu_ps(&v[(a + 1) * J + j], mask, v1);
+      _mm512_mask_storeu_ps(&v[(a + 2) * J + j], mask, v2);
+      _mm512_mask_storeu_ps(&v[(a + 3) * J + j], mask, v3);
+    }
+  }
+  // Remainder of rows
+  for (CeedInt a = A_break; a < A; a++) {
+    for (CeedInt j = 0; j < J; j += 16) {
+      const __mmask16 mask = CeedMask_Avx512(J - j);
+      __m512          vv   = _mm512_maskz_loadu_ps(mask, &v[a * J + j]);
+
+      for (CeedInt b = 0; b < B; b++) fmadd(vv, _mm512_maskz_loadu_ps(mask, &t_T[b * J + j]), _mm512_set1_ps(u[a * B + b]));
+      _mm512_mask_storeu_ps(&v[a * J + j], mask, vv);
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Apply
+//------------------------------------------------------------------------------
+static int CeedTensorContractApply_Avx512(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J, const float *restrict t,
+                                          CeedTransposeMode t_mode, const CeedInt add, const float *restrict u, float *restrict v) {
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (float)0.0;
+  }
+
+  if (C == 1) {
+    // Serial C=1 Case
+    CeedTensorContract_Avx512_Single(contract, A, B, C, J, t, t_mode, true, u, v);
+  } else {
+    // Blocks of 32 or 16 columns
+    CeedTensorContract_Avx512_Blocked(contract, A, B, C, J, t, t_mode, true, u, v);
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Tensor Contract Create
+//------------------------------------------------------------------------------
+int CeedTensorContractCreate_f32_Avx512(CeedBasis basis, CeedTensorContract contract) {
+  Ceed ceed;
+  CeedCallBackend(CeedTensorContractGetCeed(contract, &ceed));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Avx512));
+
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -10,14 +10,16 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "ceed-blocked.h"
 
 //------------------------------------------------------------------------------
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
-static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bool is_input, CeedElemRestriction *blk_restr, CeedVector *e_vecs_full,
-                                           CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields, CeedInt Q) {
+static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bool is_input, const CeedInt blk_size, CeedElemRestriction *blk_restr,
+                                           CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedEvalMode *eval_modes, CeedInt start_e,
+                                           CeedInt num_fields, CeedInt Q) {
   CeedInt  num_comp, size, P;
   CeedSize e_size, q_size;
   Ceed     ceed;
@@ -33,12 +35,10 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
     CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
     CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
   }
-  const CeedInt blk_size = 8;
 
   // Loop over fields
   for (CeedInt i = 0; i < num_fields; i++) {
-    CeedEvalMode eval_mode;
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+    CeedEvalMode eval_mode = eval_modes[i];
 
     if (eval_mode != CEED_EVAL_WEIGHT) {
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &r));
@@ -58,12 +58,22 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
         CeedCallBackend(
             CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size, blk_size, num_comp, l_size, strides, &blk_restr[i + start_e]));
       } else {
-        const CeedInt *offsets = NULL;
-        CeedCallBackend(CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets));
+        bool has_offsets_64;
         CeedCallBackend(CeedElemRestrictionGetCompStride(r, &comp_stride));
-        CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                         CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
-        CeedCallBackend(CeedElemRestrictionRestoreOffsets(r, &offsets));
+        CeedCallBackend(CeedElemRestrictionHasOffsets64(r, &has_offsets_64));
+        if (has_offsets_64) {
+          const CeedSize *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked64(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                             CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets64(r, &offsets));
+        } else {
+          const CeedInt *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                           CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(r, &offsets));
+        }
       }
       CeedCallBackend(CeedElemRestrictionCreateVector(blk_restr[i + start_e], NULL, &e_vecs_full[i + start_e]));
     }
@@ -99,6 +109,25 @@ static int CeedOperatorSetupFields_Blocked(CeedQFunction qf, CeedOperator op, bo
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Field Evaluation Modes
+//   Interpolation with a collocated basis is the identity, so those fields use the E-vector as the Q-vector, as with CEED_EVAL_NONE
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupEvalModes_Blocked(CeedQFunctionField *qf_fields, CeedOperatorField *op_fields, CeedInt num_fields, bool is_identity_qf,
+                                              CeedEvalMode *eval_modes) {
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_modes[i]));
+    if (eval_modes[i] == CEED_EVAL_INTERP && !is_identity_qf) {
+      CeedBasis basis;
+      bool      is_collocated;
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+      CeedCallBackend(CeedBasisIsCollocated(basis, &is_collocated));
+      if (is_collocated) eval_modes[i] = CEED_EVAL_NONE;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -108,6 +137,9 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   if (is_setup_done) return CEED_ERROR_SUCCESS;
   Ceed ceed;
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Blocked *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  const CeedInt         blk_size = ceed_impl->blk_size;
   CeedOperator_Blocked *impl;
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedQFunction qf;
@@ -129,17 +161,22 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->eval_modes_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->eval_modes_out));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
   // Set up infield and outfield pointer arrays
-  // Infields
+  CeedCallBackend(CeedOperatorSetupEvalModes_Blocked(qf_input_fields, op_input_fields, num_input_fields, impl->is_identity_qf, impl->eval_modes_in));
   CeedCallBackend(
-      CeedOperatorSetupFields_Blocked(qf, op, true, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0, num_input_fields, Q));
+      CeedOperatorSetupEvalModes_Blocked(qf_output_fields, op_output_fields, num_output_fields, impl->is_identity_qf, impl->eval_modes_out));
+  // Infields
+  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, true, blk_size, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in,
+                                                  impl->eval_modes_in, 0, num_input_fields, Q));
   // Outfields
-  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, false, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
-                                                  num_input_fields, num_output_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Blocked(qf, op, false, blk_size, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
+                                                  impl->eval_modes_out, num_input_fields, num_output_fields, Q));
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -167,8 +204,8 @@ static int CeedOperatorSetup_Blocked(CeedOperator op) {
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                  CeedVector in_vec, bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                                  CeedOperator_Blocked *impl, CeedRequest *request) {
+                                                  CeedVector in_vec, bool skip_active, CeedVector *e_vecs_active, CeedInt blk_start, CeedInt blk_end,
+                                                  CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Blocked *impl, CeedRequest *request) {
   CeedEvalMode eval_mode;
   CeedVector   vec;
   uint64_t     state;
@@ -181,12 +218,20 @@ static inline int CeedOperatorSetupInputs_Blocked(CeedInt num_input_fields, Ceed
       else vec = in_vec;
     }
 
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_in[i];
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
+    } else if (vec == in_vec && e_vecs_active) {
+      // Active input restricted by the caller
+      CeedCallBackend(CeedVectorGetArrayRead(e_vecs_active[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
     } else {
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
-      if (state != impl->input_states[i] || vec == in_vec) {
+      if (vec == in_vec) {
+        // Active input only needs the blocks in range
+        CeedCallBackend(
+            CeedElemRestrictionApplyBlockRange(impl->blk_restr[i], blk_start, blk_end, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        impl->input_states[i] = state;
+      } else if (state != impl->input_states[i]) {
         CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
         impl->input_states[i] = state;
       }
@@ -219,29 +264,29 @@ static inline int CeedOperatorInputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFunc
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr));
     CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_in[i];
     CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
         break;
       case CEED_EVAL_INTERP:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_GRAD:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_DIV:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_DIV, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
@@ -274,7 +319,7 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFun
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr));
     CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_out[i];
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
@@ -282,22 +327,22 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFun
       case CEED_EVAL_INTERP:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_TRANSPOSE, CEED_EVAL_INTERP, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       case CEED_EVAL_GRAD:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_TRANSPOSE, CEED_EVAL_GRAD, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       case CEED_EVAL_DIV:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_TRANSPOSE, CEED_EVAL_DIV, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       // LCOV_EXCL_START
@@ -321,36 +366,57 @@ static inline int CeedOperatorOutputBasis_Blocked(CeedInt e, CeedInt Q, CeedQFun
 // Restore Input Vectors
 //------------------------------------------------------------------------------
 static inline int CeedOperatorRestoreInputs_Blocked(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                    bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Blocked *impl) {
+                                                    bool skip_active, CeedVector *e_vecs_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
+                                                    CeedOperator_Blocked *impl) {
   CeedEvalMode eval_mode;
 
   for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedVector vec;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
     // Skip active inputs
-    if (skip_active) {
-      CeedVector vec;
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      if (vec == CEED_VECTOR_ACTIVE) continue;
-    }
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (skip_active && vec == CEED_VECTOR_ACTIVE) continue;
+    eval_mode = impl->eval_modes_in[i];
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
-      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
+      CeedVector e_vec = (vec == CEED_VECTOR_ACTIVE && e_vecs_active) ? e_vecs_active[i] : impl->e_vecs_full[i];
+      CeedCallBackend(CeedVectorRestoreArrayRead(e_vec, (const CeedScalar **)&e_data_full[i]));
     }
   }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Zero Element Lanes Outside [e_start, e_end) in an Output Block
+//   Blocked E-vectors interlace the elements of a block, so partial blocks at the ends of a range are masked before the transpose restriction
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+static inline void CeedOperatorMaskBlock_Blocked(CeedScalar *e_data, CeedInt e, CeedSize e_size, CeedInt blk_size, CeedInt e_start, CeedInt e_end) {
+  CeedScalar *blk_data = &e_data[(CeedSize)e * e_size];
+
+  for (CeedInt j = 0; j < blk_size; j++) {
+    if (e + j >= e_start && e + j < e_end) continue;
+    for (CeedSize k = 0; k < e_size; k++) blk_data[k * blk_size + j] = 0.0;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on Elements [e_start, e_end)
+//   With e_vecs_active, active inputs are read from E-vectors restricted by the caller and active outputs are left in E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddCore_Blocked(CeedOperator op, CeedInt e_start, CeedInt e_end, CeedVector in_vec, CeedVector out_vec,
+                                            CeedVector *e_vecs_active, CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Blocked *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedOperator_Blocked *impl;
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  const CeedInt blk_size = 8;
+  const CeedInt blk_size = ceed_impl->blk_size;
   CeedInt       Q, num_input_fields, num_output_fields, num_elem, size;
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedInt       num_blks = (num_elem / blk_size) + !!(num_elem % blk_size);
+  const CeedInt blk_start = e_start / blk_size, blk_end = (e_end / blk_size) + !!(e_end % blk_size);
+  // Padding lanes past num_elem are never summed into the L-vector
+  const bool is_partial_blk = e_start % blk_size || (e_end % blk_size && e_end < num_elem);
   CeedQFunction qf;
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedOperatorField *op_input_fields, *op_output_fields;
@@ -366,13 +432,25 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 
   // Restriction only operator
   if (impl->is_identity_restr_op) {
-    CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
-    CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    CeedCallBackend(
+        CeedElemRestrictionApplyBlockRange(impl->blk_restr[0], blk_start, blk_end, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    if (is_partial_blk) {
+      CeedInt elem_size, num_comp;
+      CeedCallBackend(CeedElemRestrictionGetElementSize(impl->blk_restr[0], &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(impl->blk_restr[0], &num_comp));
+      CeedCallBackend(CeedVectorGetArray(impl->e_vecs_full[0], CEED_MEM_HOST, &e_data_full[0]));
+      CeedOperatorMaskBlock_Blocked(e_data_full[0], blk_start * blk_size, (CeedSize)elem_size * num_comp, blk_size, e_start, e_end);
+      CeedOperatorMaskBlock_Blocked(e_data_full[0], (blk_end - 1) * blk_size, (CeedSize)elem_size * num_comp, blk_size, e_start, e_end);
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[0], &e_data_full[0]));
+    }
+    CeedCallBackend(
+        CeedElemRestrictionApplyBlockRange(impl->blk_restr[1], blk_start, blk_end, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
     return CEED_ERROR_SUCCESS;
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_vecs_active, blk_start,
+                                                  blk_end, e_data_full, impl, request));
 
   // Output Evecs
   for (CeedInt i = 0; i < num_output_fields; i++) {
@@ -380,13 +458,14 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
   }
 
   // Loop through elements
-  for (CeedInt e = 0; e < num_blks * blk_size; e += blk_size) {
+  for (CeedInt e = blk_start * blk_size; e < blk_end * blk_size; e += blk_size) {
     // Output pointers
     for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+      eval_mode = impl->eval_modes_out[i];
       if (eval_mode == CEED_EVAL_NONE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
       }
     }
 
@@ -405,31 +484,274 @@ static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, Ceed
 
   // Output restriction
   for (CeedInt i = 0; i < num_output_fields; i++) {
+    // Mask elements outside of range in partial blocks
+    if (is_partial_blk) {
+      CeedInt elem_size, num_comp;
+      CeedCallBackend(CeedElemRestrictionGetElementSize(impl->blk_restr[i + impl->num_inputs], &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(impl->blk_restr[i + impl->num_inputs], &num_comp));
+      CeedOperatorMaskBlock_Blocked(e_data_full[i + num_input_fields], blk_start * blk_size, (CeedSize)elem_size * num_comp, blk_size, e_start,
+                                    e_end);
+      CeedOperatorMaskBlock_Blocked(e_data_full[i + num_input_fields], (blk_end - 1) * blk_size, (CeedSize)elem_size * num_comp, blk_size, e_start,
+                                    e_end);
+    }
     // Restore evec
     CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + impl->num_inputs], &e_data_full[i + num_input_fields]));
     // Get output vector
     CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
     // Active
-    if (vec == CEED_VECTOR_ACTIVE) vec = out_vec;
+    if (vec == CEED_VECTOR_ACTIVE) {
+      if (e_vecs_active) continue;
+      vec = out_vec;
+    }
     // Restrict
-    CeedCallBackend(
-        CeedElemRestrictionApply(impl->blk_restr[i + impl->num_inputs], CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    CeedCallBackend(CeedElemRestrictionApplyBlockRange(impl->blk_restr[i + impl->num_inputs], blk_start, blk_end, CEED_TRANSPOSE,
+                                                       impl->e_vecs_full[i + impl->num_inputs], vec, request));
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, false, e_vecs_active, e_data_full, impl));
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt num_elem;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorApplyAddCore_Blocked(op, 0, num_elem, in_vec, out_vec, NULL, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Range Setup and Serialized Range Apply, Called with the Thread Lock Held
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyAddRangeSerial_Blocked(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec,
+                                                          CeedVector out_vec, bool *is_serial, CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Blocked *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedOperator_Blocked *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  bool is_profiling;
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Blocked(op));
+  if (!impl->range) CeedCallBackend(CeedOperatorRangeCreate_Ref(op, ceed_impl->blk_size, impl->blk_restr, &impl->range));
+
+  // Phases are profiled through the libCEED interfaces, and some objects intercept their apply, so these applications are serialized
+  *is_serial = is_profiling || !impl->range->is_concurrent;
+  if (*is_serial) CeedCallBackend(CeedOperatorApplyAddCore_Blocked(op, elem_start, elem_stop, in_vec, out_vec, NULL, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//   Range applications into different output vectors run concurrently on the element range data
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Blocked(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                             CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_Blocked *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  bool is_serial = true;
+  int  ierr;
+
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorApplyAddRangeSerial_Blocked(op, elem_start, elem_stop, in_vec, out_vec, &is_serial, request);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  if (!is_serial) CeedCallBackend(CeedOperatorRangeApply_Ref(op, impl->range, elem_start, elem_stop, in_vec, out_vec));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//   Active inputs are restricted once for each CeedElemRestriction shared by the sub-operators, and the active outputs of sub-operators that share
+//   a CeedElemRestriction are summed in blocked E-vector form and scattered with a single transpose
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Blocked(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                           is_profiling, is_fused;
+  Ceed                           ceed;
+  CeedInt                        num_sub, num_rstr_out = 0;
+  CeedOperator                  *sub_operators;
+  CeedOperatorComposite_Blocked *impl_comp;
+  CeedElemRestriction            rstr_out[CEED_COMPOSITE_MAX * CEED_FIELD_MAX], blk_rstr_out[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];
+  CeedVector                     e_vecs_active[CEED_COMPOSITE_MAX][CEED_FIELD_MAX], e_vecs_out[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl_comp));
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+
+  // Only sub-operators from this backend are fused, and profiling records each sub-operator separately
+  is_fused = !is_profiling;
+  for (CeedInt i = 0; i < num_sub && is_fused; i++) {
+    bool is_composite;
+    Ceed sub_ceed;
+    CeedCallBackend(CeedOperatorIsComposite(sub_operators[i], &is_composite));
+    CeedCallBackend(CeedOperatorGetCeed(sub_operators[i], &sub_ceed));
+    is_fused = !is_composite && sub_ceed == ceed;
+  }
+  for (CeedInt i = 0; i < num_sub && is_fused; i++) {
+    CeedOperator_Blocked *impl;
+    CeedCallBackend(CeedOperatorSetup_Blocked(sub_operators[i]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[i], &impl));
+    is_fused = !impl->is_identity_restr_op;
+  }
+  if (!is_fused) {
+    for (CeedInt i = 0; i < num_sub; i++) CeedCallBackend(CeedOperatorApplyAdd(sub_operators[i], in_vec, out_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Active inputs with the same CeedElemRestriction share a blocked E-vector owned by the composite CeedOperator
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt               num_input_fields;
+    CeedOperatorField    *op_input_fields;
+    CeedOperator_Blocked *impl;
+    CeedCallBackend(CeedOperatorGetData(sub_operators[i], &impl));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[i], &num_input_fields, &op_input_fields, NULL, NULL));
+    for (CeedInt j = 0; j < num_input_fields; j++) {
+      CeedInt             k = 0;
+      CeedVector          vec;
+      CeedElemRestriction elem_restr;
+
+      e_vecs_active[i][j] = NULL;
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[j], &vec));
+      if (vec != CEED_VECTOR_ACTIVE) continue;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[j], &elem_restr));
+      while (k < impl_comp->num_rstr_in && impl_comp->rstr_in[k] != elem_restr) k++;
+      if (k == impl_comp->num_rstr_in) {
+        CeedCallBackend(CeedElemRestrictionReferenceCopy(elem_restr, &impl_comp->rstr_in[k]));
+        CeedCallBackend(CeedElemRestrictionReferenceCopy(impl->blk_restr[j], &impl_comp->blk_rstr_in[k]));
+        CeedCallBackend(CeedElemRestrictionCreateVector(impl->blk_restr[j], NULL, &impl_comp->e_vecs_in[k]));
+        impl_comp->num_rstr_in++;
+      }
+      e_vecs_active[i][j] = impl_comp->e_vecs_in[k];
+    }
+  }
+
+  // Input restriction
+  for (CeedInt k = 0; k < impl_comp->num_rstr_in; k++) {
+    CeedCallBackend(CeedElemRestrictionApply(impl_comp->blk_rstr_in[k], CEED_NOTRANSPOSE, in_vec, impl_comp->e_vecs_in[k], request));
+  }
+
+  // Element sweeps
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt num_elem;
+    CeedCallBackend(CeedOperatorGetNumElements(sub_operators[i], &num_elem));
+    CeedCallBackend(CeedOperatorApplyAddCore_Blocked(sub_operators[i], 0, num_elem, in_vec, out_vec, e_vecs_active[i], request));
+  }
+
+  // Sum active output E-vectors with the same CeedElemRestriction
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt               num_output_fields;
+    CeedOperatorField    *op_output_fields;
+    CeedOperator_Blocked *impl;
+    CeedCallBackend(CeedOperatorGetData(sub_operators[i], &impl));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[i], NULL, NULL, &num_output_fields, &op_output_fields));
+    for (CeedInt j = 0; j < num_output_fields; j++) {
+      CeedInt             k = 0;
+      CeedVector          vec;
+      CeedElemRestriction elem_restr;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[j], &vec));
+      if (vec != CEED_VECTOR_ACTIVE) continue;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[j], &elem_restr));
+      while (k < num_rstr_out && rstr_out[k] != elem_restr) k++;
+      if (k == num_rstr_out) {
+        rstr_out[k]     = elem_restr;
+        blk_rstr_out[k] = impl->blk_restr[j + impl->num_inputs];
+        e_vecs_out[k]   = impl->e_vecs_full[j + impl->num_inputs];
+        num_rstr_out++;
+      } else {
+        CeedCallBackend(CeedVectorAXPY(e_vecs_out[k], 1.0, impl->e_vecs_full[j + impl->num_inputs]));
+      }
+    }
+  }
+
+  // Output restriction
+  for (CeedInt k = 0; k < num_rstr_out; k++) {
+    CeedCallBackend(CeedElemRestrictionApply(blk_rstr_out[k], CEED_TRANSPOSE, e_vecs_out[k], out_vec, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Replicate Passive QFunction Inputs for Batched Assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupBatchInputs_Blocked(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields,
+                                                       CeedOperatorField *op_input_fields, CeedInt num_active_in, CeedInt num_points,
+                                                       CeedOperator_Blocked *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_in;
+    CeedScalar       *q_batch;
+    // Active inputs hold fixed unit vectors
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_in));
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&q_batch[(field * num_active_in + in) * num_points], &q_in[field * num_points], num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_in));
+    CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &q_batch));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy Batched QFunction Outputs into Assembled Layout
+//------------------------------------------------------------------------------
+static inline int CeedOperatorAssembleBatchOutputs_Blocked(CeedInt num_output_fields, CeedQFunctionField *qf_output_fields,
+                                                           CeedOperatorField *op_output_fields, CeedInt num_active_in, CeedInt num_active_out,
+                                                           CeedInt num_points, CeedScalar *assembled, CeedOperator_Blocked *impl) {
+  CeedInt active_offset = 0;
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_batch;
+    // Skip passive outputs
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->qf_batch_out[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&assembled[(in * num_active_out + active_offset + field) * num_points], &q_batch[(field * num_active_in + in) * num_points],
+               num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->qf_batch_out[i], &q_batch));
+    active_offset += size;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core code for assembling linear QFunction
 //------------------------------------------------------------------------------
 static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator op, bool build_objects, CeedVector *assembled,
                                                                   CeedElemRestriction *rstr, CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Blocked *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
   CeedOperator_Blocked *impl;
   CeedCallBackend(CeedOperatorGetData(op, &impl));
-  const CeedInt blk_size = 8;
+  const CeedInt blk_size = ceed_impl->blk_size;
   CeedInt       Q, num_input_fields, num_output_fields, num_elem, size;
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
@@ -443,10 +765,7 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
   CeedVector  vec, l_vec = impl->qf_l_vec;
   CeedInt     num_active_in = impl->num_active_in, num_active_out = impl->num_active_out;
   CeedSize    q_size;
-  CeedVector *active_in = impl->qf_active_in;
   CeedScalar *a, *tmp;
-  Ceed        ceed;
-  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
   CeedScalar *e_data_full[2 * CEED_FIELD_MAX] = {0};
 
   // Setup
@@ -460,7 +779,8 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(
+      CeedOperatorSetupInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, NULL, true, NULL, 0, num_blks, e_data_full, impl, request));
 
   // Count number of active input fields
   if (!num_active_in) {
@@ -470,20 +790,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
       // Check if active input
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
-        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &tmp));
-        CeedCallBackend(CeedRealloc(num_active_in + size, &active_in));
-        for (CeedInt field = 0; field < size; field++) {
-          q_size = (CeedSize)Q * blk_size;
-          CeedCallBackend(CeedVectorCreate(ceed, q_size, &active_in[num_active_in + field]));
-          CeedCallBackend(CeedVectorSetArray(active_in[num_active_in + field], CEED_MEM_HOST, CEED_USE_POINTER, &tmp[field * Q * blk_size]));
-        }
         num_active_in += size;
-        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &tmp));
       }
     }
     impl->num_active_in = num_active_in;
-    impl->qf_active_in  = active_in;
   }
 
   // Count number of active output fields
@@ -507,6 +817,35 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
     // LCOV_EXCL_STOP
   }
 
+  // Batched Q-vectors, with one copy of the quadrature points per active input component
+  if (!impl->qf_batch_in) {
+    CeedInt active_offset = 0;
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_out));
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q * blk_size;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_in[i]));
+      // Set unit vectors for active input components
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorSetValue(impl->qf_batch_in[i], 0.0));
+        CeedCallBackend(CeedVectorGetArray(impl->qf_batch_in[i], CEED_MEM_HOST, &tmp));
+        for (CeedInt field = 0; field < size; field++) {
+          CeedScalar *unit_in = &tmp[(field * num_active_in + active_offset + field) * Q * blk_size];
+          for (CeedInt j = 0; j < Q * blk_size; j++) unit_in[j] = 1.0;
+        }
+        CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &tmp));
+        active_offset += size;
+      }
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q * blk_size;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_out[i]));
+    }
+  }
+
   // Setup Lvec
   if (!l_vec) {
     CeedSize l_size = (CeedSize)num_blks * blk_size * Q * num_active_in * num_active_out;
@@ -531,41 +870,16 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Blocked(CeedOperator o
     // Input basis apply
     CeedCallBackend(CeedOperatorInputBasis_Blocked(e, Q, qf_input_fields, op_input_fields, num_input_fields, blk_size, true, e_data_full, impl));
 
-    // Assemble QFunction
-    for (CeedInt in = 0; in < num_active_in; in++) {
-      // Set Inputs
-      CeedCallBackend(CeedVectorSetValue(active_in[in], 1.0));
-      if (num_active_in > 1) {
-        CeedCallBackend(CeedVectorSetValue(active_in[(in + num_active_in - 1) % num_active_in], 0.0));
-      }
-      // Set Outputs
-      for (CeedInt out = 0; out < num_output_fields; out++) {
-        // Get output vector
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, a));
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &size));
-          a += size * Q * blk_size;  // Advance the pointer by the size of the output
-        }
-      }
-      // Apply QFunction
-      CeedCallBackend(CeedQFunctionApply(qf, Q * blk_size, impl->q_vecs_in, impl->q_vecs_out));
-    }
-  }
-
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out = 0; out < num_output_fields; out++) {
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_COPY_VALUES, NULL));
-    }
+    // Assemble QFunction for all active input components at once
+    CeedCallBackend(CeedOperatorSetupBatchInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, num_active_in, Q * blk_size, impl));
+    CeedCallBackend(CeedQFunctionApply(qf, num_active_in * Q * blk_size, impl->qf_batch_in, impl->qf_batch_out));
+    CeedCallBackend(CeedOperatorAssembleBatchOutputs_Blocked(num_output_fields, qf_output_fields, op_output_fields, num_active_in, num_active_out,
+                                                             Q * blk_size, a, impl));
+    a += num_active_in * num_active_out * Q * blk_size;
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Blocked(num_input_fields, qf_input_fields, op_input_fields, true, NULL, e_data_full, impl));
 
   // Output blocked restriction
   CeedCallBackend(CeedVectorRestoreArray(l_vec, &a));
@@ -607,6 +921,7 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
   }
   CeedCallBackend(CeedFree(&impl->blk_restr));
+  CeedCallBackend(CeedOperatorRangeDestroy_Ref(&impl->range));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
 
@@ -623,12 +938,20 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  CeedCallBackend(CeedFree(&impl->eval_modes_in));
+  CeedCallBackend(CeedFree(&impl->eval_modes_out));
 
   // QFunction assembly data
-  for (CeedInt i = 0; i < impl->num_active_in; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->qf_active_in[i]));
+  if (impl->qf_batch_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_in[i]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_out[i]));
+    }
   }
-  CeedCallBackend(CeedFree(&impl->qf_active_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_out));
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_blk_rstr));
 
@@ -636,6 +959,22 @@ static int CeedOperatorDestroy_Blocked(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyComposite_Blocked(CeedOperator op) {
+  CeedOperatorComposite_Blocked *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  for (CeedInt k = 0; k < impl->num_rstr_in; k++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->rstr_in[k]));
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->blk_rstr_in[k]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[k]));
+  }
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
@@ -650,7 +989,24 @@ int CeedOperatorCreate_Blocked(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange", CeedOperatorApplyAddRange_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Blocked));
   return CEED_ERROR_SUCCESS;
 }
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Blocked(CeedOperator op) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperatorComposite_Blocked *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroyComposite_Blocked));
+  return CEED_ERROR_SUCCESS;
+}
 //------------------------------------------------------------------------------
@@ -12,15 +12,33 @@
 #include <stdbool.h>
 #include <string.h>
 
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Blocked(Ceed ceed) {
+  Ceed_Blocked *data;
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data));
+
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Backend Init
 //------------------------------------------------------------------------------
 CEED_INTERN int CeedInit_Blocked(const char *resource, Ceed ceed) {
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/ref/blocked")) {
+  char *resource_root;
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  if (strcmp(resource_root, "/cpu/self") && strcmp(resource_root, "/cpu/self/ref/blocked")) {
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND, "Blocked backend cannot use resource: %s", resource);
     // LCOV_EXCL_STOP
   }
+  CeedCallBackend(CeedFree(&resource_root));
+
+  // Block size may be selected with the resource option ":blk_size=N"
+  CeedInt blk_size;
+  CeedCallBackend(CeedGetResourceBlockSize(ceed, resource, 8, &blk_size));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
@@ -32,7 +50,15 @@ CEED_INTERN int CeedInit_Blocked(const char *resource, Ceed ceed) {
   const char fallbackresource[] = "/cpu/self/ref/serial";
   CeedCallBackend(CeedSetOperatorFallbackResource(ceed, fallbackresource));
 
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Blocked));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Blocked));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "CompositeOperatorCreate", CeedCompositeOperatorCreate_Blocked));
+
+  // Set blocksize
+  Ceed_Blocked *data;
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->blk_size = blk_size;
+  CeedCallBackend(CeedSetData(ceed, data));
 
   return CEED_ERROR_SUCCESS;
 }
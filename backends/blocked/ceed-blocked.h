@@ -13,26 +13,44 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "../ref/ceed-ref.h"
+
+typedef struct {
+  CeedInt blk_size;
+} Ceed_Blocked;
+
 typedef struct {
   CeedScalar *colo_grad_1d;
 } CeedBasis_Blocked;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_restr_op;
-  CeedElemRestriction *blk_restr;    /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              num_active_in, num_active_out;
-  CeedVector          *qf_active_in;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_blk_rstr;
+  bool                   is_identity_qf, is_identity_restr_op;
+  CeedElemRestriction   *blk_restr;      /* Blocked versions of restrictions */
+  CeedVector            *e_vecs_full;    /* Full E-vectors, inputs followed by outputs */
+  uint64_t              *input_states;   /* State counter of inputs */
+  CeedVector            *e_vecs_in;      /* Element block input E-vectors  */
+  CeedVector            *e_vecs_out;     /* Element block output E-vectors */
+  CeedVector            *q_vecs_in;      /* Element block input Q-vectors  */
+  CeedVector            *q_vecs_out;     /* Element block output Q-vectors */
+  CeedEvalMode          *eval_modes_in;  /* Input evaluation modes, with collocated interpolation as CEED_EVAL_NONE */
+  CeedEvalMode          *eval_modes_out; /* Output evaluation modes, with collocated interpolation as CEED_EVAL_NONE */
+  CeedInt                num_inputs, num_outputs;
+  CeedInt                num_active_in, num_active_out;
+  CeedVector            *qf_batch_in;  /* Batched input Q-vectors for QFunction assembly  */
+  CeedVector            *qf_batch_out; /* Batched output Q-vectors for QFunction assembly */
+  CeedVector             qf_l_vec;
+  CeedElemRestriction    qf_blk_rstr;
+  CeedOperatorRange_Ref *range; /* Element range application data */
 } CeedOperator_Blocked;
 
+typedef struct {
+  CeedInt             num_rstr_in;
+  CeedElemRestriction rstr_in[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];     /* Active input CeedElemRestrictions of the sub-operators */
+  CeedElemRestriction blk_rstr_in[CEED_COMPOSITE_MAX * CEED_FIELD_MAX]; /* Blocked versions of the active input CeedElemRestrictions */
+  CeedVector          e_vecs_in[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];   /* Shared active input E-vectors, one per CeedElemRestriction */
+} CeedOperatorComposite_Blocked;
+
 CEED_INTERN int CeedOperatorCreate_Blocked(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Blocked(CeedOperator op);
 
 #endif  // _ceed_blocked_h
@@ -13,6 +13,7 @@
 
 MACRO(CeedRegister_Avx_Blocked, 1, "/cpu/self/avx/blocked")
 MACRO(CeedRegister_Avx_Serial, 1, "/cpu/self/avx/serial")
+MACRO(CeedRegister_Cpu_Gen, 1, "/cpu/self/gen")
 MACRO(CeedRegister_Cuda, 1, "/gpu/cuda/ref")
 MACRO(CeedRegister_Cuda_Gen, 1, "/gpu/cuda/gen")
 MACRO(CeedRegister_Cuda_Shared, 1, "/gpu/cuda/shared")
@@ -24,6 +25,7 @@ MACRO(CeedRegister_Magma_Det, 2, "/gpu/cuda/magma/det", "/gpu/hip/magma/det")
 MACRO(CeedRegister_Memcheck_Blocked, 1, "/cpu/self/memcheck/blocked")
 MACRO(CeedRegister_Memcheck_Serial, 1, "/cpu/self/memcheck/serial")
 MACRO(CeedRegister_Occa, 6, "/cpu/self/occa", "/cpu/openmp/occa", "/gpu/dpcpp/occa", "/gpu/opencl/occa", "/gpu/hip/occa", "/gpu/cuda/occa")
+MACRO(CeedRegister_Omp_Blocked, 1, "/cpu/self/omp/blocked")
 MACRO(CeedRegister_Opt_Blocked, 1, "/cpu/self/opt/blocked")
 MACRO(CeedRegister_Opt_Serial, 1, "/cpu/self/opt/serial")
 MACRO(CeedRegister_Ref, 1, "/cpu/self/ref/serial")
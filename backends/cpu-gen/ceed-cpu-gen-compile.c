@@ -0,0 +1,174 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <ceed/jit-tools.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ceed-cpu-gen.h"
+
+// Host compiler and flags, set by the build system
+#ifndef CEED_CPU_GEN_CC
+#define CEED_CPU_GEN_CC "cc"
+#endif
+#ifndef CEED_CPU_GEN_CFLAGS
+#define CEED_CPU_GEN_CFLAGS "-O2"
+#endif
+
+//------------------------------------------------------------------------------
+// Check that a compiler command, flags, or path contain no shell metacharacters
+//   The command is run with popen() and system(), so only words of letters, digits, and the characters in "_-+=./,:@%" separated by spaces are
+//   accepted; quoting, variables, redirection, and command separators are rejected rather than escaped
+//------------------------------------------------------------------------------
+static bool CeedIsShellSafeCpuGen(const char *words) {
+  for (const char *c = words; *c; c++) {
+    if (!((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z') || (*c >= '0' && *c <= '9') || strchr(" _-+=./,:@%", *c))) return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Compiler identity for the JiT cache, the command and the first line of its version output
+//------------------------------------------------------------------------------
+static int CeedGetCompilerIdCpuGen(Ceed ceed, const char *cc, const char **compiler_id) {
+  Ceed_CpuGen *data;
+  CeedCallBackend(CeedGetData(ceed, &data));
+
+  if (!data->compiler_id) {
+    char  command[1024], version[256] = "";
+    FILE *version_pipe;
+
+    snprintf(command, sizeof(command), "%s --version 2>/dev/null", cc);
+    version_pipe = popen(command, "r");
+    if (version_pipe) {
+      if (!fgets(version, sizeof(version), version_pipe)) version[0] = '\0';
+      pclose(version_pipe);
+    }
+    const size_t id_len = strlen(cc) + strlen(version) + 2;
+    CeedCallBackend(CeedCalloc(id_len, &data->compiler_id));
+    snprintf(data->compiler_id, id_len, "%s\n%s", cc, version);
+  }
+  *compiler_id = data->compiler_id;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Compile C kernel to a shared object and load it
+//   Shared objects are loaded from the JiT cache directory, if set, and stored there after compilation
+//   If the host compiler is unavailable or rejects the source, module is set to NULL and the caller is expected to fall back
+//------------------------------------------------------------------------------
+int CeedCompileCpuGen(Ceed ceed, const char *source, void **module) {
+  *module = NULL;
+
+  // The compiler and flags may be overridden at runtime with CEED_CPU_GEN_CC and CEED_CPU_GEN_CFLAGS
+  const char *cc = getenv("CEED_CPU_GEN_CC"), *cflags = getenv("CEED_CPU_GEN_CFLAGS"), *compiler_id;
+  char       *cache_path;
+  if (!cc) cc = CEED_CPU_GEN_CC;
+  if (!cflags) cflags = CEED_CPU_GEN_CFLAGS;
+  if (!CeedIsShellSafeCpuGen(cc) || !CeedIsShellSafeCpuGen(cflags)) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "CEED_CPU_GEN_CC and CEED_CPU_GEN_CFLAGS may only use letters, digits, spaces, and _-+=./,:@%%: %s %s",
+                     cc, cflags);
+    // LCOV_EXCL_STOP
+  }
+
+  // Check JiT cache
+  CeedCallBackend(CeedGetCompilerIdCpuGen(ceed, cc, &compiler_id));
+  CeedCallBackend(CeedGetJitCachePath(ceed, source, cflags, compiler_id, ".so", &cache_path));
+  if (cache_path && !access(cache_path, R_OK)) {
+    *module = dlopen(cache_path, RTLD_NOW | RTLD_LOCAL);
+    if (*module) {
+      CeedDebug256(ceed, 2, "----- Loaded CPU Kernel from JiT Cache -----\n");
+      CeedCallBackend(CeedFree(&cache_path));
+      return CEED_ERROR_SUCCESS;
+    }
+    CeedDebug(ceed, "Could not load cached CPU kernel: %s\n", dlerror());
+  }
+
+  // Scratch directory
+  const char *tmp_dir = getenv("TMPDIR");
+  char        dir[1024], source_path[1040], lib_path[1040], log_path[1040];
+  snprintf(dir, sizeof(dir), "%s/ceed-cpu-gen-XXXXXX", tmp_dir && CeedIsShellSafeCpuGen(tmp_dir) ? tmp_dir : "/tmp");
+  if (!mkdtemp(dir)) {
+    // LCOV_EXCL_START
+    CeedDebug256(ceed, 1, "Could not create directory for CPU code generation: %s\n", dir);
+    CeedCallBackend(CeedFree(&cache_path));
+    return CEED_ERROR_SUCCESS;
+    // LCOV_EXCL_STOP
+  }
+  snprintf(source_path, sizeof(source_path), "%s/kernel.c", dir);
+  snprintf(lib_path, sizeof(lib_path), "%s/kernel.so", dir);
+  snprintf(log_path, sizeof(log_path), "%s/kernel.log", dir);
+
+  // Write source
+  FILE *source_file = fopen(source_path, "w");
+  if (source_file) {
+    fputs(source, source_file);
+    fclose(source_file);
+  }
+
+  // Compile
+  char  *command;
+  size_t command_len = strlen(cc) + strlen(cflags) + strlen(source_path) + strlen(lib_path) + strlen(log_path) + 64;
+  CeedCallBackend(CeedCalloc(command_len, &command));
+  snprintf(command, command_len, "%s %s -fPIC -shared -o \"%s\" \"%s\" > \"%s\" 2>&1", cc, cflags, lib_path, source_path, log_path);
+  CeedDebug256(ceed, 2, "----- Compiling CPU Kernel -----\n");
+  CeedDebug(ceed, "%s\n", command);
+  const int status = source_file ? system(command) : -1;
+  CeedCallBackend(CeedFree(&command));
+
+  // Load
+  if (!status) {
+    *module = dlopen(lib_path, RTLD_NOW | RTLD_LOCAL);
+    if (!*module) CeedDebug(ceed, "Could not load compiled CPU kernel: %s\n", dlerror());
+  } else {
+    CeedDebug(ceed, "Host compiler failed with status %d\n", status);
+    FILE *log_file = fopen(log_path, "r");
+    if (log_file) {
+      char line[256];
+      while (fgets(line, sizeof(line), log_file)) CeedDebug(ceed, "%s", line);
+      fclose(log_file);
+    }
+  }
+
+  // Store in JiT cache
+  if (*module && cache_path) {
+    char  *lib_buffer;
+    size_t lib_size;
+    CeedCallBackend(CeedReadJitCache(ceed, lib_path, &lib_buffer, &lib_size));
+    if (lib_buffer) CeedCallBackend(CeedWriteJitCache(ceed, cache_path, lib_buffer, lib_size));
+    CeedCallBackend(CeedFree(&lib_buffer));
+  }
+  CeedCallBackend(CeedFree(&cache_path));
+
+  // Clean up, the shared object stays mapped after unlinking
+  remove(source_path);
+  remove(lib_path);
+  remove(log_path);
+  rmdir(dir);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get kernel from compiled shared object
+//------------------------------------------------------------------------------
+int CeedGetKernelCpuGen(Ceed ceed, void *module, const char *name, void **kernel) {
+  *kernel = dlsym(module, name);
+  if (!*kernel) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "Could not find CPU kernel %s: %s", name, dlerror());
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,466 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <ceed/jit-tools.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ceed-cpu-gen-operator-build.h"
+#include "ceed-cpu-gen.h"
+
+//------------------------------------------------------------------------------
+// Append formatted text to code buffer
+//------------------------------------------------------------------------------
+static int CeedCpuGenAppend(Ceed ceed, char **code, const char *format, ...) {
+  va_list args;
+  size_t  code_len = *code ? strlen(*code) : 0;
+
+  va_start(args, format);
+  const int append_len = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  CeedCallBackend(CeedRealloc(code_len + append_len + 1, code));
+  va_start(args, format);
+  vsnprintf(&(*code)[code_len], append_len + 1, format, args);
+  va_end(args);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Check if operator can be fused by the code generator
+//------------------------------------------------------------------------------
+static int CeedOperatorCheckSupport_CpuGen(CeedOperator op, bool *is_supported) {
+  CeedQFunction       qf;
+  CeedInt             num_input_fields, num_output_fields;
+  CeedOperatorField  *op_fields[2];
+  CeedQFunctionField *qf_fields[2];
+  char               *source_path;
+  *is_supported = false;
+
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetSourcePath(qf, &source_path));
+  if (!source_path) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_fields[0], &num_output_fields, &op_fields[1]));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields[0], NULL, &qf_fields[1]));
+
+  for (CeedInt k = 0; k < 2; k++) {
+    for (CeedInt i = 0; i < (k ? num_output_fields : num_input_fields); i++) {
+      CeedEvalMode eval_mode;
+      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[k][i], &eval_mode));
+      if (eval_mode == CEED_EVAL_DIV || eval_mode == CEED_EVAL_CURL) return CEED_ERROR_SUCCESS;
+      if (eval_mode != CEED_EVAL_WEIGHT) {
+        bool                is_oriented, has_offsets_64;
+        CeedElemRestriction rstr;
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[k][i], &rstr));
+        CeedCallBackend(CeedElemRestrictionIsOriented(rstr, &is_oriented));
+        if (is_oriented) return CEED_ERROR_SUCCESS;
+        CeedCallBackend(CeedElemRestrictionHasOffsets64(rstr, &has_offsets_64));
+        if (has_offsets_64) return CEED_ERROR_SUCCESS;
+      }
+      if (eval_mode != CEED_EVAL_NONE) {
+        CeedInt   q_comp;
+        CeedBasis basis;
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[k][i], &basis));
+        CeedCallBackend(CeedBasisGetNumQuadratureComponents(basis, &q_comp));
+        if (q_comp != 1) return CEED_ERROR_SUCCESS;
+      }
+    }
+  }
+  *is_supported = true;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create operator on the delegate Ceed for operators the code generator does not support
+//------------------------------------------------------------------------------
+static int CeedOperatorCreateDelegate_CpuGen(CeedOperator op) {
+  Ceed                 ceed, ceed_delegate;
+  CeedQFunction        qf;
+  CeedInt              num_input_fields, num_output_fields;
+  CeedOperatorField   *op_input_fields, *op_output_fields;
+  CeedOperator_CpuGen *impl;
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetDelegate(ceed, &ceed_delegate));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedDebug256(ceed, 1, "---------- CPU code generation not supported, using delegate operator ----------\n");
+
+  CeedCallBackend(CeedOperatorCreate(ceed_delegate, qf, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &impl->op_delegate));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedOperatorField   op_field = i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    char               *field_name;
+    CeedElemRestriction rstr;
+    CeedBasis           basis;
+    CeedVector          vec;
+    CeedCallBackend(CeedOperatorFieldGetName(op_field, &field_name));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &rstr));
+    CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_field, &vec));
+    CeedCallBackend(CeedOperatorSetField(impl->op_delegate, field_name, rstr, basis, vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restriction code for a field
+//   The element block E-vector is addressed as e_vec[comp * e_comp_stride + node * blk_size + e]
+//------------------------------------------------------------------------------
+static int CeedCpuGenRestrictionCode(Ceed ceed, CeedElemRestriction rstr, bool is_input, CeedInt field, CeedInt field_index, CeedInt blk_size,
+                                     const char *e_vec, CeedInt e_comp_stride, char **code) {
+  bool    is_strided;
+  CeedInt num_comp, elem_size;
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionIsStrided(rstr, &is_strided));
+
+  if (is_strided) {
+    bool    has_backend_strides;
+    CeedInt strides[3];
+    CeedCallBackend(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+    if (has_backend_strides) {
+      // CPU backend strides are {1, elem_size, elem_size*num_comp}
+      strides[0] = 1;
+      strides[1] = elem_size;
+      strides[2] = elem_size * num_comp;
+    } else {
+      CeedCallBackend(CeedElemRestrictionGetStrides(rstr, &strides));
+    }
+    if (is_input) {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    readDofsStrided(%d, %d, %d, %d, %d, %d, elem_stop, e_start, inputs[%d], %s, %d);\n",
+                                       num_comp, elem_size, blk_size, strides[0], strides[1], strides[2], field, e_vec, e_comp_stride));
+    } else {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    writeDofsStrided(%d, %d, %d, %d, %d, %d, elem_stop, e_start, %s, %d, outputs[%d]);\n",
+                                       num_comp, elem_size, blk_size, strides[0], strides[1], strides[2], e_vec, e_comp_stride, field));
+    }
+  } else {
+    CeedInt comp_stride;
+    CeedCallBackend(CeedElemRestrictionGetCompStride(rstr, &comp_stride));
+    if (is_input) {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    readDofsOffset(%d, %d, %d, %d, elem_stop, e_start, indices[%d], inputs[%d], %s, %d);\n",
+                                       num_comp, comp_stride, elem_size, blk_size, field_index, field, e_vec, e_comp_stride));
+    } else {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    writeDofsOffset(%d, %d, %d, %d, elem_stop, e_start, indices[%d], %s, %d, outputs[%d]);\n",
+                                       num_comp, comp_stride, elem_size, blk_size, field_index, e_vec, e_comp_stride, field));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis code for a field
+//------------------------------------------------------------------------------
+static int CeedCpuGenBasisCode(Ceed ceed, CeedBasis basis, CeedEvalMode eval_mode, bool is_input, CeedInt field_index, CeedInt blk_size,
+                               const char *q_vec, char **code) {
+  bool    is_tensor;
+  CeedInt dim, num_comp;
+  char    u[32], v[32];
+  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  snprintf(u, sizeof(u), "%s", is_input ? "r_e" : q_vec);
+  snprintf(v, sizeof(v), "%s", is_input ? q_vec : "r_e");
+
+  if (is_tensor) {
+    CeedInt     P_1d, Q_1d;
+    const char *kernel = eval_mode == CEED_EVAL_INTERP ? (is_input ? "interpTensor" : "interpTransposeTensor")
+                                                       : (is_input ? "gradTensor" : "gradTransposeTensor");
+    char        G[16] = "";
+    CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+    if (eval_mode == CEED_EVAL_GRAD) snprintf(G, sizeof(G), "G[%d], ", field_index);
+    CeedCallBackend(CeedCpuGenAppend(ceed, code, "    %s(%d, %d, %d, %d, %d, B[%d], %s%s, %s, r_t0, r_t1);\n", kernel, dim, num_comp, P_1d, Q_1d,
+                                     blk_size, field_index, G, u, v));
+  } else {
+    CeedInt P, Q;
+    CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &Q));
+    if (eval_mode == CEED_EVAL_INTERP) {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    %s(%d, %d, %d, %d, B[%d], %s, %s);\n", is_input ? "interpNonTensor" : "interpTransposeNonTensor",
+                                       num_comp, P, Q, blk_size, field_index, u, v));
+    } else {
+      CeedCallBackend(CeedCpuGenAppend(ceed, code, "    %s(%d, %d, %d, %d, %d, G[%d], %s, %s);\n", is_input ? "gradNonTensor" : "gradTransposeNonTensor",
+                                       dim, num_comp, P, Q, blk_size, field_index, u, v));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Generate, compile, and load fused operator kernel
+//------------------------------------------------------------------------------
+static int CeedCpuGenOperatorBuildKernel(CeedOperator op) {
+  Ceed                 ceed;
+  Ceed_CpuGen         *ceed_data;
+  CeedOperator_CpuGen *impl;
+  CeedQFunction        qf;
+  CeedInt              Q, num_input_fields, num_output_fields;
+  CeedOperatorField   *op_input_fields, *op_output_fields;
+  CeedQFunctionField  *qf_input_fields, *qf_output_fields;
+  char                *qf_name, *code = NULL;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedGetData(ceed, &ceed_data));
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetKernelName(qf, &qf_name));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  const CeedInt blk_size = ceed_data->blk_size;
+
+  // Work array layout, interleaved by element within each block: element block E-vector, two tensor contraction buffers, then element block Q-vectors
+  CeedSize e_size = 0, t_size = 0, work_size;
+  CeedSize q_offsets[2 * CEED_FIELD_MAX];
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedOperatorField  op_field = i < num_input_fields ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field = i < num_input_fields ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedEvalMode       eval_mode;
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode));
+    if (eval_mode == CEED_EVAL_INTERP || eval_mode == CEED_EVAL_GRAD) {
+      bool      is_tensor;
+      CeedInt   dim, num_comp, P, P_1d, Q_1d;
+      CeedBasis basis;
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+      CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+      CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
+      e_size = CeedIntMax(e_size, num_comp * P * blk_size);
+      CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+      if (is_tensor) {
+        CeedInt max_size = 1;
+        CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+        CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+        CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+        for (CeedInt d = 0; d < dim; d++) max_size *= CeedIntMax(P_1d, Q_1d);
+        t_size = CeedIntMax(t_size, max_size * blk_size);
+      }
+    }
+  }
+  work_size = e_size + 2 * t_size;
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    CeedQFunctionField qf_field = i < num_input_fields ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedInt            size;
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &size));
+    q_offsets[i] = work_size;
+    work_size += (CeedSize)size * Q * blk_size;
+  }
+
+  // Standard headers for the QFunction source, system #include lines are not kept when the source is loaded
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code,
+                                   "#include <math.h>\n#include <stdbool.h>\n#include <stddef.h>\n#include <stdint.h>\n#include <stdlib.h>\n"
+                                   "#include <string.h>\n\n"));
+
+  // Load template source
+  {
+    char *templates_path, *templates_source;
+    CeedCallBackend(CeedGetJitAbsolutePath(ceed, "ceed/jit-source/cpu/cpu-gen-templates.h", &templates_path));
+    CeedDebug256(ceed, 2, "----- Loading CPU-Gen Template Source -----\n");
+    CeedCallBackend(CeedLoadSourceToBuffer(ceed, templates_path, &templates_source));
+    CeedCallBackend(CeedCpuGenAppend(ceed, &code, "%s\n", templates_source));
+    CeedCallBackend(CeedFree(&templates_path));
+    CeedCallBackend(CeedFree(&templates_source));
+  }
+
+  // Load QFunction source
+  {
+    char *qf_source;
+    CeedDebug256(ceed, 2, "----- Loading QFunction User Source -----\n");
+    CeedCallBackend(CeedQFunctionLoadSourceToBuffer(qf, &qf_source));
+    CeedCallBackend(CeedCpuGenAppend(ceed, &code, "%s\n", qf_source));
+    CeedCallBackend(CeedFree(&qf_source));
+  }
+
+  // Kernel signature
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code,
+                                   "\n// -----------------------------------------------------------------------------\n"
+                                   "// Fused operator kernel\n"
+                                   "// -----------------------------------------------------------------------------\n"
+                                   "int CeedKernelCpuGenOperator_%s(CeedInt elem_start, CeedInt elem_stop, void *ctx, const CeedScalar *const *inputs, "
+                                   "CeedScalar *const *outputs, const CeedInt *const *indices, const CeedScalar *const *B, const CeedScalar *const *G, "
+                                   "const CeedScalar *const *W, CeedScalar *work) {\n",
+                                   qf_name));
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  const CeedInt Q = %d, blk_size = %d;\n", Q, blk_size));
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  CeedScalar *r_e = &work[0], *r_t0 = &work[%lld], *r_t1 = &work[%lld];\n", (long long)e_size,
+                                   (long long)(e_size + t_size)));
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  const CeedScalar *qf_in[%d];\n  CeedScalar *qf_out[%d];\n", CEED_FIELD_MAX, CEED_FIELD_MAX));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  CeedScalar *q_in_%d = &work[%lld];\n  qf_in[%d] = q_in_%d;\n", i, (long long)q_offsets[i], i, i));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  CeedScalar *q_out_%d = &work[%lld];\n  qf_out[%d] = q_out_%d;\n", i,
+                                     (long long)q_offsets[num_input_fields + i], i, i));
+  }
+
+  // Quadrature weights are the same for every element block
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedCpuGenAppend(ceed, &code,
+                                       "  for (CeedInt q = 0; q < Q; q++) {\n"
+                                       "    for (CeedInt e = 0; e < blk_size; e++) q_in_%d[q * blk_size + e] = W[%d][q];\n"
+                                       "  }\n",
+                                       i, i));
+    }
+  }
+
+  // Loop over element blocks
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code,
+                                   "\n  for (CeedInt e_start = elem_start; e_start < elem_stop; e_start += blk_size) {\n"
+                                   "    // Restriction and basis action for input fields\n"));
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedEvalMode        eval_mode;
+    CeedElemRestriction rstr;
+    CeedBasis           basis;
+    char                q_vec[32];
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    snprintf(q_vec, sizeof(q_vec), "q_in_%d", i);
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+        CeedCallBackend(CeedCpuGenRestrictionCode(ceed, rstr, true, i, i, blk_size, q_vec, Q * blk_size, &code));
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD: {
+        CeedInt elem_size;
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+        CeedCallBackend(CeedCpuGenRestrictionCode(ceed, rstr, true, i, i, blk_size, "r_e", elem_size * blk_size, &code));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
+        CeedCallBackend(CeedCpuGenBasisCode(ceed, basis, eval_mode, true, i, blk_size, q_vec, &code));
+        break;
+      }
+      case CEED_EVAL_WEIGHT:
+        break;  // Set before the element block loop
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        break;  // Not supported
+    }
+  }
+
+  // QFunction
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code,
+                                   "\n    // QFunction\n"
+                                   "    const int ierr = %s(ctx, Q * blk_size, qf_in, qf_out);\n"
+                                   "    if (ierr) return ierr;\n\n",
+                                   qf_name));
+
+  // Output fields
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code, "    // Basis action and transpose restriction for output fields\n"));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedEvalMode        eval_mode;
+    CeedElemRestriction rstr;
+    CeedBasis           basis;
+    char                q_vec[32];
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    snprintf(q_vec, sizeof(q_vec), "q_out_%d", i);
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedCpuGenRestrictionCode(ceed, rstr, false, i, CEED_FIELD_MAX + i, blk_size, q_vec, Q * blk_size, &code));
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD: {
+        CeedInt elem_size;
+        CeedCallBackend(CeedElemRestrictionGetElementSize(rstr, &elem_size));
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
+        CeedCallBackend(CeedCpuGenBasisCode(ceed, basis, eval_mode, false, CEED_FIELD_MAX + i, blk_size, q_vec, &code));
+        CeedCallBackend(CeedCpuGenRestrictionCode(ceed, rstr, false, i, CEED_FIELD_MAX + i, blk_size, "r_e", elem_size * blk_size, &code));
+        break;
+      }
+      case CEED_EVAL_WEIGHT:
+        break;  // Should not occur
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        break;  // Not supported
+    }
+  }
+  CeedCallBackend(CeedCpuGenAppend(ceed, &code, "  }\n  return 0;\n}\n"));
+  CeedDebug256(ceed, 2, "----- Generated CPU Operator Source -----\n");
+  CeedDebug(ceed, "%s\n", code);
+
+  // Compile
+  CeedCallBackend(CeedCompileCpuGen(ceed, code, &impl->module));
+  CeedCallBackend(CeedFree(&code));
+  if (!impl->module) {
+    impl->is_supported = false;
+    return CEED_ERROR_SUCCESS;
+  }
+  {
+    char kernel_name[CEED_MAX_RESOURCE_LEN];
+    snprintf(kernel_name, sizeof(kernel_name), "CeedKernelCpuGenOperator_%s", qf_name);
+    CeedCallBackend(CeedGetKernelCpuGen(ceed, impl->module, kernel_name, (void **)&impl->op));
+  }
+
+  // Basis matrices and quadrature weights
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool         is_input    = i < num_input_fields;
+    const CeedInt      field_index = is_input ? i : CEED_FIELD_MAX + i - num_input_fields;
+    CeedOperatorField  op_field    = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field    = is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedEvalMode       eval_mode;
+    CeedBasis          basis;
+    bool               is_tensor;
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &eval_mode));
+    switch (eval_mode) {
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+        CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+        if (is_tensor) {
+          CeedCallBackend(CeedBasisGetInterp1D(basis, &impl->B[field_index]));
+          CeedCallBackend(CeedBasisGetGrad1D(basis, &impl->G[field_index]));
+        } else {
+          CeedCallBackend(CeedBasisGetInterp(basis, &impl->B[field_index]));
+          if (eval_mode == CEED_EVAL_GRAD) CeedCallBackend(CeedBasisGetGrad(basis, &impl->G[field_index]));
+        }
+        break;
+      case CEED_EVAL_WEIGHT: {
+        CeedVector        q_weight;
+        const CeedScalar *q_weight_array;
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &basis));
+        CeedCallBackend(CeedVectorCreate(ceed, Q, &q_weight));
+        CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_weight));
+        CeedCallBackend(CeedMalloc(Q, &impl->W[i]));
+        CeedCallBackend(CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array));
+        memcpy(impl->W[i], q_weight_array, Q * sizeof(CeedScalar));
+        CeedCallBackend(CeedVectorRestoreArrayRead(q_weight, &q_weight_array));
+        CeedCallBackend(CeedVectorDestroy(&q_weight));
+        break;
+      }
+      case CEED_EVAL_NONE:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_CURL:
+        break;
+    }
+  }
+  impl->work_size = work_size;
+  CeedCallBackend(CeedCalloc(work_size, &impl->work));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Build fused operator kernel, or the delegate operator if the operator is not supported
+//------------------------------------------------------------------------------
+int CeedCpuGenOperatorBuild(CeedOperator op) {
+  bool is_setup_done;
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+
+  CeedOperator_CpuGen *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedCallBackend(CeedOperatorCheckSupport_CpuGen(op, &impl->is_supported));
+  if (impl->is_supported) CeedCallBackend(CeedCpuGenOperatorBuildKernel(op));
+  if (!impl->is_supported) CeedCallBackend(CeedOperatorCreateDelegate_CpuGen(op));
+
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,13 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#ifndef _ceed_cpu_gen_operator_build_h
+#define _ceed_cpu_gen_operator_build_h
+
+CEED_INTERN int CeedCpuGenOperatorBuild(CeedOperator op);
+
+#endif  // _ceed_cpu_gen_operator_build_h
@@ -0,0 +1,281 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <dlfcn.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "ceed-cpu-gen-operator-build.h"
+#include "ceed-cpu-gen.h"
+
+//------------------------------------------------------------------------------
+// Destroy operator
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_CpuGen(CeedOperator op) {
+  CeedOperator_CpuGen *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  if (impl->module) dlclose(impl->module);
+  CeedCallBackend(CeedOperatorDestroy(&impl->op_delegate));
+  for (CeedInt i = 0; i < CEED_FIELD_MAX; i++) CeedCallBackend(CeedFree(&impl->W[i]));
+  CeedCallBackend(CeedFree(&impl->work));
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get input and output arrays and restriction offsets
+//   Outputs sharing a vector share an array, arrays and offsets that were not acquired are left NULL
+//------------------------------------------------------------------------------
+static int CeedOperatorGetArrays_CpuGen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, const CeedScalar **inputs,
+                                        CeedScalar **outputs, const CeedInt **indices) {
+  CeedQFunction       qf;
+  CeedInt             num_input_fields, num_output_fields;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedEvalMode        eval_mode;
+  CeedElemRestriction rstr;
+  CeedVector          vec, output_vecs[CEED_FIELD_MAX] = {NULL};
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+
+  // Input vectors and offsets
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
+      inputs[i] = NULL;
+    } else {
+      bool is_strided;
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) vec = input_vec;
+      CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &inputs[i]));
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+      CeedCallBackend(CeedElemRestrictionIsStrided(rstr, &is_strided));
+      if (!is_strided) CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &indices[i]));
+    }
+  }
+
+  // Output vectors and offsets
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    bool is_strided;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) vec = output_vec;
+    output_vecs[i] = vec;
+    // Check for multiple output modes
+    CeedInt index = -1;
+    for (CeedInt j = 0; j < i; j++) {
+      if (vec == output_vecs[j]) {
+        index = j;
+        break;
+      }
+    }
+    if (index == -1) {
+      CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &outputs[i]));
+    } else {
+      outputs[i] = outputs[index];
+    }
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    CeedCallBackend(CeedElemRestrictionIsStrided(rstr, &is_strided));
+    if (!is_strided) CeedCallBackend(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &indices[CEED_FIELD_MAX + i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restore input and output arrays and restriction offsets
+//------------------------------------------------------------------------------
+static int CeedOperatorRestoreArrays_CpuGen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, const CeedScalar **inputs,
+                                            CeedScalar **outputs, const CeedInt **indices) {
+  CeedInt             num_input_fields, num_output_fields;
+  CeedOperatorField  *op_input_fields, *op_output_fields;
+  CeedElemRestriction rstr;
+  CeedVector          vec, output_vecs[CEED_FIELD_MAX] = {NULL};
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+
+  // Restore input arrays and offsets
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) vec = input_vec;
+    if (inputs[i]) CeedCallBackend(CeedVectorRestoreArrayRead(vec, &inputs[i]));
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &rstr));
+    if (indices[i]) CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &indices[i]));
+  }
+
+  // Restore output arrays and offsets
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) vec = output_vec;
+    output_vecs[i] = vec;
+    // Check for multiple output modes
+    CeedInt index = -1;
+    for (CeedInt j = 0; j < i; j++) {
+      if (output_vecs[i] == output_vecs[j]) {
+        index = j;
+        break;
+      }
+    }
+    if (index == -1 && outputs[i]) {
+      CeedCallBackend(CeedVectorRestoreArray(output_vecs[i], &outputs[i]));
+    }
+    outputs[i] = NULL;
+    CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &rstr));
+    if (indices[CEED_FIELD_MAX + i]) CeedCallBackend(CeedElemRestrictionRestoreOffsets(rstr, &indices[CEED_FIELD_MAX + i]));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_CpuGen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, CeedRequest *request) {
+  CeedOperator_CpuGen *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  // Creation of the operator
+  CeedCallBackend(CeedCpuGenOperatorBuild(op));
+  if (!impl->is_supported) {
+    CeedCallBackend(CeedOperatorApplyAdd(impl->op_delegate, input_vec, output_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  CeedQFunction qf;
+  CeedInt       num_elem;
+  void         *ctx = NULL;
+  int           ierr, ierr_restore;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+
+  // Input and output arrays and offsets
+  ierr = CeedOperatorGetArrays_CpuGen(op, input_vec, output_vec, impl->inputs, impl->outputs, impl->indices);
+
+  // Apply operator
+  if (ierr == CEED_ERROR_SUCCESS) ierr = CeedQFunctionGetInnerContextData(qf, CEED_MEM_HOST, &ctx);
+  if (ierr == CEED_ERROR_SUCCESS) {
+    ierr = impl->op(0, num_elem, ctx, impl->inputs, impl->outputs, impl->indices, impl->B, impl->G, (const CeedScalar *const *)impl->W, impl->work);
+  }
+  if (ctx) CeedCallBackend(CeedQFunctionRestoreInnerContextData(qf, &ctx));
+
+  // Restore arrays and offsets, also after a failed application
+  ierr_restore = CeedOperatorRestoreArrays_CpuGen(op, input_vec, output_vec, impl->inputs, impl->outputs, impl->indices);
+  CeedCallBackend(ierr);
+  CeedCallBackend(ierr_restore);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get arrays for a range application, called with the thread lock held
+//   The context is read only, so concurrent range applications share it
+//------------------------------------------------------------------------------
+static int CeedOperatorGetRangeArrays_CpuGen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, const CeedScalar **inputs,
+                                             CeedScalar **outputs, const CeedInt **indices, void **ctx_data) {
+  CeedQFunction        qf;
+  CeedQFunctionContext ctx;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetInnerContext(qf, &ctx));
+
+  CeedCallBackend(CeedOperatorGetArrays_CpuGen(op, input_vec, output_vec, inputs, outputs, indices));
+  if (ctx) CeedCallBackend(CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, ctx_data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restore arrays for a range application, called with the thread lock held
+//------------------------------------------------------------------------------
+static int CeedOperatorRestoreRangeArrays_CpuGen(CeedOperator op, CeedVector input_vec, CeedVector output_vec, const CeedScalar **inputs,
+                                                 CeedScalar **outputs, const CeedInt **indices, void **ctx_data) {
+  CeedQFunction        qf;
+  CeedQFunctionContext ctx;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetInnerContext(qf, &ctx));
+
+  if (*ctx_data) CeedCallBackend(CeedQFunctionContextRestoreDataRead(ctx, ctx_data));
+  CeedCallBackend(CeedOperatorRestoreArrays_CpuGen(op, input_vec, output_vec, inputs, outputs, indices));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply and add to output on a range of elements
+//   Each call uses its own arrays and work space, so range applications into different output vectors run concurrently.
+//   Operators with passive outputs hold the thread lock for the whole application.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_CpuGen(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector input_vec, CeedVector output_vec,
+                                            CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_CpuGen *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  int ierr;
+
+  // Creation of the operator
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedCpuGenOperatorBuild(op);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  if (!impl->is_supported) {
+    CeedCallBackend(CeedOperatorApplyAddRange(impl->op_delegate, elem_start, elem_stop, input_vec, output_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  bool               has_passive_out = false;
+  CeedInt            num_output_fields;
+  CeedOperatorField *op_output_fields;
+  CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, &num_output_fields, &op_output_fields));
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedVector vec;
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE) has_passive_out = true;
+  }
+
+  const CeedScalar *inputs[CEED_FIELD_MAX]      = {NULL};
+  CeedScalar       *outputs[CEED_FIELD_MAX]     = {NULL};
+  const CeedInt    *indices[2 * CEED_FIELD_MAX] = {NULL};
+  CeedScalar       *work                        = NULL;
+  void             *ctx_data                    = NULL;
+  int               ierr_restore;
+
+  // Acquire arrays, passive outputs are shared by all range applications
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorGetRangeArrays_CpuGen(op, input_vec, output_vec, inputs, outputs, indices, &ctx_data);
+  if (ierr == CEED_ERROR_SUCCESS) ierr = CeedCalloc(impl->work_size, &work);
+  if (!has_passive_out) CeedCallBackend(CeedThreadUnlock(ceed));
+
+  // Apply operator
+  if (ierr == CEED_ERROR_SUCCESS) {
+    ierr = impl->op(elem_start, elem_stop, ctx_data, inputs, outputs, indices, impl->B, impl->G, (const CeedScalar *const *)impl->W, work);
+  }
+
+  // Restore arrays
+  if (!has_passive_out) CeedCallBackend(CeedThreadLock(ceed));
+  ierr_restore = CeedOperatorRestoreRangeArrays_CpuGen(op, input_vec, output_vec, inputs, outputs, indices, &ctx_data);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(CeedFree(&work));
+  CeedCallBackend(ierr);
+  CeedCallBackend(ierr_restore);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create operator
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_CpuGen(CeedOperator op) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_CpuGen *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_CpuGen));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange", CeedOperatorApplyAddRange_CpuGen));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_CpuGen));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -0,0 +1,74 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include "ceed-cpu-gen.h"
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdio.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_CpuGen(Ceed ceed) {
+  Ceed_CpuGen *data;
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data->compiler_id));
+  CeedCallBackend(CeedFree(&data));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_CpuGen(const char *resource, Ceed ceed) {
+  char *resource_root;
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  if (strcmp(resource_root, "/cpu/self") && strcmp(resource_root, "/cpu/self/gen")) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "CPU code generation backend cannot use resource: %s", resource);
+    // LCOV_EXCL_STOP
+  }
+  CeedCallBackend(CeedFree(&resource_root));
+
+  // Block size may be selected with the resource option ":blk_size=N"
+  CeedInt blk_size;
+  CeedCallBackend(CeedGetResourceBlockSize(ceed, resource, 8, &blk_size));
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create optimized Ceed that implementation will be dispatched through unless overridden
+  //   Backend options, such as ":blk_size=N", are forwarded to the delegate
+  Ceed        ceed_opt;
+  const char *options = strchr(resource, ':');
+  char        delegate_resource[CEED_MAX_RESOURCE_LEN];
+  snprintf(delegate_resource, sizeof(delegate_resource), "/cpu/self/opt/blocked%s", options ? options : "");
+  CeedCallBackend(CeedInit(delegate_resource, &ceed_opt));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_opt));
+
+  // Set fallback Ceed resource for advanced operator functionality
+  const char fallbackresource[] = "/cpu/self/ref/serial";
+  CeedCallBackend(CeedSetOperatorFallbackResource(ceed, fallbackresource));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_CpuGen));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_CpuGen));
+
+  // Set blocksize
+  Ceed_CpuGen *data;
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->blk_size = blk_size;
+  CeedCallBackend(CeedSetData(ceed, data));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Cpu_Gen(void) { return CeedRegister("/cpu/self/gen", CeedInit_CpuGen, 70); }
+//------------------------------------------------------------------------------
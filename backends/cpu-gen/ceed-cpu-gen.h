@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#ifndef _ceed_cpu_gen_h
+#define _ceed_cpu_gen_h
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+
+typedef struct {
+  CeedInt blk_size;
+  char   *compiler_id; /* Host compiler identity for the JiT cache, set on first compile */
+} Ceed_CpuGen;
+
+typedef int (*CeedKernelCpuGen)(CeedInt elem_start, CeedInt elem_stop, void *ctx, const CeedScalar *const *inputs, CeedScalar *const *outputs,
+                                const CeedInt *const *indices, const CeedScalar *const *B, const CeedScalar *const *G, const CeedScalar *const *W,
+                                CeedScalar *work);
+
+typedef struct {
+  bool              is_supported; /* False if the operator is applied by op_delegate */
+  void             *module;       /* Handle of the compiled shared object */
+  CeedKernelCpuGen  op;
+  CeedOperator      op_delegate; /* Operator on the delegate Ceed, for unsupported operators */
+  const CeedInt    *indices[2 * CEED_FIELD_MAX]; /* Restriction offsets, inputs followed by outputs */
+  const CeedScalar *B[2 * CEED_FIELD_MAX];       /* Interpolation matrices, inputs followed by outputs */
+  const CeedScalar *G[2 * CEED_FIELD_MAX];       /* Gradient matrices, inputs followed by outputs */
+  CeedScalar       *W[CEED_FIELD_MAX];           /* Quadrature weights of input fields */
+  CeedScalar       *work;                        /* Element block work array */
+  CeedSize          work_size;                   /* Size of the element block work array */
+  const CeedScalar *inputs[CEED_FIELD_MAX];
+  CeedScalar       *outputs[CEED_FIELD_MAX];
+} CeedOperator_CpuGen;
+
+CEED_INTERN int CeedCompileCpuGen(Ceed ceed, const char *source, void **module);
+
+CEED_INTERN int CeedGetKernelCpuGen(Ceed ceed, void *module, const char *name, void **kernel);
+
+CEED_INTERN int CeedOperatorCreate_CpuGen(CeedOperator op);
+
+#endif  // _ceed_cpu_gen_h
@@ -79,26 +79,41 @@ int CeedCompileCuda(Ceed ceed, const char *source, CUmodule *module, const CeedI
   // Add string source argument provided in call
   code << source;
 
-  // Create Program
-  CeedCallNvrtc(ceed, nvrtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
-
-  // Compile kernel
-  nvrtcResult result = nvrtcCompileProgram(prog, num_opts, opts);
-  if (result != NVRTC_SUCCESS) {
-    size_t log_size;
-    CeedCallNvrtc(ceed, nvrtcGetProgramLogSize(prog, &log_size));
-    char *log;
-    CeedCallBackend(CeedMalloc(log_size, &log));
-    CeedCallNvrtc(ceed, nvrtcGetProgramLog(prog, log));
-    return CeedError(ceed, CEED_ERROR_BACKEND, "%s\n%s", nvrtcGetErrorString(result), log);
-  }
-
+  // Check JiT cache, keyed on the full source, options, and NVRTC version
+  int major, minor;
+  CeedCallNvrtc(ceed, nvrtcVersion(&major, &minor));
+  std::string compiler_id = "nvrtc " + std::to_string(major) + "." + std::to_string(minor);
+  std::string options;
+  for (int i = 0; i < num_opts; i++) options += std::string(opts[i]) + " ";
+  char  *cache_path, *ptx;
   size_t ptx_size;
-  CeedCallNvrtc(ceed, nvrtcGetPTXSize(prog, &ptx_size));
-  char *ptx;
-  CeedCallBackend(CeedMalloc(ptx_size, &ptx));
-  CeedCallNvrtc(ceed, nvrtcGetPTX(prog, ptx));
-  CeedCallNvrtc(ceed, nvrtcDestroyProgram(&prog));
+  CeedCallBackend(CeedGetJitCachePath(ceed, code.str().c_str(), options.c_str(), compiler_id.c_str(), ".ptx", &cache_path));
+  CeedCallBackend(CeedReadJitCache(ceed, cache_path, &ptx, &ptx_size));
+
+  if (!ptx) {
+    // Create Program
+    CeedCallNvrtc(ceed, nvrtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
+
+    // Compile kernel
+    nvrtcResult result = nvrtcCompileProgram(prog, num_opts, opts);
+    if (result != NVRTC_SUCCESS) {
+      size_t log_size;
+      CeedCallNvrtc(ceed, nvrtcGetProgramLogSize(prog, &log_size));
+      char *log;
+      CeedCallBackend(CeedMalloc(log_size, &log));
+      CeedCallNvrtc(ceed, nvrtcGetProgramLog(prog, log));
+      CeedCallBackend(CeedFree(&cache_path));
+      return CeedError(ceed, CEED_ERROR_BACKEND, "%s\n%s", nvrtcGetErrorString(result), log);
+    }
+
+    CeedCallNvrtc(ceed, nvrtcGetPTXSize(prog, &ptx_size));
+    CeedCallBackend(CeedMalloc(ptx_size, &ptx));
+    CeedCallNvrtc(ceed, nvrtcGetPTX(prog, ptx));
+    CeedCallNvrtc(ceed, nvrtcDestroyProgram(&prog));
+
+    CeedCallBackend(CeedWriteJitCache(ceed, cache_path, ptx, ptx_size));
+  }
+  CeedCallBackend(CeedFree(&cache_path));
 
   CeedCallCuda(ceed, cuModuleLoadData(module, ptx));
   CeedCallBackend(CeedFree(&ptx));
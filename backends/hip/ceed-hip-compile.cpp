@@ -90,26 +90,39 @@ int CeedCompileHip(Ceed ceed, const char *source, hipModule_t *module, const Cee
   // Add string source argument provided in call
   code << source;
 
-  // Create Program
-  CeedCallHiprtc(ceed, hiprtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
-
-  // Compile kernel
-  hiprtcResult result = hiprtcCompileProgram(prog, num_opts, opts);
-  if (result != HIPRTC_SUCCESS) {
-    size_t log_size;
-    CeedChk_hiprtc(ceed, hiprtcGetProgramLogSize(prog, &log_size));
-    char *log;
-    CeedCallBackend(CeedMalloc(log_size, &log));
-    CeedCallHiprtc(ceed, hiprtcGetProgramLog(prog, log));
-    return CeedError(ceed, CEED_ERROR_BACKEND, "%s\n%s", hiprtcGetErrorString(result), log);
-  }
-
+  // Check JiT cache, keyed on the full source, options, and HIP runtime version
+  std::string compiler_id = "hiprtc " + std::to_string(runtime_version);
+  std::string options;
+  for (int i = 0; i < num_opts; i++) options += std::string(opts[i]) + " ";
+  char  *cache_path, *ptx;
   size_t ptx_size;
-  CeedCallHiprtc(ceed, hiprtcGetCodeSize(prog, &ptx_size));
-  char *ptx;
-  CeedCallBackend(CeedMalloc(ptx_size, &ptx));
-  CeedCallHiprtc(ceed, hiprtcGetCode(prog, ptx));
-  CeedCallHiprtc(ceed, hiprtcDestroyProgram(&prog));
+  CeedCallBackend(CeedGetJitCachePath(ceed, code.str().c_str(), options.c_str(), compiler_id.c_str(), ".hsaco", &cache_path));
+  CeedCallBackend(CeedReadJitCache(ceed, cache_path, &ptx, &ptx_size));
+
+  if (!ptx) {
+    // Create Program
+    CeedCallHiprtc(ceed, hiprtcCreateProgram(&prog, code.str().c_str(), NULL, 0, NULL, NULL));
+
+    // Compile kernel
+    hiprtcResult result = hiprtcCompileProgram(prog, num_opts, opts);
+    if (result != HIPRTC_SUCCESS) {
+      size_t log_size;
+      CeedChk_hiprtc(ceed, hiprtcGetProgramLogSize(prog, &log_size));
+      char *log;
+      CeedCallBackend(CeedMalloc(log_size, &log));
+      CeedCallHiprtc(ceed, hiprtcGetProgramLog(prog, log));
+      CeedCallBackend(CeedFree(&cache_path));
+      return CeedError(ceed, CEED_ERROR_BACKEND, "%s\n%s", hiprtcGetErrorString(result), log);
+    }
+
+    CeedCallHiprtc(ceed, hiprtcGetCodeSize(prog, &ptx_size));
+    CeedCallBackend(CeedMalloc(ptx_size, &ptx));
+    CeedCallHiprtc(ceed, hiprtcGetCode(prog, ptx));
+    CeedCallHiprtc(ceed, hiprtcDestroyProgram(&prog));
+
+    CeedCallBackend(CeedWriteJitCache(ceed, cache_path, ptx, ptx_size));
+  }
+  CeedCallBackend(CeedFree(&cache_path));
 
   CeedCallHip(ceed, hipModuleLoadData(module, ptx));
   CeedCallBackend(CeedFree(&ptx));
@@ -75,7 +75,7 @@ static int CeedVectorSetArray_Memcheck(CeedVector vec, CeedMemType mem_type, Cee
       if (array) {
         memcpy(impl->array, array, length * sizeof(array[0]));
       } else {
-        for (CeedInt i = 0; i < length; i++) impl->array[i] = NAN;
+        for (CeedSize i = 0; i < length; i++) impl->array[i] = NAN;
       }
       break;
     case CEED_OWN_POINTER:
@@ -175,7 +175,7 @@ static int CeedVectorGetArrayWrite_Memcheck(CeedVector vec, CeedMemType mem_type
   // Invalidate data to make sure no read occurs
   if (!impl->array) CeedCallBackend(CeedVectorSetArray_Memcheck(vec, mem_type, CEED_COPY_VALUES, NULL));
   CeedCallBackend(CeedVectorGetArray_Memcheck(vec, mem_type, array));
-  for (CeedInt i = 0; i < length; i++) (*array)[i] = NAN;
+  for (CeedSize i = 0; i < length; i++) (*array)[i] = NAN;
 
   return CEED_ERROR_SUCCESS;
 }
@@ -0,0 +1,88 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Backend Destroy
+//------------------------------------------------------------------------------
+static int CeedDestroy_Omp(Ceed ceed) {
+  Ceed_Omp *data;
+  CeedCallBackend(CeedGetData(ceed, &data));
+  CeedCallBackend(CeedFree(&data));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Host Array First Touch
+//   Pages are zeroed with the static schedule of the element block loop, so each page is placed on the NUMA node of the thread that works on it
+//------------------------------------------------------------------------------
+static int CeedHostFirstTouch_Omp(Ceed ceed, void *array, size_t bytes) {
+  const size_t page_size = 4096, num_pages = (bytes + page_size - 1) / page_size;
+  char        *data      = array;
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < num_pages; i++) memset(&data[i * page_size], 0, i + 1 < num_pages ? page_size : bytes - i * page_size);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Init
+//------------------------------------------------------------------------------
+static int CeedInit_Omp_Blocked(const char *resource, Ceed ceed) {
+  char *resource_root;
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  if (strcmp(resource_root, "/cpu/self") && strcmp(resource_root, "/cpu/self/omp") && strcmp(resource_root, "/cpu/self/omp/blocked")) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "OpenMP backend cannot use resource: %s", resource);
+    // LCOV_EXCL_STOP
+  }
+  CeedCallBackend(CeedFree(&resource_root));
+
+  // Block size may be selected with the resource option ":blk_size=N"
+  CeedInt blk_size;
+  CeedCallBackend(CeedGetResourceBlockSize(ceed, resource, 8, &blk_size));
+  CeedCallBackend(CeedSetDeterministic(ceed, true));
+
+  // Create optimized Ceed that implementation will be dispatched through unless overridden
+  //   Backend options, such as ":blk_size=N", are forwarded to the delegate
+  Ceed        ceed_opt;
+  const char *options = strchr(resource, ':');
+  char        delegate_resource[CEED_MAX_RESOURCE_LEN];
+  snprintf(delegate_resource, sizeof(delegate_resource), "/cpu/self/opt/blocked%s", options ? options : "");
+  CeedCallBackend(CeedInit(delegate_resource, &ceed_opt));
+  CeedCallBackend(CeedSetDelegate(ceed, ceed_opt));
+
+  // Set fallback Ceed resource for advanced operator functionality
+  const char fallbackresource[] = "/cpu/self/ref/serial";
+  CeedCallBackend(CeedSetOperatorFallbackResource(ceed, fallbackresource));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "Destroy", CeedDestroy_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "OperatorCreate", CeedOperatorCreate_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Ceed", ceed, "HostFirstTouch", CeedHostFirstTouch_Omp));
+
+  // Set blocksize
+  Ceed_Omp *data;
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->blk_size = blk_size;
+  CeedCallBackend(CeedSetData(ceed, data));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Backend Register
+//------------------------------------------------------------------------------
+CEED_INTERN int CeedRegister_Omp_Blocked(void) { return CeedRegister("/cpu/self/omp/blocked", CeedInit_Omp_Blocked, 60); }
+//------------------------------------------------------------------------------
@@ -0,0 +1,608 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <omp.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../ref/ceed-ref.h"
+#include "ceed-omp.h"
+
+//------------------------------------------------------------------------------
+// Create Thread Copy of Basis
+//   Bases keep scratch space and lazily built matrices in their data, so each thread needs its own copy
+//------------------------------------------------------------------------------
+static int CeedBasisCreateThreadCopy_Omp(CeedBasis basis, CeedBasis *basis_copy) {
+  bool              is_tensor;
+  Ceed              ceed;
+  CeedInt           dim, num_comp;
+  const CeedScalar *q_ref, *q_weight;
+  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+  CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+  CeedCallBackend(CeedBasisGetDimension(basis, &dim));
+  CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCallBackend(CeedBasisGetQRef(basis, &q_ref));
+  CeedCallBackend(CeedBasisGetQWeights(basis, &q_weight));
+
+  if (is_tensor) {
+    CeedInt           P_1d, Q_1d;
+    const CeedScalar *interp_1d, *grad_1d;
+    CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+    CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
+    CeedCallBackend(CeedBasisGetGrad1D(basis, &grad_1d));
+    CeedCallBackend(CeedBasisCreateTensorH1(ceed, dim, num_comp, P_1d, Q_1d, interp_1d, grad_1d, q_ref, q_weight, basis_copy));
+  } else {
+    CeedElemTopology  topo;
+    CeedInt           P, Q, Q_comp;
+    const CeedScalar *interp;
+    CeedCallBackend(CeedBasisGetTopology(basis, &topo));
+    CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints(basis, &Q));
+    CeedCallBackend(CeedBasisGetNumQuadratureComponents(basis, &Q_comp));
+    CeedCallBackend(CeedBasisGetInterp(basis, &interp));
+    if (Q_comp == 1) {
+      const CeedScalar *grad;
+      CeedCallBackend(CeedBasisGetGrad(basis, &grad));
+      CeedCallBackend(CeedBasisCreateH1(ceed, topo, num_comp, P, Q, interp, grad, q_ref, q_weight, basis_copy));
+    } else {
+      const CeedScalar *div;
+      CeedCallBackend(CeedBasisGetDiv(basis, &div));
+      CeedCallBackend(CeedBasisCreateHdiv(ceed, topo, num_comp, P, Q, interp, div, q_ref, q_weight, basis_copy));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input/Output Fields
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupFields_Omp(CeedQFunction qf, CeedOperator op, bool is_input, const CeedInt blk_size, CeedInt start_e, CeedInt num_fields,
+                                       CeedInt Q, CeedOperator_Omp *impl) {
+  CeedInt  num_comp, size, P;
+  CeedSize e_size, q_size;
+  Ceed     ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedBasis           basis;
+  CeedElemRestriction r;
+  CeedOperatorField  *op_fields;
+  CeedQFunctionField *qf_fields;
+  if (is_input) {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, &op_fields, NULL, NULL));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_fields, NULL, NULL));
+  } else {
+    CeedCallBackend(CeedOperatorGetFields(op, NULL, NULL, NULL, &op_fields));
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, NULL, NULL, &qf_fields));
+  }
+
+  // Loop over fields
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedEvalMode eval_mode;
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+
+    // Blocked restriction and full E-vector, shared by all threads
+    if (eval_mode != CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &r));
+      Ceed ceed;
+      CeedCallBackend(CeedElemRestrictionGetCeed(r, &ceed));
+      CeedSize l_size;
+      CeedInt  num_elem, elem_size, comp_stride;
+      CeedCallBackend(CeedElemRestrictionGetNumElements(r, &num_elem));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(r, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetLVectorSize(r, &l_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(r, &num_comp));
+
+      bool strided;
+      CeedCallBackend(CeedElemRestrictionIsStrided(r, &strided));
+      if (strided) {
+        CeedInt strides[3];
+        CeedCallBackend(CeedElemRestrictionGetStrides(r, &strides));
+        CeedCallBackend(
+            CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size, blk_size, num_comp, l_size, strides, &impl->blk_restr[i + start_e]));
+      } else {
+        bool has_offsets_64;
+        CeedCallBackend(CeedElemRestrictionGetCompStride(r, &comp_stride));
+        CeedCallBackend(CeedElemRestrictionHasOffsets64(r, &has_offsets_64));
+        if (has_offsets_64) {
+          const CeedSize *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked64(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                             CEED_COPY_VALUES, offsets, &impl->blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets64(r, &offsets));
+        } else {
+          const CeedInt *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                           CEED_COPY_VALUES, offsets, &impl->blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(r, &offsets));
+        }
+        if (!is_input) CeedCallBackend(CeedElemRestrictionSetupTransposeMap_Ref(impl->blk_restr[i + start_e]));
+      }
+      CeedCallBackend(CeedElemRestrictionCreateVector(impl->blk_restr[i + start_e], NULL, &impl->e_vecs_full[i + start_e]));
+    }
+
+    // Per-thread block E-vectors and Q-vectors
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        break;  // Q-data is read and written in place in the full E-vector
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_fields[i], &size));
+        CeedCallBackend(CeedBasisGetNumNodes(basis, &P));
+        CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
+        e_size = (CeedSize)P * num_comp * blk_size;
+        q_size = (CeedSize)Q * size * blk_size;
+        for (CeedInt t = 0; t < impl->num_threads; t++) {
+          CeedOperatorThread_Omp *thread = &impl->threads[t];
+          CeedCallBackend(CeedBasisCreateThreadCopy_Omp(basis, is_input ? &thread->bases_in[i] : &thread->bases_out[i]));
+          CeedCallBackend(CeedVectorCreate(ceed, e_size, is_input ? &thread->e_vecs_in[i] : &thread->e_vecs_out[i]));
+          CeedCallBackend(CeedVectorCreate(ceed, q_size, is_input ? &thread->q_vecs_in[i] : &thread->q_vecs_out[i]));
+        }
+        break;
+      case CEED_EVAL_WEIGHT:  // Only on input fields
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+        q_size = (CeedSize)Q * blk_size;
+        CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->q_weights[i]));
+        CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, impl->q_weights[i]));
+        break;
+      // LCOV_EXCL_START
+      case CEED_EVAL_CURL:
+        return CeedError(ceed, CEED_ERROR_BACKEND, "Ceed evaluation mode not implemented");
+        // LCOV_EXCL_STOP
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Operator
+//------------------------------------------------------------------------------
+static int CeedOperatorSetup_Omp(CeedOperator op) {
+  bool is_setup_done;
+  CeedCallBackend(CeedOperatorIsSetupDone(op, &is_setup_done));
+  if (is_setup_done) return CEED_ERROR_SUCCESS;
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Omp *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  const CeedInt     blk_size = ceed_impl->blk_size;
+  CeedOperator_Omp *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedQFunction qf;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedInt Q, num_input_fields, num_output_fields, vec_length;
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, NULL, &num_output_fields, NULL));
+  CeedCallBackend(CeedQFunctionGetVectorLength(qf, &vec_length));
+  if ((Q * blk_size) % vec_length) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "Number of quadrature points %" CeedInt_FMT " must be a multiple of %" CeedInt_FMT, Q * blk_size,
+                     vec_length);
+    // LCOV_EXCL_STOP
+  }
+
+  // Identity QFunctions with no basis action only need the restrictions
+  bool is_identity_qf;
+  CeedCallBackend(CeedQFunctionIsIdentity(qf, &is_identity_qf));
+  if (is_identity_qf) {
+    CeedEvalMode        in_mode, out_mode;
+    CeedQFunctionField *in_fields, *out_fields;
+    CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &in_fields, NULL, &out_fields));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(in_fields[0], &in_mode));
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(out_fields[0], &out_mode));
+    impl->is_identity_restr_op = in_mode == CEED_EVAL_NONE && out_mode == CEED_EVAL_NONE;
+  }
+
+  // Allocate
+  impl->num_inputs  = num_input_fields;
+  impl->num_outputs = num_output_fields;
+  impl->num_threads = omp_get_max_threads();
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->blk_restr));
+  CeedCallBackend(CeedCalloc(num_input_fields + num_output_fields, &impl->e_vecs_full));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->input_states));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_weights));
+  CeedCallBackend(CeedCalloc(impl->num_threads, &impl->threads));
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].bases_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].bases_out));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].e_vecs_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].e_vecs_out));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].q_vecs_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->threads[t].q_vecs_out));
+  }
+
+  // Set up infield and outfield vectors
+  // Infields
+  CeedCallBackend(CeedOperatorSetupFields_Omp(qf, op, true, blk_size, 0, num_input_fields, Q, impl));
+  // Outfields
+  CeedCallBackend(CeedOperatorSetupFields_Omp(qf, op, false, blk_size, num_input_fields, num_output_fields, Q, impl));
+
+  CeedCallBackend(CeedOperatorSetSetupDone(op));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Setup Input Fields
+//   Each thread restricts the element blocks it applies the operator to, and error codes are collected outside of the parallel region
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupInputs_Omp(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                              CeedVector in_vec, CeedInt num_blks, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
+                                              CeedOperator_Omp *impl) {
+  CeedEvalMode eval_mode;
+  CeedVector   vec;
+  uint64_t     state;
+
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      // Quadrature weights are the same for every block
+      CeedCallBackend(CeedVectorGetArrayRead(impl->q_weights[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+    } else {
+      // Get input vector
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) vec = in_vec;
+      // Restrict active inputs, and passive inputs only if they have changed
+      CeedCallBackend(CeedVectorGetState(vec, &state));
+      if (vec == in_vec || state != impl->input_states[i]) {
+        const CeedElemRestriction blk_restr = impl->blk_restr[i];
+        const CeedScalar         *l_data;
+        CeedScalar               *e_data;
+        int                       ierr = CEED_ERROR_SUCCESS;
+
+        CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &l_data));
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i], CEED_MEM_HOST, &e_data));
+#pragma omp parallel for schedule(static) num_threads(impl->num_threads)
+        for (CeedInt b = 0; b < num_blks; b++) {
+          int ierr_b = CeedElemRestrictionApplyArrays_Ref(blk_restr, b, b + 1, 0, CEED_NOTRANSPOSE, l_data, e_data);
+          if (ierr_b != CEED_ERROR_SUCCESS) {
+#pragma omp atomic write
+            ierr = ierr_b;
+          }
+        }
+        CeedCallBackend(CeedVectorRestoreArrayRead(vec, &l_data));
+        CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i], &e_data));
+        CeedCallBackend(ierr);
+        if (vec != in_vec) impl->input_states[i] = state;
+      }
+      // Get evec
+      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Operator to a Single Element Block
+//   Only touches the per-thread work vectors and the slice of the full E-vectors
+//   belonging to block b, so blocks can be processed concurrently.
+//   Called inside a parallel region, so failures are returned as error codes without calling the CeedError handler.
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyBlock_Omp(CeedInt b, CeedInt blk_size, CeedInt Q, CeedQFunctionUser f, void *ctx_data,
+                                      CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields, CeedInt num_input_fields,
+                                      CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields, CeedInt num_output_fields,
+                                      CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperatorThread_Omp *thread) {
+  const CeedInt       e = b * blk_size;
+  const CeedScalar   *q_in[CEED_FIELD_MAX]  = {0};
+  CeedScalar         *q_out[CEED_FIELD_MAX] = {0};
+  CeedInt             elem_size, num_comp, size;
+  CeedElemRestriction elem_restr;
+  CeedEvalMode        eval_mode;
+
+  // Input basis apply
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+        q_in[i] = &e_data_full[i][(CeedSize)e * Q * size];
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
+        CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_restr, &num_comp));
+        CeedCallBackend(
+            CeedVectorSetArray(thread->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
+        CeedCallBackend(CeedBasisApply(thread->bases_in[i], blk_size, CEED_NOTRANSPOSE, eval_mode, thread->e_vecs_in[i], thread->q_vecs_in[i]));
+        CeedCallBackend(CeedVectorGetArrayRead(thread->q_vecs_in[i], CEED_MEM_HOST, &q_in[i]));
+        break;
+      case CEED_EVAL_WEIGHT:
+        q_in[i] = e_data_full[i];
+        break;
+      case CEED_EVAL_CURL:
+        return CEED_ERROR_BACKEND;  // LCOV_EXCL_LINE - Rejected during setup
+    }
+  }
+
+  // Output Q-vectors
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_NONE) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      q_out[i] = &e_data_full[i + num_input_fields][(CeedSize)e * Q * size];
+    } else {
+      CeedCallBackend(CeedVectorGetArrayWrite(thread->q_vecs_out[i], CEED_MEM_HOST, &q_out[i]));
+    }
+  }
+
+  // Q function
+  CeedCallBackend(f(ctx_data, Q * blk_size, q_in, q_out));
+
+  // Restore input Q-vectors
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    if (thread->q_vecs_in[i]) CeedCallBackend(CeedVectorRestoreArrayRead(thread->q_vecs_in[i], &q_in[i]));
+  }
+
+  // Output basis apply
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    switch (eval_mode) {
+      case CEED_EVAL_NONE:
+        break;  // No action
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+        CeedCallBackend(CeedVectorRestoreArray(thread->q_vecs_out[i], &q_out[i]));
+        CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr));
+        CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
+        CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_restr, &num_comp));
+        CeedCallBackend(CeedVectorSetArray(thread->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
+        CeedCallBackend(CeedBasisApply(thread->bases_out[i], blk_size, CEED_TRANSPOSE, eval_mode, thread->q_vecs_out[i], thread->e_vecs_out[i]));
+        break;
+      case CEED_EVAL_WEIGHT:
+      case CEED_EVAL_CURL:
+        return CEED_ERROR_BACKEND;  // LCOV_EXCL_LINE - Rejected during setup
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Omp(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Omp *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  const CeedInt     blk_size = ceed_impl->blk_size;
+  CeedOperator_Omp *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  CeedInt Q, num_input_fields, num_output_fields, num_elem;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  const CeedInt num_blks = (num_elem / blk_size) + !!(num_elem % blk_size);
+  CeedQFunction qf;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedEvalMode eval_mode;
+  CeedVector   vec;
+  CeedScalar  *e_data_full[2 * CEED_FIELD_MAX] = {0};
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Omp(op));
+
+  // Restriction only operator
+  if (impl->is_identity_restr_op) {
+    CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[0], CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[1], CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Input Evecs and Restriction
+  CeedCallBackend(CeedOperatorSetupInputs_Omp(num_input_fields, qf_input_fields, op_input_fields, in_vec, num_blks, e_data_full, impl));
+
+  // Output Evecs
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + num_input_fields], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
+  }
+
+  // QFunction user function and context, called directly by each thread
+  CeedQFunctionUser f        = NULL;
+  void             *ctx_data = NULL;
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+
+  // Loop through element blocks
+  //   Bases are applied through the libCEED interface on each thread, so profiling is suspended to avoid racing on the profiling data
+  int ierr = CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedProfileSuspend(ceed));
+#pragma omp parallel num_threads(impl->num_threads)
+  {
+    CeedOperatorThread_Omp *thread = &impl->threads[omp_get_thread_num()];
+
+#pragma omp for schedule(static)
+    for (CeedInt b = 0; b < num_blks; b++) {
+      int ierr_b = CeedOperatorApplyBlock_Omp(b, blk_size, Q, f, ctx_data, qf_input_fields, op_input_fields, num_input_fields, qf_output_fields,
+                                              op_output_fields, num_output_fields, e_data_full, thread);
+      if (ierr_b != CEED_ERROR_SUCCESS) {
+#pragma omp atomic write
+        ierr = ierr_b;
+      }
+    }
+  }
+  CeedCallBackend(CeedProfileResume(ceed));
+  CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+
+  // Restore input arrays
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    if (eval_mode == CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_weights[i], (const CeedScalar **)&e_data_full[i]));
+    } else {
+      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
+    }
+  }
+
+  // Errors from the element blocks are returned after all arrays are restored
+  if (ierr != CEED_ERROR_SUCCESS) {
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + num_input_fields], &e_data_full[i + num_input_fields]));
+    }
+    return ierr;
+  }
+
+  // Output restriction
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedElemRestriction_Ref *t_map;
+    CeedCallBackend(CeedElemRestrictionGetData(impl->blk_restr[i + num_input_fields], &t_map));
+
+    // Get output vector
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) vec = out_vec;
+    if (t_map->t_offsets) {
+      // Restrict, gathering each L-vector node from its E-vector entries on all threads
+      //   Entries are summed in E-vector order, so the result matches the serial transpose restriction
+      //   The gather makes no libCEED calls, so there are no error codes to collect from the threads
+      const CeedScalar *e_data = e_data_full[i + num_input_fields];
+      CeedScalar       *l_data;
+      CeedInt           num_comp, comp_stride, elem_size, blk_size;
+
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(impl->blk_restr[i + num_input_fields], &num_comp));
+      CeedCallBackend(CeedElemRestrictionGetCompStride(impl->blk_restr[i + num_input_fields], &comp_stride));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(impl->blk_restr[i + num_input_fields], &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetBlockSize(impl->blk_restr[i + num_input_fields], &blk_size));
+      const CeedSize e_comp_stride = (CeedSize)blk_size * elem_size;
+
+      CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &l_data));
+#pragma omp parallel for schedule(static) num_threads(impl->num_threads)
+      for (CeedSize n = 0; n < t_map->num_nodes; n++) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          const CeedSize l_index = t_map->l_vec_indices[n] + (CeedSize)k * comp_stride;
+          CeedScalar     value   = l_data[l_index];
+
+          for (CeedSize j = t_map->t_offsets[n]; j < t_map->t_offsets[n + 1]; j++) value += e_data[t_map->t_indices[j] + k * e_comp_stride];
+          l_data[l_index] = value;
+        }
+      }
+      CeedCallBackend(CeedVectorRestoreArray(vec, &l_data));
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + num_input_fields], &e_data_full[i + num_input_fields]));
+    } else {
+      // Restrict, strided restrictions have no shared nodes to sum and are not threaded
+      CeedCallBackend(CeedVectorRestoreArray(impl->e_vecs_full[i + num_input_fields], &e_data_full[i + num_input_fields]));
+      CeedCallBackend(
+          CeedElemRestrictionApply(impl->blk_restr[i + num_input_fields], CEED_TRANSPOSE, impl->e_vecs_full[i + num_input_fields], vec, request));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Range Setup, Called with the Thread Lock Held
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupRange_Omp(CeedOperator op) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Omp *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedOperator_Omp *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  CeedCallBackend(CeedOperatorSetup_Omp(op));
+  if (!impl->range) CeedCallBackend(CeedOperatorRangeCreate_Ref(op, ceed_impl->blk_size, impl->blk_restr, &impl->range));
+  if (!impl->range->is_concurrent) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Range application requires a CeedQFunction and CeedBasis objects from this backend");
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//   The range is applied on the calling thread, range applications into different output vectors run concurrently
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Omp(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                         CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_Omp *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  int ierr;
+
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorSetupRange_Omp(op);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  CeedCallBackend(CeedOperatorRangeApply_Ref(op, impl->range, elem_start, elem_stop, in_vec, out_vec));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroy_Omp(CeedOperator op) {
+  CeedOperator_Omp *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  for (CeedInt i = 0; i < impl->num_inputs + impl->num_outputs; i++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->blk_restr[i]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->blk_restr));
+  CeedCallBackend(CeedFree(&impl->e_vecs_full));
+  CeedCallBackend(CeedFree(&impl->input_states));
+
+  for (CeedInt i = 0; i < impl->num_inputs; i++) {
+    CeedCallBackend(CeedVectorDestroy(&impl->q_weights[i]));
+  }
+  CeedCallBackend(CeedFree(&impl->q_weights));
+
+  for (CeedInt t = 0; t < impl->num_threads; t++) {
+    CeedOperatorThread_Omp *thread = &impl->threads[t];
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedBasisDestroy(&thread->bases_in[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_in[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_in[i]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedBasisDestroy(&thread->bases_out[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->e_vecs_out[i]));
+      CeedCallBackend(CeedVectorDestroy(&thread->q_vecs_out[i]));
+    }
+    CeedCallBackend(CeedFree(&thread->bases_in));
+    CeedCallBackend(CeedFree(&thread->bases_out));
+    CeedCallBackend(CeedFree(&thread->e_vecs_in));
+    CeedCallBackend(CeedFree(&thread->e_vecs_out));
+    CeedCallBackend(CeedFree(&thread->q_vecs_in));
+    CeedCallBackend(CeedFree(&thread->q_vecs_out));
+  }
+  CeedCallBackend(CeedFree(&impl->threads));
+  CeedCallBackend(CeedOperatorRangeDestroy_Ref(&impl->range));
+
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Create
+//------------------------------------------------------------------------------
+int CeedOperatorCreate_Omp(CeedOperator op) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_Omp *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange", CeedOperatorApplyAddRange_Omp));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Omp));
+  return CEED_ERROR_SUCCESS;
+}
+//------------------------------------------------------------------------------
@@ -0,0 +1,45 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#ifndef _ceed_omp_h
+#define _ceed_omp_h
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../ref/ceed-ref.h"
+
+typedef struct {
+  CeedInt blk_size;
+} Ceed_Omp;
+
+typedef struct {
+  CeedBasis  *bases_in;   /* Thread copies of input bases   */
+  CeedBasis  *bases_out;  /* Thread copies of output bases  */
+  CeedVector *e_vecs_in;  /* Element block input E-vectors  */
+  CeedVector *e_vecs_out; /* Element block output E-vectors */
+  CeedVector *q_vecs_in;  /* Element block input Q-vectors  */
+  CeedVector *q_vecs_out; /* Element block output Q-vectors */
+} CeedOperatorThread_Omp;
+
+typedef struct {
+  bool                    is_identity_restr_op;
+  CeedElemRestriction    *blk_restr;    /* Blocked versions of restrictions */
+  CeedVector             *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
+  uint64_t               *input_states; /* State counter of inputs */
+  CeedVector             *q_weights;    /* Quadrature weights, shared by all threads */
+  CeedOperatorThread_Omp *threads;      /* Per-thread element block work vectors */
+  CeedOperatorRange_Ref  *range;        /* Element range application data */
+  CeedInt                 num_threads;
+  CeedInt                 num_inputs, num_outputs;
+} CeedOperator_Omp;
+
+CEED_INTERN int CeedOperatorCreate_Omp(CeedOperator op);
+
+#endif  // _ceed_omp_h
@@ -27,11 +27,18 @@ static int CeedDestroy_Opt(Ceed ceed) {
 // Backend Init
 //------------------------------------------------------------------------------
 static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
-  if (strcmp(resource, "/cpu/self") && strcmp(resource, "/cpu/self/opt") && strcmp(resource, "/cpu/self/opt/blocked")) {
+  char *resource_root;
+  CeedCallBackend(CeedGetResourceRoot(ceed, resource, ":", &resource_root));
+  if (strcmp(resource_root, "/cpu/self") && strcmp(resource_root, "/cpu/self/opt") && strcmp(resource_root, "/cpu/self/opt/blocked")) {
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND, "Opt backend cannot use resource: %s", resource);
     // LCOV_EXCL_STOP
   }
+  CeedCallBackend(CeedFree(&resource_root));
+
+  // Block size may be selected with the resource option ":blk_size=N"
+  CeedInt blk_size;
+  CeedCallBackend(CeedGetResourceBlockSize(ceed, resource, 8, &blk_size));
   CeedCallBackend(CeedSetDeterministic(ceed, true));
 
   // Create reference Ceed that implementation will be dispatched through unless overridden
@@ -50,7 +57,7 @@ static int CeedInit_Opt_Blocked(const char *resource, Ceed ceed) {
   // Set blocksize
   Ceed_Opt *data;
   CeedCallBackend(CeedCalloc(1, &data));
-  data->blk_size = 8;
+  data->blk_size = blk_size;
   CeedCallBackend(CeedSetData(ceed, data));
 
   return CEED_ERROR_SUCCESS;
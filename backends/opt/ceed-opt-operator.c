@@ -17,8 +17,8 @@
 // Setup Input/Output Fields
 //------------------------------------------------------------------------------
 static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool is_input, const CeedInt blk_size, CeedElemRestriction *blk_restr,
-                                       CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedInt start_e, CeedInt num_fields,
-                                       CeedInt Q) {
+                                       CeedVector *e_vecs_full, CeedVector *e_vecs, CeedVector *q_vecs, CeedEvalMode *eval_modes, CeedInt start_e,
+                                       CeedInt num_fields, CeedInt Q) {
   CeedInt  num_comp, size, P;
   CeedSize e_size, q_size;
   Ceed     ceed;
@@ -37,8 +37,7 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
 
   // Loop over fields
   for (CeedInt i = 0; i < num_fields; i++) {
-    CeedEvalMode eval_mode;
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_mode));
+    CeedEvalMode eval_mode = eval_modes[i];
 
     if (eval_mode != CEED_EVAL_WEIGHT) {
       CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_fields[i], &r));
@@ -59,12 +58,22 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
         CeedCallBackend(
             CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, elem_size, blk_size, num_comp, l_size, strides, &blk_restr[i + start_e]));
       } else {
-        const CeedInt *offsets = NULL;
-        CeedCallBackend(CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets));
+        bool has_offsets_64;
         CeedCallBackend(CeedElemRestrictionGetCompStride(r, &comp_stride));
-        CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
-                                                         CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
-        CeedCallBackend(CeedElemRestrictionRestoreOffsets(r, &offsets));
+        CeedCallBackend(CeedElemRestrictionHasOffsets64(r, &has_offsets_64));
+        if (has_offsets_64) {
+          const CeedSize *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets64(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked64(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                             CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets64(r, &offsets));
+        } else {
+          const CeedInt *offsets = NULL;
+          CeedCallBackend(CeedElemRestrictionGetOffsets(r, CEED_MEM_HOST, &offsets));
+          CeedCallBackend(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST,
+                                                           CEED_COPY_VALUES, offsets, &blk_restr[i + start_e]));
+          CeedCallBackend(CeedElemRestrictionRestoreOffsets(r, &offsets));
+        }
       }
       CeedCallBackend(CeedElemRestrictionCreateVector(blk_restr[i + start_e], NULL, &e_vecs_full[i + start_e]));
     }
@@ -105,6 +114,25 @@ static int CeedOperatorSetupFields_Opt(CeedQFunction qf, CeedOperator op, bool i
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Setup Field Evaluation Modes
+//   Interpolation with a collocated basis is the identity, so those fields use the E-vector as the Q-vector, as with CEED_EVAL_NONE
+//------------------------------------------------------------------------------
+static int CeedOperatorSetupEvalModes_Opt(CeedQFunctionField *qf_fields, CeedOperatorField *op_fields, CeedInt num_fields, bool is_identity_qf,
+                                          CeedEvalMode *eval_modes) {
+  for (CeedInt i = 0; i < num_fields; i++) {
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_fields[i], &eval_modes[i]));
+    if (eval_modes[i] == CEED_EVAL_INTERP && !is_identity_qf) {
+      CeedBasis basis;
+      bool      is_collocated;
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_fields[i], &basis));
+      CeedCallBackend(CeedBasisIsCollocated(basis, &is_collocated));
+      if (is_collocated) eval_modes[i] = CEED_EVAL_NONE;
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator
 //------------------------------------------------------------------------------
@@ -138,17 +166,43 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_vecs_out));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_in));
   CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->q_vecs_out));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->eval_modes_in));
+  CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->eval_modes_out));
 
   impl->num_inputs  = num_input_fields;
   impl->num_outputs = num_output_fields;
 
   // Set up infield and outfield pointer arrays
+  CeedCallBackend(CeedOperatorSetupEvalModes_Opt(qf_input_fields, op_input_fields, num_input_fields, impl->is_identity_qf, impl->eval_modes_in));
+  CeedCallBackend(CeedOperatorSetupEvalModes_Opt(qf_output_fields, op_output_fields, num_output_fields, impl->is_identity_qf, impl->eval_modes_out));
   // Infields
-  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, blk_size, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in, 0,
-                                              num_input_fields, Q));
+  CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, true, blk_size, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_in, impl->q_vecs_in,
+                                              impl->eval_modes_in, 0, num_input_fields, Q));
   // Outfields
   CeedCallBackend(CeedOperatorSetupFields_Opt(qf, op, false, blk_size, impl->blk_restr, impl->e_vecs_full, impl->e_vecs_out, impl->q_vecs_out,
-                                              num_input_fields, num_output_fields, Q));
+                                              impl->eval_modes_out, num_input_fields, num_output_fields, Q));
+
+  // Single precision passive inputs
+  //   The full E-vector is only stored in single precision, so the CeedScalar E-vector is not kept
+  CeedScalarType precision;
+  CeedCallBackend(CeedOperatorGetPrecision(op, &precision));
+  impl->use_fp32 = precision == CEED_SCALAR_FP32 && CEED_SCALAR_TYPE != CEED_SCALAR_FP32;
+  if (impl->use_fp32) {
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_fp32));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->e_data_blk));
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedSize   e_size, blk_e_size;
+      CeedVector vec;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (impl->eval_modes_in[i] == CEED_EVAL_WEIGHT || vec == CEED_VECTOR_ACTIVE) continue;
+      CeedCallBackend(CeedVectorGetLength(impl->e_vecs_full[i], &e_size));
+      CeedCallBackend(CeedVectorGetLength(impl->e_vecs_in[i], &blk_e_size));
+      CeedCallBackend(CeedCalloc(e_size, &impl->e_data_fp32[i]));
+      CeedCallBackend(CeedCalloc(blk_e_size, &impl->e_data_blk[i]));
+      CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
+    }
+  }
 
   // Identity QFunctions
   if (impl->is_identity_qf) {
@@ -172,6 +226,28 @@ static int CeedOperatorSetup_Opt(CeedOperator op) {
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict Passive Input to Single Precision E-vector
+//   Each element block is restricted into the block E-vector and converted, so no full CeedScalar E-vector is needed
+//------------------------------------------------------------------------------
+static int CeedOperatorRestrictInputFP32_Opt(CeedInt i, CeedVector vec, CeedOperator_Opt *impl, CeedRequest *request) {
+  CeedInt  num_blk;
+  CeedSize blk_e_size;
+
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(impl->blk_restr[i], &num_blk));
+  CeedCallBackend(CeedVectorGetLength(impl->e_vecs_in[i], &blk_e_size));
+  for (CeedInt b = 0; b < num_blk; b++) {
+    const CeedScalar *e_data;
+    float            *e_data_fp32 = &impl->e_data_fp32[i][b * blk_e_size];
+
+    CeedCallBackend(CeedElemRestrictionApplyBlock(impl->blk_restr[i], b, CEED_NOTRANSPOSE, vec, impl->e_vecs_in[i], request));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_in[i], CEED_MEM_HOST, &e_data));
+    for (CeedSize j = 0; j < blk_e_size; j++) e_data_fp32[j] = (float)e_data[j];
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_in[i], &e_data));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Input Fields
 //------------------------------------------------------------------------------
@@ -183,7 +259,7 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
   uint64_t     state;
 
   for (CeedInt i = 0; i < num_input_fields; i++) {
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_in[i];
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
       // Get input vector
@@ -191,6 +267,11 @@ static inline int CeedOperatorSetupInputs_Opt(CeedInt num_input_fields, CeedQFun
       if (vec != CEED_VECTOR_ACTIVE) {
         // Restrict
         CeedCallBackend(CeedVectorGetState(vec, &state));
+        if (impl->use_fp32) {
+          if (state != impl->input_states[i]) CeedCallBackend(CeedOperatorRestrictInputFP32_Opt(i, vec, impl, request));
+          impl->input_states[i] = state;
+          continue;
+        }
         if (state != impl->input_states[i]) {
           CeedCallBackend(CeedElemRestrictionApply(impl->blk_restr[i], CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
           impl->input_states[i] = state;
@@ -233,41 +314,53 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunction
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr));
     CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_in[i];
     CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
     // Restrict block active input
     if (vec == CEED_VECTOR_ACTIVE) {
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->blk_restr[i], e / blk_size, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[i], request));
       active_in = 1;
     }
+    // Locate block passive input, converting from single precision if needed
+    CeedScalar *e_data_blk = NULL;
+    if (!active_in && eval_mode != CEED_EVAL_WEIGHT) {
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_restr, &num_comp));
+      const CeedSize blk_e_size = eval_mode == CEED_EVAL_NONE ? (CeedSize)Q * size : (CeedSize)elem_size * num_comp;
+
+      if (impl->use_fp32) {
+        const float *e_data_fp32 = &impl->e_data_fp32[i][e * blk_e_size];
+
+        e_data_blk = impl->e_data_blk[i];
+        CeedPragmaSIMD for (CeedSize j = 0; j < blk_size * blk_e_size; j++) e_data_blk[j] = e_data_fp32[j];
+      } else {
+        e_data_blk = &e_data[i][e * blk_e_size];
+      }
+    }
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
         if (!active_in) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * Q * size]));
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_blk));
         }
         break;
       case CEED_EVAL_INTERP:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         if (!active_in) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * elem_size * num_comp]));
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_blk));
         }
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_GRAD:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         if (!active_in) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * elem_size * num_comp]));
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_blk));
         }
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_DIV:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         if (!active_in) {
-          CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data[i][e * elem_size * num_comp]));
+          CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, e_data_blk));
         }
         CeedCallBackend(CeedBasisApply(basis, blk_size, CEED_NOTRANSPOSE, CEED_EVAL_DIV, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
@@ -286,12 +379,34 @@ static inline int CeedOperatorInputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunction
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Zero Element Lanes Outside [e_start, e_end) in a Single Block E-vector
+//   Blocked E-vectors interlace the elements of a block, so partial blocks at the ends of a range are masked before the transpose restriction
+//------------------------------------------------------------------------------
+static inline int CeedOperatorMaskBlock_Opt(CeedElemRestriction blk_restr, CeedInt e, CeedInt blk_size, CeedInt e_start, CeedInt e_end,
+                                            CeedVector e_vec) {
+  CeedInt     elem_size, num_comp;
+  CeedScalar *e_data;
+
+  if (e >= e_start && e + blk_size <= e_end) return CEED_ERROR_SUCCESS;
+  CeedCallBackend(CeedElemRestrictionGetElementSize(blk_restr, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(blk_restr, &num_comp));
+  CeedCallBackend(CeedVectorGetArray(e_vec, CEED_MEM_HOST, &e_data));
+  for (CeedInt j = 0; j < blk_size; j++) {
+    if (e + j >= e_start && e + j < e_end) continue;
+    for (CeedSize k = 0; k < (CeedSize)elem_size * num_comp; k++) e_data[k * blk_size + j] = 0.0;
+  }
+  CeedCallBackend(CeedVectorRestoreArray(e_vec, &e_data));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Output Basis Action
 //------------------------------------------------------------------------------
-static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctionField *qf_output_fields, CeedOperatorField *op_output_fields,
-                                              CeedInt blk_size, CeedInt num_input_fields, CeedInt num_output_fields, CeedOperator op,
-                                              CeedVector out_vec, CeedOperator_Opt *impl, CeedRequest *request) {
+static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt e_start, CeedInt e_end, CeedInt Q, CeedQFunctionField *qf_output_fields,
+                                              CeedOperatorField *op_output_fields, CeedInt blk_size, CeedInt num_input_fields,
+                                              CeedInt num_output_fields, CeedOperator op, CeedVector out_vec, CeedOperator_Opt *impl,
+                                              CeedRequest *request) {
   CeedElemRestriction elem_restr;
   CeedEvalMode        eval_mode;
   CeedBasis           basis;
@@ -300,7 +415,7 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
   for (CeedInt i = 0; i < num_output_fields; i++) {
     // Get elem_size, eval_mode, size
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr));
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_out[i];
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
@@ -336,6 +451,8 @@ static inline int CeedOperatorOutputBasis_Opt(CeedInt e, CeedInt Q, CeedQFunctio
     // Get output vector
     CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
     if (vec == CEED_VECTOR_ACTIVE) vec = out_vec;
+    // Mask elements outside of range
+    CeedCallBackend(CeedOperatorMaskBlock_Opt(impl->blk_restr[i + impl->num_inputs], e, blk_size, e_start, e_end, impl->e_vecs_out[i]));
     // Restrict
     CeedCallBackend(
         CeedElemRestrictionApplyBlock(impl->blk_restr[i + impl->num_inputs], e / blk_size, CEED_TRANSPOSE, impl->e_vecs_out[i], vec, request));
@@ -351,9 +468,9 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
   for (CeedInt i = 0; i < num_input_fields; i++) {
     CeedEvalMode eval_mode;
     CeedVector   vec;
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_in[i];
     CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE) {
+    if (eval_mode != CEED_EVAL_WEIGHT && vec != CEED_VECTOR_ACTIVE && !impl->use_fp32) {
       CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data[i]));
     }
   }
@@ -361,9 +478,10 @@ static inline int CeedOperatorRestoreInputs_Opt(CeedInt num_input_fields, CeedQF
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Operator Apply on Elements [e_start, e_end)
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+static int CeedOperatorApplyAddCore_Opt(CeedOperator op, CeedInt e_start, CeedInt e_end, CeedVector in_vec, CeedVector out_vec,
+                                        CeedRequest *request) {
   Ceed ceed;
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
   Ceed_Opt *ceed_impl;
@@ -374,7 +492,9 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   CeedInt Q, num_input_fields, num_output_fields, num_elem;
   CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedInt       num_blks = (num_elem / blk_size) + !!(num_elem % blk_size);
+  CeedInt       blk_start = e_start / blk_size, blk_end = (e_end / blk_size) + !!(e_end % blk_size);
+  // Padding lanes past num_elem are never summed into the L-vector, so they need no mask
+  if (e_end == num_elem) e_end = blk_end * blk_size;
   CeedQFunction qf;
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
   CeedOperatorField *op_input_fields, *op_output_fields;
@@ -389,8 +509,9 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
 
   // Restriction only operator
   if (impl->is_identity_restr_op) {
-    for (CeedInt b = 0; b < num_blks; b++) {
+    for (CeedInt b = blk_start; b < blk_end; b++) {
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->blk_restr[0], b, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_in[0], request));
+      CeedCallBackend(CeedOperatorMaskBlock_Opt(impl->blk_restr[0], b * blk_size, blk_size, e_start, e_end, impl->e_vecs_in[0]));
       CeedCallBackend(CeedElemRestrictionApplyBlock(impl->blk_restr[1], b, CEED_TRANSPOSE, impl->e_vecs_in[0], out_vec, request));
     }
     return CEED_ERROR_SUCCESS;
@@ -402,7 +523,7 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   // Output Lvecs, Evecs, and Qvecs
   for (CeedInt i = 0; i < num_output_fields; i++) {
     // Set Qvec if needed
-    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+    eval_mode = impl->eval_modes_out[i];
     if (eval_mode == CEED_EVAL_NONE) {
       // Set qvec to single block evec
       CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_out[i], CEED_MEM_HOST, &e_data[i + num_input_fields]));
@@ -412,7 +533,7 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   }
 
   // Loop through elements
-  for (CeedInt e = 0; e < num_blks * blk_size; e += blk_size) {
+  for (CeedInt e = blk_start * blk_size; e < blk_end * blk_size; e += blk_size) {
     // Input basis apply
     CeedCallBackend(
         CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, blk_size, in_vec, false, e_data, impl, request));
@@ -423,8 +544,8 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
     }
 
     // Output basis apply and restrict
-    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, Q, qf_output_fields, op_output_fields, blk_size, num_input_fields, num_output_fields, op, out_vec,
-                                                impl, request));
+    CeedCallBackend(CeedOperatorOutputBasis_Opt(e, e_start, e_end, Q, qf_output_fields, op_output_fields, blk_size, num_input_fields,
+                                                num_output_fields, op, out_vec, impl, request));
   }
 
   // Restore input arrays
@@ -433,6 +554,118 @@ static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVect
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Opt(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt num_elem;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorApplyAddCore_Opt(op, 0, num_elem, in_vec, out_vec, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Range Setup and Serialized Range Apply, Called with the Thread Lock Held
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyAddRangeSerial_Opt(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                                      bool *is_serial, CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  Ceed_Opt *ceed_impl;
+  CeedCallBackend(CeedGetData(ceed, &ceed_impl));
+  CeedOperator_Opt *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  bool is_profiling;
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
+
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Opt(op));
+  if (!impl->range) CeedCallBackend(CeedOperatorRangeCreate_Ref(op, ceed_impl->blk_size, impl->blk_restr, &impl->range));
+
+  // Phases are profiled through the libCEED interfaces, and some objects intercept their apply, so these applications are serialized
+  *is_serial = is_profiling || !impl->range->is_concurrent;
+  if (*is_serial) CeedCallBackend(CeedOperatorApplyAddCore_Opt(op, elem_start, elem_stop, in_vec, out_vec, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//   Range applications into different output vectors run concurrently on the element range data
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Opt(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                         CeedRequest *request) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperator_Opt *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  bool is_serial = true;
+  int  ierr;
+
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorApplyAddRangeSerial_Opt(op, elem_start, elem_stop, in_vec, out_vec, &is_serial, request);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  if (!is_serial) CeedCallBackend(CeedOperatorRangeApply_Ref(op, impl->range, elem_start, elem_stop, in_vec, out_vec));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Replicate Passive QFunction Inputs for Batched Assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupBatchInputs_Opt(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                   CeedInt num_active_in, CeedInt num_points, CeedOperator_Opt *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_in;
+    CeedScalar       *q_batch;
+    // Active inputs hold fixed unit vectors
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_in));
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&q_batch[(field * num_active_in + in) * num_points], &q_in[field * num_points], num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_in));
+    CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &q_batch));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy Batched QFunction Outputs into Assembled Layout
+//------------------------------------------------------------------------------
+static inline int CeedOperatorAssembleBatchOutputs_Opt(CeedInt num_output_fields, CeedQFunctionField *qf_output_fields,
+                                                       CeedOperatorField *op_output_fields, CeedInt num_active_in, CeedInt num_active_out,
+                                                       CeedInt num_points, CeedScalar *assembled, CeedOperator_Opt *impl) {
+  CeedInt active_offset = 0;
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_batch;
+    // Skip passive outputs
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->qf_batch_out[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&assembled[(in * num_active_out + active_offset + field) * num_points], &q_batch[(field * num_active_in + in) * num_points],
+               num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->qf_batch_out[i], &q_batch));
+    active_offset += size;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Core code for linear QFunction assembly
 //------------------------------------------------------------------------------
@@ -458,7 +691,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
   CeedVector  vec, l_vec = impl->qf_l_vec;
   CeedInt     num_active_in = impl->num_active_in, num_active_out = impl->num_active_out;
-  CeedVector *active_in = impl->qf_active_in;
   CeedScalar *a, *tmp;
   CeedScalar *e_data[2 * CEED_FIELD_MAX] = {0};
 
@@ -483,20 +715,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
       // Check if active input
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
-        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &tmp));
-        CeedCallBackend(CeedRealloc(num_active_in + size, &active_in));
-        for (CeedInt field = 0; field < size; field++) {
-          q_size = (CeedSize)Q * blk_size;
-          CeedCallBackend(CeedVectorCreate(ceed, q_size, &active_in[num_active_in + field]));
-          CeedCallBackend(CeedVectorSetArray(active_in[num_active_in + field], CEED_MEM_HOST, CEED_USE_POINTER, &tmp[field * Q * blk_size]));
-        }
         num_active_in += size;
-        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &tmp));
       }
     }
     impl->num_active_in = num_active_in;
-    impl->qf_active_in  = active_in;
   }
 
   // Count number of active output fields
@@ -520,6 +742,35 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     // LCOV_EXCL_STOP
   }
 
+  // Batched Q-vectors, with one copy of the quadrature points per active input component
+  if (!impl->qf_batch_in) {
+    CeedInt active_offset = 0;
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_out));
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q * blk_size;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_in[i]));
+      // Set unit vectors for active input components
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorSetValue(impl->qf_batch_in[i], 0.0));
+        CeedCallBackend(CeedVectorGetArray(impl->qf_batch_in[i], CEED_MEM_HOST, &tmp));
+        for (CeedInt field = 0; field < size; field++) {
+          CeedScalar *unit_in = &tmp[(field * num_active_in + active_offset + field) * Q * blk_size];
+          for (CeedInt j = 0; j < Q * blk_size; j++) unit_in[j] = 1.0;
+        }
+        CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &tmp));
+        active_offset += size;
+      }
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q * blk_size;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_out[i]));
+    }
+  }
+
   // Setup l_vec
   if (!l_vec) {
     CeedSize l_size = (CeedSize)blk_size * Q * num_active_in * num_active_out;
@@ -556,43 +807,17 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Opt(CeedOperator op, b
     CeedCallBackend(
         CeedOperatorInputBasis_Opt(e, Q, qf_input_fields, op_input_fields, num_input_fields, blk_size, NULL, true, e_data, impl, request));
 
-    // Assemble QFunction
-    for (CeedInt in = 0; in < num_active_in; in++) {
-      // Set Inputs
-      CeedCallBackend(CeedVectorSetValue(active_in[in], 1.0));
-      if (num_active_in > 1) {
-        CeedCallBackend(CeedVectorSetValue(active_in[(in + num_active_in - 1) % num_active_in], 0.0));
-      }
-      // Set Outputs
-      for (CeedInt out = 0; out < num_output_fields; out++) {
-        // Get output vector
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, a));
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &size));
-          a += size * Q * blk_size;  // Advance the pointer by the size of the output
-        }
-      }
-      // Apply QFunction
-      CeedCallBackend(CeedQFunctionApply(qf, Q * blk_size, impl->q_vecs_in, impl->q_vecs_out));
-    }
+    // Assemble QFunction for all active input components at once
+    CeedCallBackend(CeedOperatorSetupBatchInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, num_active_in, Q * blk_size, impl));
+    CeedCallBackend(CeedQFunctionApply(qf, num_active_in * Q * blk_size, impl->qf_batch_in, impl->qf_batch_out));
+    CeedCallBackend(CeedOperatorAssembleBatchOutputs_Opt(num_output_fields, qf_output_fields, op_output_fields, num_active_in, num_active_out,
+                                                         Q * blk_size, a, impl));
 
     // Assemble into assembled vector
     CeedCallBackend(CeedVectorRestoreArray(l_vec, &a));
     CeedCallBackend(CeedElemRestrictionApplyBlock(blk_rstr, e / blk_size, CEED_TRANSPOSE, l_vec, *assembled, request));
   }
 
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out = 0; out < num_output_fields; out++) {
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE) {
-      CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_COPY_VALUES, NULL));
-    }
-  }
-
   // Restore input arrays
   CeedCallBackend(CeedOperatorRestoreInputs_Opt(num_input_fields, qf_input_fields, op_input_fields, e_data, impl));
 
@@ -613,6 +838,21 @@ static int CeedOperatorLinearAssembleQFunctionUpdate_Opt(CeedOperator op, CeedVe
   return CeedOperatorLinearAssembleQFunctionCore_Opt(op, false, &assembled, &rstr, request);
 }
 
+//------------------------------------------------------------------------------
+// Operator Set Precision
+//   Only passive input E-vectors are stored in lower precision, so only single precision is supported
+//------------------------------------------------------------------------------
+static int CeedOperatorSetPrecision_Opt(CeedOperator op, CeedScalarType precision) {
+  if (precision != CEED_SCALAR_FP32) {
+    // LCOV_EXCL_START
+    Ceed ceed;
+    CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+    return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend only implements CEED_SCALAR_FP32 CeedOperator precision");
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Destroy
 //------------------------------------------------------------------------------
@@ -625,8 +865,17 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_full[i]));
   }
   CeedCallBackend(CeedFree(&impl->blk_restr));
+  CeedCallBackend(CeedOperatorRangeDestroy_Ref(&impl->range));
   CeedCallBackend(CeedFree(&impl->e_vecs_full));
   CeedCallBackend(CeedFree(&impl->input_states));
+  if (impl->use_fp32) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedFree(&impl->e_data_fp32[i]));
+      CeedCallBackend(CeedFree(&impl->e_data_blk[i]));
+    }
+    CeedCallBackend(CeedFree(&impl->e_data_fp32));
+    CeedCallBackend(CeedFree(&impl->e_data_blk));
+  }
 
   for (CeedInt i = 0; i < impl->num_inputs; i++) {
     CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[i]));
@@ -641,12 +890,20 @@ static int CeedOperatorDestroy_Opt(CeedOperator op) {
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  CeedCallBackend(CeedFree(&impl->eval_modes_in));
+  CeedCallBackend(CeedFree(&impl->eval_modes_out));
 
   // QFunction assembly data
-  for (CeedInt i = 0; i < impl->num_active_in; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->qf_active_in[i]));
+  if (impl->qf_batch_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_in[i]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_out[i]));
+    }
   }
-  CeedCallBackend(CeedFree(&impl->qf_active_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_out));
   CeedCallBackend(CeedVectorDestroy(&impl->qf_l_vec));
   CeedCallBackend(CeedElemRestrictionDestroy(&impl->qf_blk_rstr));
 
@@ -668,7 +925,7 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   CeedCallBackend(CeedCalloc(1, &impl));
   CeedCallBackend(CeedOperatorSetData(op, impl));
 
-  if (blk_size != 1 && blk_size != 8) {
+  if (blk_size < 1) {
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_BACKEND, "Opt backend cannot use blocksize: %" CeedInt_FMT, blk_size);
     // LCOV_EXCL_STOP
@@ -677,6 +934,8 @@ int CeedOperatorCreate_Opt(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange", CeedOperatorApplyAddRange_Opt));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "SetPrecision", CeedOperatorSetPrecision_Opt));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Opt));
   return CEED_ERROR_SUCCESS;
 }
@@ -7,9 +7,26 @@
 
 #include <ceed/backend.h>
 #include <ceed/ceed.h>
+#include <stdbool.h>
 
 #include "ceed-opt.h"
 
+// Inlining of fixed size kernels, so compile time sizes reach the core loops
+#if defined(__GNUC__) || defined(__clang__)
+#define CEED_TENSOR_CONTRACT_OPT_INLINE static inline __attribute__((always_inline))
+#else
+#define CEED_TENSOR_CONTRACT_OPT_INLINE static inline
+#endif
+
+// Full unrolling of loops with compile time trip counts
+#if defined(__clang__)
+#define CeedPragmaUnroll_Opt _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+#define CeedPragmaUnroll_Opt _Pragma("GCC unroll 16")
+#else
+#define CeedPragmaUnroll_Opt
+#endif
+
 //------------------------------------------------------------------------------
 // Tensor Contract Core loop
 //------------------------------------------------------------------------------
@@ -34,6 +51,55 @@ static inline int CeedTensorContractApply_Core_Opt(CeedTensorContract contract,
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Core loops with compile time B, J, and strides of t
+//------------------------------------------------------------------------------
+CEED_TENSOR_CONTRACT_OPT_INLINE int CeedTensorContractApply_Fixed_Single_Opt(CeedInt A, const CeedInt B, const CeedInt J, const CeedInt t_stride_0,
+                                                                             const CeedInt t_stride_1, const CeedScalar *restrict t,
+                                                                             const CeedScalar *restrict u, CeedScalar *restrict v) {
+  for (CeedInt a = 0; a < A; a++) {
+    CeedPragmaUnroll_Opt for (CeedInt b = 0; b < B; b++) {
+      const CeedScalar ub = u[a * B + b];
+      CeedPragmaUnroll_Opt for (CeedInt j = 0; j < J; j++) v[a * J + j] += t[j * t_stride_0 + b * t_stride_1] * ub;
+    }
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+CEED_TENSOR_CONTRACT_OPT_INLINE int CeedTensorContractApply_Fixed_Blocked_Opt(CeedInt A, const CeedInt B, CeedInt C, const CeedInt J,
+                                                                              const CeedInt t_stride_0, const CeedInt t_stride_1,
+                                                                              const CeedScalar *restrict t, const CeedScalar *restrict u,
+                                                                              CeedScalar *restrict v) {
+  for (CeedInt a = 0; a < A; a++) {
+    for (CeedInt c = 0; c < C; c++) {
+      CeedPragmaUnroll_Opt for (CeedInt j = 0; j < J; j++) {
+        CeedScalar vj = 0.0;
+        CeedPragmaUnroll_Opt for (CeedInt b = 0; b < B; b++) vj += t[j * t_stride_0 + b * t_stride_1] * u[(a * B + b) * C + c];
+        v[(a * J + j) * C + c] += vj;
+      }
+    }
+  }
+
+  return CEED_ERROR_SUCCESS;
+}
+
+CEED_TENSOR_CONTRACT_OPT_INLINE int CeedTensorContractApply_Fixed_Opt(CeedInt A, const CeedInt B, CeedInt C, const CeedInt J,
+                                                                      const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add,
+                                                                      const CeedScalar *restrict u, CeedScalar *restrict v) {
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
+  }
+
+  if (C == 1) {
+    if (t_mode == CEED_TRANSPOSE) return CeedTensorContractApply_Fixed_Single_Opt(A, B, J, 1, J, t, u, v);
+    else return CeedTensorContractApply_Fixed_Single_Opt(A, B, J, B, 1, t, u, v);
+  } else {
+    if (t_mode == CEED_TRANSPOSE) return CeedTensorContractApply_Fixed_Blocked_Opt(A, B, C, J, 1, J, t, u, v);
+    else return CeedTensorContractApply_Fixed_Blocked_Opt(A, B, C, J, B, 1, t, u, v);
+  }
+}
+
 //------------------------------------------------------------------------------
 // Tensor Contract Apply
 //------------------------------------------------------------------------------
@@ -43,12 +109,62 @@ static int CeedTensorContractApply_Opt(CeedTensorContract contract, CeedInt A, C
     for (CeedInt q = 0; q < A * J * C; q++) v[q] = (CeedScalar)0.0;
   }
 
+  // Specialize on common element block sizes so the inner loop has a fixed trip count
   if (C == 1) return CeedTensorContractApply_Core_Opt(contract, A, B, 1, J, t, t_mode, add, u, v);
+  else if (C == 8) return CeedTensorContractApply_Core_Opt(contract, A, B, 8, J, t, t_mode, add, u, v);
+  else if (C == 16) return CeedTensorContractApply_Core_Opt(contract, A, B, 16, J, t, t_mode, add, u, v);
+  else if (C == 32) return CeedTensorContractApply_Core_Opt(contract, A, B, 32, J, t, t_mode, add, u, v);
   else return CeedTensorContractApply_Core_Opt(contract, A, B, C, J, t, t_mode, add, u, v);
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Tensor Contract Apply - Fixed 1D Sizes
+//   Contractions of a tensor basis with P_1d nodes and Q_1d quadrature points have (B, J) of (P_1d, Q_1d), (Q_1d, P_1d), or (Q_1d, Q_1d)
+//------------------------------------------------------------------------------
+#define CEED_TENSOR_CONTRACT_APPLY_OPT(P, Q)                                                                                  \
+  static int CeedTensorContractApply_Opt_##P##_##Q(CeedTensorContract contract, CeedInt A, CeedInt B, CeedInt C, CeedInt J,   \
+                                                   const CeedScalar *restrict t, CeedTransposeMode t_mode, const CeedInt add, \
+                                                   const CeedScalar *restrict u, CeedScalar *restrict v) {                    \
+    if (B == P && J == Q) return CeedTensorContractApply_Fixed_Opt(A, P, C, Q, t, t_mode, add, u, v);                         \
+    if (B == Q && J == P) return CeedTensorContractApply_Fixed_Opt(A, Q, C, P, t, t_mode, add, u, v);                         \
+    if (B == Q && J == Q) return CeedTensorContractApply_Fixed_Opt(A, Q, C, Q, t, t_mode, add, u, v);                         \
+    return CeedTensorContractApply_Opt(contract, A, B, C, J, t, t_mode, add, u, v);                                           \
+  }
+
+// Instantiate for P_1d in [2, 10] with Q_1d = P_1d, P_1d + 1, or P_1d + 2
+#define CEED_TENSOR_CONTRACT_APPLY_OPT_P(P, Q_1, Q_2) \
+  CEED_TENSOR_CONTRACT_APPLY_OPT(P, P)                \
+  CEED_TENSOR_CONTRACT_APPLY_OPT(P, Q_1)              \
+  CEED_TENSOR_CONTRACT_APPLY_OPT(P, Q_2)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(2, 3, 4)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(3, 4, 5)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(4, 5, 6)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(5, 6, 7)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(6, 7, 8)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(7, 8, 9)
+CEED_TENSOR_CONTRACT_APPLY_OPT_P(8, 9, 10)
+CEED_TENSOR_CONTRACT_APPLY_OPT(9, 9)
+CEED_TENSOR_CONTRACT_APPLY_OPT(9, 10)
+CEED_TENSOR_CONTRACT_APPLY_OPT(10, 10)
+
+typedef int (*CeedTensorContractApply_Opt_Fn)(CeedTensorContract, CeedInt, CeedInt, CeedInt, CeedInt, const CeedScalar *restrict, CeedTransposeMode,
+                                              const CeedInt, const CeedScalar *restrict, CeedScalar *restrict);
+
+// Indexed by [P_1d - 2][Q_1d - P_1d]
+static const CeedTensorContractApply_Opt_Fn tensor_contract_apply_opt[9][3] = {
+    {CeedTensorContractApply_Opt_2_2,   CeedTensorContractApply_Opt_2_3,  CeedTensorContractApply_Opt_2_4},
+    {CeedTensorContractApply_Opt_3_3,   CeedTensorContractApply_Opt_3_4,  CeedTensorContractApply_Opt_3_5},
+    {CeedTensorContractApply_Opt_4_4,   CeedTensorContractApply_Opt_4_5,  CeedTensorContractApply_Opt_4_6},
+    {CeedTensorContractApply_Opt_5_5,   CeedTensorContractApply_Opt_5_6,  CeedTensorContractApply_Opt_5_7},
+    {CeedTensorContractApply_Opt_6_6,   CeedTensorContractApply_Opt_6_7,  CeedTensorContractApply_Opt_6_8},
+    {CeedTensorContractApply_Opt_7_7,   CeedTensorContractApply_Opt_7_8,  CeedTensorContractApply_Opt_7_9},
+    {CeedTensorContractApply_Opt_8_8,   CeedTensorContractApply_Opt_8_9,  CeedTensorContractApply_Opt_8_10},
+    {CeedTensorContractApply_Opt_9_9,   CeedTensorContractApply_Opt_9_10, NULL},
+    {CeedTensorContractApply_Opt_10_10, NULL,                             NULL},
+};
+
 //------------------------------------------------------------------------------
 // Tensor Contract Create
 //------------------------------------------------------------------------------
@@ -56,7 +172,19 @@ int CeedTensorContractCreate_Opt(CeedBasis basis, CeedTensorContract contract) {
   Ceed ceed;
   CeedCallBackend(CeedTensorContractGetCeed(contract, &ceed));
 
-  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", CeedTensorContractApply_Opt));
+  // Select a kernel with fixed 1D sizes for common tensor bases
+  CeedTensorContractApply_Opt_Fn apply = CeedTensorContractApply_Opt;
+  bool                           is_tensor;
+  CeedCallBackend(CeedBasisIsTensor(basis, &is_tensor));
+  if (is_tensor) {
+    CeedInt P_1d, Q_1d;
+    CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
+    CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+    if (P_1d >= 2 && P_1d <= 10 && Q_1d >= P_1d && Q_1d - P_1d <= 2 && tensor_contract_apply_opt[P_1d - 2][Q_1d - P_1d]) {
+      apply = tensor_contract_apply_opt[P_1d - 2][Q_1d - P_1d];
+    }
+  }
+  CeedCallBackend(CeedSetBackendFunction(ceed, "TensorContract", contract, "Apply", apply));
 
   return CEED_ERROR_SUCCESS;
 }
@@ -13,6 +13,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "../ref/ceed-ref.h"
+
 typedef struct {
   CeedInt blk_size;
 } Ceed_Opt;
@@ -22,19 +24,26 @@ typedef struct {
 } CeedBasis_Opt;
 
 typedef struct {
-  bool                 is_identity_qf, is_identity_restr_op;
-  CeedElemRestriction *blk_restr;    /* Blocked versions of restrictions */
-  CeedVector          *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t            *input_states; /* State counter of inputs */
-  CeedVector          *e_vecs_in;    /* Element block input E-vectors  */
-  CeedVector          *e_vecs_out;   /* Element block output E-vectors */
-  CeedVector          *q_vecs_in;    /* Element block input Q-vectors  */
-  CeedVector          *q_vecs_out;   /* Element block output Q-vectors */
-  CeedInt              num_inputs, num_outputs;
-  CeedInt              num_active_in, num_active_out;
-  CeedVector          *qf_active_in;
-  CeedVector           qf_l_vec;
-  CeedElemRestriction  qf_blk_rstr;
+  bool                   is_identity_qf, is_identity_restr_op;
+  CeedElemRestriction   *blk_restr;      /* Blocked versions of restrictions */
+  CeedVector            *e_vecs_full;    /* Full E-vectors, inputs followed by outputs */
+  uint64_t              *input_states;   /* State counter of inputs */
+  CeedVector            *e_vecs_in;      /* Element block input E-vectors  */
+  CeedVector            *e_vecs_out;     /* Element block output E-vectors */
+  CeedVector            *q_vecs_in;      /* Element block input Q-vectors  */
+  CeedVector            *q_vecs_out;     /* Element block output Q-vectors */
+  CeedEvalMode          *eval_modes_in;  /* Input evaluation modes, with collocated interpolation as CEED_EVAL_NONE */
+  CeedEvalMode          *eval_modes_out; /* Output evaluation modes, with collocated interpolation as CEED_EVAL_NONE */
+  bool                   use_fp32;       /* Store passive input E-vectors in single precision */
+  float                **e_data_fp32;    /* Full passive input E-vectors in single precision */
+  CeedScalar           **e_data_blk;     /* Element block passive input data converted from single precision */
+  CeedInt                num_inputs, num_outputs;
+  CeedInt                num_active_in, num_active_out;
+  CeedVector            *qf_batch_in;  /* Batched input Q-vectors for QFunction assembly  */
+  CeedVector            *qf_batch_out; /* Batched output Q-vectors for QFunction assembly */
+  CeedVector             qf_l_vec;
+  CeedElemRestriction    qf_blk_rstr;
+  CeedOperatorRange_Ref *range; /* Element range application data */
 } CeedOperator_Opt;
 
 CEED_INTERN int CeedTensorContractCreate_Opt(CeedBasis basis, CeedTensorContract contract);
@@ -7,16 +7,31 @@
 
 #include <ceed/backend.h>
 #include <ceed/ceed.h>
-#include <math.h>
 #include <stdbool.h>
 #include <string.h>
 
 #include "ceed-ref.h"
 
 //------------------------------------------------------------------------------
-// Basis Apply
+// Basis Work Array
+//   Grow-only scratch space for tensor contractions, reused across applies
 //------------------------------------------------------------------------------
-static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector U, CeedVector V) {
+static int CeedBasisGetWork_Ref(CeedScalar **work_array, CeedSize *work_array_size, CeedSize work_size, CeedScalar **work) {
+  if (work_size > *work_array_size) {
+    CeedCallBackend(CeedFree(work_array));
+    CeedCallBackend(CeedMalloc(work_size, work_array));
+    *work_array_size = work_size;
+  }
+  *work = *work_array;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply with Caller Scratch Space
+//   Operates on host arrays with the grow-only scratch space work_array, so threads with their own scratch space can apply the basis concurrently
+//------------------------------------------------------------------------------
+int CeedBasisApplyWork_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, const CeedScalar *u, CeedScalar *v,
+                           CeedScalar **work_array, CeedSize *work_array_size) {
   Ceed ceed;
   CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
   CeedInt dim, num_comp, num_nodes, num_qpts, Q_comp;
@@ -27,17 +42,7 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
   CeedCallBackend(CeedBasisGetNumQuadratureComponents(basis, &Q_comp));
   CeedTensorContract contract;
   CeedCallBackend(CeedBasisGetTensorContract(basis, &contract));
-  const CeedInt     add = (t_mode == CEED_TRANSPOSE);
-  const CeedScalar *u;
-  CeedScalar       *v;
-  if (U != CEED_VECTOR_NONE) {
-    CeedCallBackend(CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u));
-  } else if (eval_mode != CEED_EVAL_WEIGHT) {
-    // LCOV_EXCL_START
-    return CeedError(ceed, CEED_ERROR_BACKEND, "An input vector is required for this CeedEvalMode");
-    // LCOV_EXCL_STOP
-  }
-  CeedCallBackend(CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v));
+  const CeedInt add = (t_mode == CEED_TRANSPOSE);
 
   // Clear v if operating in transpose
   if (t_mode == CEED_TRANSPOSE) {
@@ -51,11 +56,15 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
     CeedInt P_1d, Q_1d;
     CeedCallBackend(CeedBasisGetNumNodes1D(basis, &P_1d));
     CeedCallBackend(CeedBasisGetNumQuadraturePoints1D(basis, &Q_1d));
+    CeedBasis_Ref *impl;
+    CeedCallBackend(CeedBasisGetData(basis, &impl));
+    // Work arrays for intermediate contraction results, each padded to CEED_ALIGN
+    const CeedSize pad      = CEED_ALIGN / sizeof(CeedScalar);
+    const CeedSize tmp_size = (((CeedSize)num_elem * num_comp * CeedIntPow(P_1d > Q_1d ? P_1d : Q_1d, dim) + pad - 1) / pad) * pad;
+    CeedScalar    *work     = NULL;
     switch (eval_mode) {
       // Interpolate to/from quadrature points
       case CEED_EVAL_INTERP: {
-        CeedBasis_Ref *impl;
-        CeedCallBackend(CeedBasisGetData(basis, &impl));
         if (impl->has_collo_interp) {
           memcpy(v, u, num_elem * num_comp * num_nodes * sizeof(u[0]));
         } else {
@@ -64,8 +73,9 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
             P = Q_1d;
             Q = P_1d;
           }
-          CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
-          CeedScalar        tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          CeedInt pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
+          CeedCallBackend(CeedBasisGetWork_Ref(work_array, work_array_size, 2 * tmp_size, &work));
+          CeedScalar       *tmp[2] = {work, work + tmp_size};
           const CeedScalar *interp_1d;
           CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
           for (CeedInt d = 0; d < dim; d++) {
@@ -86,14 +96,12 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
         if (t_mode == CEED_TRANSPOSE) {
           P = Q_1d, Q = Q_1d;
         }
-        CeedBasis_Ref *impl;
-        CeedCallBackend(CeedBasisGetData(basis, &impl));
         CeedInt           pre = num_comp * CeedIntPow(P, dim - 1), post = num_elem;
         const CeedScalar *interp_1d;
         CeedCallBackend(CeedBasisGetInterp1D(basis, &interp_1d));
         if (impl->collo_grad_1d) {
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
-          CeedScalar interp[num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          CeedCallBackend(CeedBasisGetWork_Ref(work_array, work_array_size, 3 * tmp_size, &work));
+          CeedScalar *tmp[2] = {work, work + tmp_size}, *interp = work + 2 * tmp_size;
           // Interpolate to quadrature points (NoTranspose)
           //  or Grad to quadrature points (Transpose)
           for (CeedInt d = 0; d < dim; d++) {
@@ -139,7 +147,8 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
           if (t_mode == CEED_TRANSPOSE) {
             P = Q_1d, Q = P_1d;
           }
-          CeedScalar tmp[2][num_elem * num_comp * Q * CeedIntPow(P > Q ? P : Q, dim - 1)];
+          CeedCallBackend(CeedBasisGetWork_Ref(work_array, work_array_size, 2 * tmp_size, &work));
+          CeedScalar *tmp[2] = {work, work + tmp_size};
 
           // Dim**2 contractions, apply grad when pass == dim
           for (CeedInt p = 0; p < dim; p++) {
@@ -256,6 +265,41 @@ static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMo
         // LCOV_EXCL_STOP
     }
   }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply Core
+//   Operates on host arrays so operators can call it without CeedVector access
+//------------------------------------------------------------------------------
+int CeedBasisApplyCore_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, const CeedScalar *u, CeedScalar *v) {
+  CeedBasis_Ref *impl;
+  CeedCallBackend(CeedBasisGetData(basis, &impl));
+
+  // Only tensor bases, which have backend data, use scratch space
+  if (!impl) return CeedBasisApplyWork_Ref(basis, num_elem, t_mode, eval_mode, u, v, NULL, NULL);
+  return CeedBasisApplyWork_Ref(basis, num_elem, t_mode, eval_mode, u, v, &impl->work, &impl->work_size);
+}
+
+//------------------------------------------------------------------------------
+// Basis Apply
+//------------------------------------------------------------------------------
+static int CeedBasisApply_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedVector U, CeedVector V) {
+  const CeedScalar *u = NULL;
+  CeedScalar       *v;
+  if (U != CEED_VECTOR_NONE) {
+    CeedCallBackend(CeedVectorGetArrayRead(U, CEED_MEM_HOST, &u));
+  } else if (eval_mode != CEED_EVAL_WEIGHT) {
+    // LCOV_EXCL_START
+    Ceed ceed;
+    CeedCallBackend(CeedBasisGetCeed(basis, &ceed));
+    return CeedError(ceed, CEED_ERROR_BACKEND, "An input vector is required for this CeedEvalMode");
+    // LCOV_EXCL_STOP
+  }
+  CeedCallBackend(CeedVectorGetArrayWrite(V, CEED_MEM_HOST, &v));
+
+  CeedCallBackend(CeedBasisApplyCore_Ref(basis, num_elem, t_mode, eval_mode, u, v));
+
   if (U != CEED_VECTOR_NONE) {
     CeedCallBackend(CeedVectorRestoreArrayRead(U, &u));
   }
@@ -308,6 +352,7 @@ static int CeedBasisDestroyTensor_Ref(CeedBasis basis) {
   CeedBasis_Ref *impl;
   CeedCallBackend(CeedBasisGetData(basis, &impl));
   CeedCallBackend(CeedFree(&impl->collo_grad_1d));
+  CeedCallBackend(CeedFree(&impl->work));
   CeedCallBackend(CeedFree(&impl));
 
   return CEED_ERROR_SUCCESS;
@@ -323,16 +368,7 @@ int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const C
   CeedBasis_Ref *impl;
   CeedCallBackend(CeedCalloc(1, &impl));
   // Check for collocated interp
-  if (Q_1d == P_1d) {
-    bool collocated = 1;
-    for (CeedInt i = 0; i < P_1d; i++) {
-      collocated = collocated && (fabs(interp_1d[i + P_1d * i] - 1.0) < 1e-14);
-      for (CeedInt j = 0; j < P_1d; j++) {
-        if (j != i) collocated = collocated && (fabs(interp_1d[j + P_1d * i]) < 1e-14);
-      }
-    }
-    impl->has_collo_interp = collocated;
-  }
+  CeedCallBackend(CeedBasisIsCollocated(basis, &impl->has_collo_interp));
   // Calculate collocated grad
   if (Q_1d >= P_1d && !impl->has_collo_interp) {
     CeedCallBackend(CeedMalloc(Q_1d * Q_1d, &impl->collo_grad_1d));
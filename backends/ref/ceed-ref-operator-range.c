@@ -0,0 +1,316 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ceed-ref.h"
+
+//------------------------------------------------------------------------------
+// Check if a Ceed is the Operator Ceed or One of Its Delegates
+//   Objects created by a parent backend, such as memcheck, may intercept their apply and are not called on raw pointers
+//------------------------------------------------------------------------------
+static int CeedOperatorRangeIsDelegate_Ref(Ceed op_ceed, Ceed ceed, bool *is_delegate) {
+  *is_delegate = false;
+  while (op_ceed && !*is_delegate) {
+    *is_delegate = op_ceed == ceed;
+    CeedCallBackend(CeedGetDelegate(op_ceed, &op_ceed));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Create Element Range Data
+//   blk_restr holds the restrictions with block size blk_size, inputs followed by outputs, or NULL to use the restrictions of the operator fields
+//------------------------------------------------------------------------------
+int CeedOperatorRangeCreate_Ref(CeedOperator op, CeedInt blk_size, CeedElemRestriction *blk_restr, CeedOperatorRange_Ref **range) {
+  Ceed ceed, qf_ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedQFunction qf;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetCeed(qf, &qf_ceed));
+  CeedInt Q, num_input_fields, num_output_fields;
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedOperatorField *op_input_fields, *op_output_fields;
+  CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
+  CeedQFunctionField *qf_input_fields, *qf_output_fields;
+  CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
+  CeedOperatorRange_Ref *data;
+
+  CeedCallBackend(CeedCalloc(1, &data));
+  data->blk_size    = blk_size;
+  data->num_inputs  = num_input_fields;
+  data->num_outputs = num_output_fields;
+  CeedCallBackend(CeedOperatorRangeIsDelegate_Ref(ceed, qf_ceed, &data->is_concurrent));
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool         is_input = i < num_input_fields;
+    CeedOperatorField  op_field = is_input ? op_input_fields[i] : op_output_fields[i - num_input_fields];
+    CeedQFunctionField qf_field = is_input ? qf_input_fields[i] : qf_output_fields[i - num_input_fields];
+    CeedInt            size;
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, &data->eval_modes[i]));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, &size));
+    CeedCallBackend(CeedOperatorFieldGetVector(op_field, &data->vecs[i]));
+    if (!is_input && data->vecs[i] != CEED_VECTOR_ACTIVE) data->has_passive_out = true;
+    data->q_sizes[i] = (CeedSize)Q * size * blk_size;
+    if (data->eval_modes[i] != CEED_EVAL_WEIGHT) {
+      CeedInt elem_size, num_comp;
+
+      if (blk_restr) data->blk_restr[i] = blk_restr[i];
+      else CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &data->blk_restr[i]));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(data->blk_restr[i], &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(data->blk_restr[i], &num_comp));
+      data->e_sizes[i] = (CeedSize)elem_size * num_comp * blk_size;
+    }
+    switch (data->eval_modes[i]) {
+      case CEED_EVAL_NONE:
+        break;
+      case CEED_EVAL_INTERP:
+      case CEED_EVAL_GRAD:
+      case CEED_EVAL_DIV:
+      case CEED_EVAL_WEIGHT: {
+        Ceed basis_ceed;
+        bool is_delegate;
+
+        CeedCallBackend(CeedOperatorFieldGetBasis(op_field, &data->bases[i]));
+        CeedCallBackend(CeedBasisGetCeed(data->bases[i], &basis_ceed));
+        CeedCallBackend(CeedOperatorRangeIsDelegate_Ref(ceed, basis_ceed, &is_delegate));
+        data->is_concurrent = data->is_concurrent && is_delegate;
+        // Quadrature weights are the same for all blocks
+        if (data->eval_modes[i] == CEED_EVAL_WEIGHT && is_delegate) {
+          CeedCallBackend(CeedMalloc(data->q_sizes[i], &data->q_weights[i]));
+          CeedCallBackend(CeedBasisApplyCore_Ref(data->bases[i], blk_size, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, NULL, data->q_weights[i]));
+        }
+      } break;
+      case CEED_EVAL_CURL:
+        data->is_concurrent = false;
+        break;
+    }
+  }
+  *range = data;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Get Access to Range Work Data and Shared Objects, Called with the Thread Lock Held
+//   Arrays are only stored once access is granted, so a partial failure can be undone with CeedOperatorRangeRestoreAccess_Ref()
+//------------------------------------------------------------------------------
+static int CeedOperatorRangeGetAccess_Ref(CeedOperator op, CeedOperatorRange_Ref *range, CeedVector in_vec, CeedVector out_vec,
+                                          CeedOperatorRangeSlot_Ref **slot, const CeedScalar **arrays_in, CeedScalar **arrays_out,
+                                          void **ctx_data) {
+  const CeedInt        num_fields = range->num_inputs + range->num_outputs;
+  CeedQFunction        qf;
+  CeedQFunctionContext ctx;
+
+  // Free work slot, a new one is added for each concurrent caller
+  for (CeedInt s = 0; s < range->num_slots && !*slot; s++) {
+    if (!range->slots[s]->is_in_use) *slot = range->slots[s];
+  }
+  if (!*slot) {
+    CeedOperatorRangeSlot_Ref *new_slot;
+
+    CeedCallBackend(CeedCalloc(1, &new_slot));
+    CeedCallBackend(CeedRealloc(range->num_slots + 1, &range->slots));
+    range->slots[range->num_slots++] = new_slot;
+    for (CeedInt i = 0; i < num_fields; i++) {
+      if (range->eval_modes[i] == CEED_EVAL_WEIGHT) continue;
+      CeedCallBackend(CeedMalloc(range->e_sizes[i], &new_slot->e_data[i]));
+      if (range->eval_modes[i] != CEED_EVAL_NONE) CeedCallBackend(CeedMalloc(range->q_sizes[i], &new_slot->q_data[i]));
+    }
+    *slot = new_slot;
+  }
+  (*slot)->is_in_use = true;
+
+  // Input and output arrays
+  for (CeedInt i = 0; i < num_fields; i++) {
+    const bool is_input = i < range->num_inputs;
+    CeedVector vec      = range->vecs[i];
+
+    if (range->eval_modes[i] == CEED_EVAL_WEIGHT) continue;
+    if (vec == CEED_VECTOR_ACTIVE) vec = is_input ? in_vec : out_vec;
+    if (is_input) {
+      CeedCallBackend(CeedVectorGetArrayRead(vec, CEED_MEM_HOST, &arrays_in[i]));
+    } else {
+      CeedVector vec_j = NULL;
+      CeedInt    j     = range->num_inputs;
+
+      // Outputs summing into the same vector share its array
+      for (; j < i; j++) {
+        vec_j = range->vecs[j] == CEED_VECTOR_ACTIVE ? out_vec : range->vecs[j];
+        if (vec_j == vec) break;
+      }
+      if (j < i) arrays_out[i - range->num_inputs] = arrays_out[j - range->num_inputs];
+      else CeedCallBackend(CeedVectorGetArray(vec, CEED_MEM_HOST, &arrays_out[i - range->num_inputs]));
+    }
+  }
+
+  // QFunction context, applications may run concurrently so the QFunction only reads it
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+  if (ctx) CeedCallBackend(CeedQFunctionContextGetDataRead(ctx, CEED_MEM_HOST, ctx_data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Restore Access to Range Work Data and Shared Objects, Called with the Thread Lock Held
+//------------------------------------------------------------------------------
+static int CeedOperatorRangeRestoreAccess_Ref(CeedOperator op, CeedOperatorRange_Ref *range, CeedVector in_vec, CeedVector out_vec,
+                                              CeedOperatorRangeSlot_Ref *slot, const CeedScalar **arrays_in, CeedScalar **arrays_out,
+                                              void **ctx_data) {
+  const CeedInt        num_fields = range->num_inputs + range->num_outputs;
+  CeedQFunction        qf;
+  CeedQFunctionContext ctx;
+
+  for (CeedInt i = 0; i < num_fields; i++) {
+    const bool is_input = i < range->num_inputs;
+    CeedVector vec      = range->vecs[i];
+
+    if (vec == CEED_VECTOR_ACTIVE) vec = is_input ? in_vec : out_vec;
+    if (is_input) {
+      if (arrays_in[i]) CeedCallBackend(CeedVectorRestoreArrayRead(vec, &arrays_in[i]));
+    } else {
+      CeedScalar *array = arrays_out[i - range->num_inputs];
+
+      if (!array) continue;
+      // Shared arrays are restored once
+      for (CeedInt j = i; j < num_fields; j++) {
+        if (arrays_out[j - range->num_inputs] == array) arrays_out[j - range->num_inputs] = NULL;
+      }
+      CeedCallBackend(CeedVectorRestoreArray(vec, &array));
+    }
+  }
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedCallBackend(CeedQFunctionGetContext(qf, &ctx));
+  if (*ctx_data) CeedCallBackend(CeedQFunctionContextRestoreDataRead(ctx, ctx_data));
+  if (slot) slot->is_in_use = false;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Element Loop on Raw Pointers
+//   Only touches the work slot and the arrays it is given, so callers with their own slot and output arrays can run concurrently
+//------------------------------------------------------------------------------
+static int CeedOperatorRangeApplyBlocks_Ref(CeedOperator op, CeedOperatorRange_Ref *range, CeedOperatorRangeSlot_Ref *slot, CeedInt e_start,
+                                            CeedInt e_end, const CeedScalar **arrays_in, CeedScalar **arrays_out, void *ctx_data) {
+  const CeedInt blk_size = range->blk_size, num_inputs = range->num_inputs, num_outputs = range->num_outputs;
+  const CeedInt blk_start = e_start / blk_size, blk_end = (e_end / blk_size) + !!(e_end % blk_size);
+  CeedInt       Q, num_elem;
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  // Padding lanes past num_elem are never summed into the L-vector, so they need no mask
+  if (e_end == num_elem) e_end = blk_end * blk_size;
+  CeedQFunction qf;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedQFunctionUser f = NULL;
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  const CeedScalar *q_in[CEED_FIELD_MAX]  = {0};
+  CeedScalar       *q_out[CEED_FIELD_MAX] = {0};
+
+  for (CeedInt b = blk_start; b < blk_end; b++) {
+    const CeedInt e = b * blk_size;
+
+    // Input restriction and basis apply
+    for (CeedInt i = 0; i < num_inputs; i++) {
+      const CeedEvalMode eval_mode = range->eval_modes[i];
+
+      if (eval_mode == CEED_EVAL_WEIGHT) {
+        q_in[i] = range->q_weights[i];
+        continue;
+      }
+      CeedCallBackend(CeedElemRestrictionApplyArrays_Ref(range->blk_restr[i], b, b + 1, b * range->e_sizes[i], CEED_NOTRANSPOSE, arrays_in[i],
+                                                         slot->e_data[i]));
+      if (eval_mode == CEED_EVAL_NONE) {
+        q_in[i] = slot->e_data[i];
+      } else {
+        CeedCallBackend(CeedBasisApplyWork_Ref(range->bases[i], blk_size, CEED_NOTRANSPOSE, eval_mode, slot->e_data[i], slot->q_data[i],
+                                               &slot->work, &slot->work_size));
+        q_in[i] = slot->q_data[i];
+      }
+    }
+    // Output pointers
+    for (CeedInt i = 0; i < num_outputs; i++) {
+      const CeedInt j = i + num_inputs;
+
+      q_out[i] = range->eval_modes[j] == CEED_EVAL_NONE ? slot->e_data[j] : slot->q_data[j];
+    }
+
+    // Q function
+    CeedCallBackend(f(ctx_data, Q * blk_size, q_in, q_out));
+
+    // Output basis apply, mask, and restriction
+    for (CeedInt i = 0; i < num_outputs; i++) {
+      const CeedInt      j         = i + num_inputs;
+      const CeedEvalMode eval_mode = range->eval_modes[j];
+
+      if (eval_mode != CEED_EVAL_NONE) {
+        CeedCallBackend(CeedBasisApplyWork_Ref(range->bases[j], blk_size, CEED_TRANSPOSE, eval_mode, slot->q_data[j], slot->e_data[j], &slot->work,
+                                               &slot->work_size));
+      }
+      // Blocked E-vectors interlace the elements of a block, so lanes outside of the range in partial blocks are zeroed
+      if (e < e_start || e + blk_size > e_end) {
+        for (CeedInt l = 0; l < blk_size; l++) {
+          if (e + l >= e_start && e + l < e_end) continue;
+          for (CeedSize k = 0; k < range->e_sizes[j] / blk_size; k++) slot->e_data[j][k * blk_size + l] = 0.0;
+        }
+      }
+      CeedCallBackend(
+          CeedElemRestrictionApplyArrays_Ref(range->blk_restr[j], b, b + 1, b * range->e_sizes[j], CEED_TRANSPOSE, slot->e_data[j], arrays_out[i]));
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Apply Elements [e_start, e_end) with Element Range Data
+//   The element loop runs without the thread lock, so range applications of the same operator into different output vectors run concurrently
+//------------------------------------------------------------------------------
+int CeedOperatorRangeApply_Ref(CeedOperator op, CeedOperatorRange_Ref *range, CeedInt e_start, CeedInt e_end, CeedVector in_vec,
+                               CeedVector out_vec) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperatorRangeSlot_Ref *slot                       = NULL;
+  const CeedScalar          *arrays_in[CEED_FIELD_MAX]  = {0};
+  CeedScalar                *arrays_out[CEED_FIELD_MAX] = {0};
+  void                      *ctx_data                   = NULL;
+  int                        ierr, ierr_restore;
+  // Passive outputs are shared between callers, so their sums are serialized
+  const bool is_locked = range->has_passive_out;
+
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorRangeGetAccess_Ref(op, range, in_vec, out_vec, &slot, arrays_in, arrays_out, &ctx_data);
+  if (!is_locked) CeedCallBackend(CeedThreadUnlock(ceed));
+  if (ierr == CEED_ERROR_SUCCESS) ierr = CeedOperatorRangeApplyBlocks_Ref(op, range, slot, e_start, e_end, arrays_in, arrays_out, ctx_data);
+  if (!is_locked) CeedCallBackend(CeedThreadLock(ceed));
+  ierr_restore = CeedOperatorRangeRestoreAccess_Ref(op, range, in_vec, out_vec, slot, arrays_in, arrays_out, &ctx_data);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  CeedCallBackend(ierr_restore);
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Destroy Element Range Data
+//------------------------------------------------------------------------------
+int CeedOperatorRangeDestroy_Ref(CeedOperatorRange_Ref **range) {
+  if (!*range) return CEED_ERROR_SUCCESS;
+  for (CeedInt s = 0; s < (*range)->num_slots; s++) {
+    for (CeedInt i = 0; i < 2 * CEED_FIELD_MAX; i++) {
+      CeedCallBackend(CeedFree(&(*range)->slots[s]->e_data[i]));
+      CeedCallBackend(CeedFree(&(*range)->slots[s]->q_data[i]));
+    }
+    CeedCallBackend(CeedFree(&(*range)->slots[s]->work));
+    CeedCallBackend(CeedFree(&(*range)->slots[s]));
+  }
+  CeedCallBackend(CeedFree(&(*range)->slots));
+  for (CeedInt i = 0; i < CEED_FIELD_MAX; i++) CeedCallBackend(CeedFree(&(*range)->q_weights[i]));
+  CeedCallBackend(CeedFree(range));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "ceed-ref.h"
 
@@ -133,17 +134,67 @@ static int CeedOperatorSetup_Ref(CeedOperator op) {
     }
   }
 
+  // Field data for the raw pointer element loop
+  //   Only used when the QFunction and bases belong to this Ceed and it has no parent, such as the memcheck backend, intercepting their apply
+  Ceed parent, qf_ceed;
+  CeedCallBackend(CeedGetParent(ceed, &parent));
+  CeedCallBackend(CeedQFunctionGetCeed(qf, &qf_ceed));
+  impl->use_raw_ptrs = !impl->is_identity_qf && parent == ceed && qf_ceed == ceed;
+  for (CeedInt i = 0; i < num_input_fields + num_output_fields; i++) {
+    const bool          is_input  = i < num_input_fields;
+    const CeedInt       field     = is_input ? i : i - num_input_fields;
+    CeedOperatorField   op_field  = is_input ? op_input_fields[field] : op_output_fields[field];
+    CeedQFunctionField  qf_field  = is_input ? qf_input_fields[field] : qf_output_fields[field];
+    CeedEvalMode       *eval_mode = is_input ? &impl->eval_modes_in[field] : &impl->eval_modes_out[field];
+    CeedInt            *e_size    = is_input ? &impl->e_sizes_in[field] : &impl->e_sizes_out[field];
+    CeedInt            *q_size    = is_input ? &impl->q_sizes_in[field] : &impl->q_sizes_out[field];
+    CeedBasis          *basis     = is_input ? &impl->bases_in[field] : &impl->bases_out[field];
+
+    CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_field, eval_mode));
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_field, q_size));
+    *q_size *= Q;
+    if (*eval_mode != CEED_EVAL_WEIGHT) {
+      CeedElemRestriction elem_restr;
+      CeedInt             elem_size, num_comp;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_field, &elem_restr));
+      CeedCallBackend(CeedElemRestrictionGetElementSize(elem_restr, &elem_size));
+      CeedCallBackend(CeedElemRestrictionGetNumComponents(elem_restr, &num_comp));
+      *e_size = elem_size * num_comp;
+    }
+    if (*eval_mode == CEED_EVAL_INTERP || *eval_mode == CEED_EVAL_GRAD || *eval_mode == CEED_EVAL_DIV) {
+      Ceed basis_ceed;
+      CeedCallBackend(CeedOperatorFieldGetBasis(op_field, basis));
+      CeedCallBackend(CeedBasisGetCeed(*basis, &basis_ceed));
+      impl->use_raw_ptrs = impl->use_raw_ptrs && basis_ceed == ceed;
+    }
+    if (*eval_mode == CEED_EVAL_CURL) impl->use_raw_ptrs = false;
+  }
+
   CeedCallBackend(CeedOperatorSetSetupDone(op));
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Restrict a Range of Elements
+//   E-vectors always hold all elements, only the entries for elements [e_start, e_end) are touched
+//------------------------------------------------------------------------------
+static inline int CeedOperatorRestrictRange_Ref(CeedElemRestriction elem_restr, CeedInt e_start, CeedInt e_end, CeedTransposeMode t_mode,
+                                                CeedVector u, CeedVector v, CeedRequest *request) {
+  CeedInt num_elem;
+  CeedCallBackend(CeedElemRestrictionGetNumElements(elem_restr, &num_elem));
+  if (e_start == 0 && e_end == num_elem) CeedCallBackend(CeedElemRestrictionApply(elem_restr, t_mode, u, v, request));
+  else CeedCallBackend(CeedElemRestrictionApplyBlockRange(elem_restr, e_start, e_end, t_mode, u, v, request));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Setup Operator Inputs
 //------------------------------------------------------------------------------
 static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                              CeedVector in_vec, const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
-                                              CeedOperator_Ref *impl, CeedRequest *request) {
+                                              CeedVector in_vec, const bool skip_active, CeedVector *e_vecs_active, CeedInt e_start,
+                                              CeedInt e_end, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl,
+                                              CeedRequest *request) {
   CeedEvalMode        eval_mode;
   CeedVector          vec;
   CeedElemRestriction elem_restr;
@@ -161,16 +212,27 @@ static inline int CeedOperatorSetupInputs_Ref(CeedInt num_input_fields, CeedQFun
     // Restrict and Evec
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
+      CeedVector e_vec = impl->e_vecs_full[i];
+
       // Restrict
       CeedCallBackend(CeedVectorGetState(vec, &state));
       // Skip restriction if input is unchanged
-      if (state != impl->input_states[i] || vec == in_vec) {
+      if (vec == in_vec) {
+        // Active input only needs the elements in range, or is already restricted by a fused composite CeedOperator
+        if (e_vecs_active) {
+          e_vec = e_vecs_active[i];
+        } else {
+          CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr));
+          CeedCallBackend(CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end, CEED_NOTRANSPOSE, vec, e_vec, request));
+        }
+        impl->input_states[i] = state;
+      } else if (state != impl->input_states[i]) {
         CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[i], &elem_restr));
-        CeedCallBackend(CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec, impl->e_vecs_full[i], request));
+        CeedCallBackend(CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, vec, e_vec, request));
         impl->input_states[i] = state;
       }
       // Get evec
-      CeedCallBackend(CeedVectorGetArrayRead(impl->e_vecs_full[i], CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
+      CeedCallBackend(CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST, (const CeedScalar **)&e_data_full[i]));
     }
   }
   return CEED_ERROR_SUCCESS;
@@ -202,24 +264,24 @@ static inline int CeedOperatorInputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunction
     // Basis action
     switch (eval_mode) {
       case CEED_EVAL_NONE:
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * Q * size]));
+        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * Q * size]));
         break;
       case CEED_EVAL_INTERP:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_GRAD:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_DIV:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_input_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_in[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_DIV, impl->e_vecs_in[i], impl->q_vecs_in[i]));
         break;
       case CEED_EVAL_WEIGHT:
@@ -260,22 +322,22 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctio
       case CEED_EVAL_INTERP:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_TRANSPOSE, CEED_EVAL_INTERP, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       case CEED_EVAL_GRAD:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_TRANSPOSE, CEED_EVAL_GRAD, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       case CEED_EVAL_DIV:
         CeedCallBackend(CeedOperatorFieldGetBasis(op_output_fields[i], &basis));
         CeedCallBackend(CeedBasisGetNumComponents(basis, &num_comp));
-        CeedCallBackend(
-            CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * elem_size * num_comp]));
+        CeedCallBackend(CeedVectorSetArray(impl->e_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                           &e_data_full[i + num_input_fields][(CeedSize)e * elem_size * num_comp]));
         CeedCallBackend(CeedBasisApply(basis, 1, CEED_TRANSPOSE, CEED_EVAL_DIV, impl->q_vecs_out[i], impl->e_vecs_out[i]));
         break;
       // LCOV_EXCL_START
@@ -301,37 +363,123 @@ static inline int CeedOperatorOutputBasis_Ref(CeedInt e, CeedInt Q, CeedQFunctio
 // Restore Input Vectors
 //------------------------------------------------------------------------------
 static inline int CeedOperatorRestoreInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
-                                                const bool skip_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
+                                                const bool skip_active, CeedVector *e_vecs_active, CeedScalar *e_data_full[2 * CEED_FIELD_MAX],
+                                                CeedOperator_Ref *impl) {
   CeedEvalMode eval_mode;
+  CeedVector   vec;
 
   for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
     // Skip active inputs
-    if (skip_active) {
-      CeedVector vec;
-      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
-      if (vec == CEED_VECTOR_ACTIVE) continue;
-    }
+    if (skip_active && vec == CEED_VECTOR_ACTIVE) continue;
     // Restore input
     CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_input_fields[i], &eval_mode));
     if (eval_mode == CEED_EVAL_WEIGHT) {  // Skip
     } else {
-      CeedCallBackend(CeedVectorRestoreArrayRead(impl->e_vecs_full[i], (const CeedScalar **)&e_data_full[i]));
+      CeedVector e_vec = (vec == CEED_VECTOR_ACTIVE && e_vecs_active) ? e_vecs_active[i] : impl->e_vecs_full[i];
+
+      CeedCallBackend(CeedVectorRestoreArrayRead(e_vec, (const CeedScalar **)&e_data_full[i]));
     }
   }
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// Operator Apply
+// Element Loop on Raw Pointers
+//   Calls the basis and user QFunction directly on host arrays, so the loop does not touch the CeedVector API
 //------------------------------------------------------------------------------
-static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+static int CeedOperatorApplyElements_Ref(CeedOperator op, CeedInt e_start, CeedInt e_end, CeedInt num_input_fields, CeedInt num_output_fields,
+                                         CeedScalar *e_data_full[2 * CEED_FIELD_MAX], CeedOperator_Ref *impl) {
+  CeedQFunction qf;
+  CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
+  CeedQFunctionUser f = NULL;
+  CeedCallBackend(CeedQFunctionGetUserFunction(qf, &f));
+  void *ctx_data = NULL;
+  CeedCallBackend(CeedQFunctionGetContextData(qf, CEED_MEM_HOST, &ctx_data));
+  CeedInt Q;
+  CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
+  CeedScalar       *q_data_in[CEED_FIELD_MAX] = {0}, *q_data_out[CEED_FIELD_MAX] = {0};
+  const CeedScalar *q_in[CEED_FIELD_MAX]      = {0};
+  CeedScalar       *q_out[CEED_FIELD_MAX]     = {0};
+
+  // Q-vector arrays are held for the whole loop
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    switch (impl->eval_modes_in[i]) {
+      case CEED_EVAL_NONE:
+        break;
+      case CEED_EVAL_WEIGHT:  // Weights computed in setup
+        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &q_data_in[i]));
+        break;
+      default:
+        CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_in[i], CEED_MEM_HOST, &q_data_in[i]));
+        break;
+    }
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    if (impl->eval_modes_out[i] != CEED_EVAL_NONE) CeedCallBackend(CeedVectorGetArrayWrite(impl->q_vecs_out[i], CEED_MEM_HOST, &q_data_out[i]));
+  }
+
+  for (CeedInt e = e_start; e < e_end; e++) {
+    // Input basis apply
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      const CeedEvalMode eval_mode = impl->eval_modes_in[i];
+      switch (eval_mode) {
+        case CEED_EVAL_NONE:
+          q_in[i] = &e_data_full[i][(CeedSize)e * impl->q_sizes_in[i]];
+          break;
+        case CEED_EVAL_INTERP:
+        case CEED_EVAL_GRAD:
+        case CEED_EVAL_DIV:
+          CeedCallBackend(CeedBasisApplyCore_Ref(impl->bases_in[i], 1, CEED_NOTRANSPOSE, eval_mode,
+                                                 &e_data_full[i][(CeedSize)e * impl->e_sizes_in[i]], q_data_in[i]));
+          q_in[i] = q_data_in[i];
+          break;
+        default:  // CEED_EVAL_WEIGHT
+          q_in[i] = q_data_in[i];
+          break;
+      }
+    }
+    // Output pointers
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      if (impl->eval_modes_out[i] == CEED_EVAL_NONE) q_out[i] = &e_data_full[i + num_input_fields][(CeedSize)e * impl->q_sizes_out[i]];
+      else q_out[i] = q_data_out[i];
+    }
+
+    // Q function
+    CeedCallBackend(f(ctx_data, Q, q_in, q_out));
+
+    // Output basis apply
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      const CeedEvalMode eval_mode = impl->eval_modes_out[i];
+      if (eval_mode == CEED_EVAL_NONE) continue;
+      CeedCallBackend(CeedBasisApplyCore_Ref(impl->bases_out[i], 1, CEED_TRANSPOSE, eval_mode, q_data_out[i],
+                                             &e_data_full[i + num_input_fields][(CeedSize)e * impl->e_sizes_out[i]]));
+    }
+  }
+
+  // Restore Q-vector arrays
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    if (q_data_in[i]) CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &q_data_in[i]));
+  }
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    if (q_data_out[i]) CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_out[i], &q_data_out[i]));
+  }
+  CeedCallBackend(CeedQFunctionRestoreContextData(qf, &ctx_data));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on Elements [e_start, e_end)
+//   With e_vecs_active, active inputs are read from E-vectors restricted by the caller and active outputs are left in E-vectors
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddCore_Ref(CeedOperator op, CeedInt e_start, CeedInt e_end, CeedVector in_vec, CeedVector out_vec,
+                                        CeedVector *e_vecs_active, CeedRequest *request) {
   CeedOperator_Ref *impl;
   CeedCallBackend(CeedOperatorGetData(op, &impl));
   CeedQFunction qf;
   CeedCallBackend(CeedOperatorGetQFunction(op, &qf));
-  CeedInt Q, num_elem, num_input_fields, num_output_fields, size;
+  CeedInt Q, num_input_fields, num_output_fields, size;
   CeedCallBackend(CeedOperatorGetNumQuadraturePoints(op, &Q));
-  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
   CeedOperatorField *op_input_fields, *op_output_fields;
   CeedCallBackend(CeedOperatorGetFields(op, &num_input_fields, &op_input_fields, &num_output_fields, &op_output_fields));
   CeedQFunctionField *qf_input_fields, *qf_output_fields;
@@ -340,6 +488,10 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
   CeedVector          vec;
   CeedElemRestriction elem_restr;
   CeedScalar         *e_data_full[2 * CEED_FIELD_MAX] = {0};
+  Ceed                ceed;
+  bool                is_profiling;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
 
   // Setup
   CeedCallBackend(CeedOperatorSetup_Ref(op));
@@ -347,42 +499,48 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
   // Restriction only operator
   if (impl->is_identity_restr_op) {
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[0], &elem_restr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_restr, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
+    CeedCallBackend(CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end, CEED_NOTRANSPOSE, in_vec, impl->e_vecs_full[0], request));
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[0], &elem_restr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
+    CeedCallBackend(CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end, CEED_TRANSPOSE, impl->e_vecs_full[0], out_vec, request));
     return CEED_ERROR_SUCCESS;
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_data_full, impl, request));
+  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, in_vec, false, e_vecs_active, e_start, e_end,
+                                              e_data_full, impl, request));
 
   // Output Evecs
   for (CeedInt i = 0; i < num_output_fields; i++) {
     CeedCallBackend(CeedVectorGetArrayWrite(impl->e_vecs_full[i + impl->num_inputs], CEED_MEM_HOST, &e_data_full[i + num_input_fields]));
   }
 
-  // Loop through elements
-  for (CeedInt e = 0; e < num_elem; e++) {
-    // Output pointers
-    for (CeedInt i = 0; i < num_output_fields; i++) {
-      CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
-      if (eval_mode == CEED_EVAL_NONE) {
-        CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
-        CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER, &e_data_full[i + num_input_fields][e * Q * size]));
+  // Loop through elements, through the CeedBasis and CeedQFunction interfaces when profiling so each phase is recorded
+  if (impl->use_raw_ptrs && !is_profiling) {
+    CeedCallBackend(CeedOperatorApplyElements_Ref(op, e_start, e_end, num_input_fields, num_output_fields, e_data_full, impl));
+  } else {
+    for (CeedInt e = e_start; e < e_end; e++) {
+      // Output pointers
+      for (CeedInt i = 0; i < num_output_fields; i++) {
+        CeedCallBackend(CeedQFunctionFieldGetEvalMode(qf_output_fields[i], &eval_mode));
+        if (eval_mode == CEED_EVAL_NONE) {
+          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[i], CEED_MEM_HOST, CEED_USE_POINTER,
+                                             &e_data_full[i + num_input_fields][(CeedSize)e * Q * size]));
+        }
       }
-    }
 
-    // Input basis apply
-    CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
+      // Input basis apply
+      CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, false, e_data_full, impl));
 
-    // Q function
-    if (!impl->is_identity_qf) {
-      CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
-    }
+      // Q function
+      if (!impl->is_identity_qf) {
+        CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
+      }
 
-    // Output basis apply
-    CeedCallBackend(
-        CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields, op, e_data_full, impl));
+      // Output basis apply
+      CeedCallBackend(
+          CeedOperatorOutputBasis_Ref(e, Q, qf_output_fields, op_output_fields, num_input_fields, num_output_fields, op, e_data_full, impl));
+    }
   }
 
   // Output restriction
@@ -392,15 +550,237 @@ static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVect
     // Get output vector
     CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
     // Active
-    if (vec == CEED_VECTOR_ACTIVE) vec = out_vec;
+    if (vec == CEED_VECTOR_ACTIVE) {
+      if (e_vecs_active) continue;
+      vec = out_vec;
+    }
     // Restrict
     CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[i], &elem_restr));
-    CeedCallBackend(CeedElemRestrictionApply(elem_restr, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
+    CeedCallBackend(CeedOperatorRestrictRange_Ref(elem_restr, e_start, e_end, CEED_TRANSPOSE, impl->e_vecs_full[i + impl->num_inputs], vec, request));
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, false, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, false, e_vecs_active, e_data_full, impl));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAdd_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  CeedInt num_elem;
+  CeedCallBackend(CeedOperatorGetNumElements(op, &num_elem));
+  CeedCallBackend(CeedOperatorApplyAddCore_Ref(op, 0, num_elem, in_vec, out_vec, NULL, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Range Setup and Serialized Range Apply, Called with the Thread Lock Held
+//------------------------------------------------------------------------------
+static inline int CeedOperatorApplyAddRangeSerial_Ref(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                                      bool *is_serial, CeedRequest *request) {
+  CeedOperator_Ref *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  bool is_profiling;
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
 
+  // Setup
+  CeedCallBackend(CeedOperatorSetup_Ref(op));
+  if (!impl->range) CeedCallBackend(CeedOperatorRangeCreate_Ref(op, 1, NULL, &impl->range));
+
+  // Phases are profiled through the libCEED interfaces, and some objects intercept their apply, so these applications are serialized
+  *is_serial = is_profiling || !impl->range->is_concurrent;
+  if (*is_serial) CeedCallBackend(CeedOperatorApplyAddCore_Ref(op, elem_start, elem_stop, in_vec, out_vec, NULL, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Operator Apply on a Range of Elements
+//   Range applications into different output vectors run concurrently on the element range data
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddRange_Ref(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in_vec, CeedVector out_vec,
+                                         CeedRequest *request) {
+  CeedOperator_Ref *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  bool is_serial = true;
+  int  ierr;
+
+  CeedCallBackend(CeedThreadLock(ceed));
+  ierr = CeedOperatorApplyAddRangeSerial_Ref(op, elem_start, elem_stop, in_vec, out_vec, &is_serial, request);
+  CeedCallBackend(CeedThreadUnlock(ceed));
+  CeedCallBackend(ierr);
+  if (!is_serial) CeedCallBackend(CeedOperatorRangeApply_Ref(op, impl->range, elem_start, elem_stop, in_vec, out_vec));
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Composite Operator Apply
+//   Active inputs are restricted once for each CeedElemRestriction shared by the sub-operators, and the active outputs of sub-operators that share
+//   a CeedElemRestriction are summed in E-vector form and scattered with a single transpose
+//------------------------------------------------------------------------------
+static int CeedOperatorApplyAddComposite_Ref(CeedOperator op, CeedVector in_vec, CeedVector out_vec, CeedRequest *request) {
+  bool                       is_profiling, is_fused;
+  Ceed                       ceed;
+  CeedInt                    num_sub, num_rstr_out = 0;
+  CeedOperator              *sub_operators;
+  CeedOperatorComposite_Ref *impl_comp;
+  CeedElemRestriction        rstr_out[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];
+  CeedVector                 e_vecs_active[CEED_COMPOSITE_MAX][CEED_FIELD_MAX], e_vecs_out[CEED_COMPOSITE_MAX * CEED_FIELD_MAX];
+
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedCallBackend(CeedOperatorGetData(op, &impl_comp));
+  CeedCallBackend(CeedIsProfiling(ceed, &is_profiling));
+  CeedCallBackend(CeedCompositeOperatorGetNumSub(op, &num_sub));
+  CeedCallBackend(CeedCompositeOperatorGetSubList(op, &sub_operators));
+
+  // Only sub-operators from this backend are fused, and profiling records each sub-operator separately
+  is_fused = !is_profiling;
+  for (CeedInt i = 0; i < num_sub && is_fused; i++) {
+    bool is_composite;
+    Ceed sub_ceed;
+    CeedCallBackend(CeedOperatorIsComposite(sub_operators[i], &is_composite));
+    CeedCallBackend(CeedOperatorGetCeed(sub_operators[i], &sub_ceed));
+    is_fused = !is_composite && sub_ceed == ceed;
+  }
+  for (CeedInt i = 0; i < num_sub && is_fused; i++) {
+    CeedOperator_Ref *impl;
+    CeedCallBackend(CeedOperatorSetup_Ref(sub_operators[i]));
+    CeedCallBackend(CeedOperatorGetData(sub_operators[i], &impl));
+    is_fused = !impl->is_identity_restr_op;
+  }
+  if (!is_fused) {
+    for (CeedInt i = 0; i < num_sub; i++) CeedCallBackend(CeedOperatorApplyAdd(sub_operators[i], in_vec, out_vec, request));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Active inputs with the same CeedElemRestriction share an E-vector owned by the composite CeedOperator
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt            num_input_fields;
+    CeedOperatorField *op_input_fields;
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[i], &num_input_fields, &op_input_fields, NULL, NULL));
+    for (CeedInt j = 0; j < num_input_fields; j++) {
+      CeedInt             k = 0;
+      CeedVector          vec;
+      CeedElemRestriction elem_restr;
+
+      e_vecs_active[i][j] = NULL;
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[j], &vec));
+      if (vec != CEED_VECTOR_ACTIVE) continue;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_input_fields[j], &elem_restr));
+      while (k < impl_comp->num_rstr_in && impl_comp->rstr_in[k] != elem_restr) k++;
+      if (k == impl_comp->num_rstr_in) {
+        CeedCallBackend(CeedElemRestrictionReferenceCopy(elem_restr, &impl_comp->rstr_in[k]));
+        CeedCallBackend(CeedElemRestrictionCreateVector(elem_restr, NULL, &impl_comp->e_vecs_in[k]));
+        impl_comp->num_rstr_in++;
+      }
+      e_vecs_active[i][j] = impl_comp->e_vecs_in[k];
+    }
+  }
+
+  // Input restriction
+  for (CeedInt k = 0; k < impl_comp->num_rstr_in; k++) {
+    CeedCallBackend(CeedElemRestrictionApply(impl_comp->rstr_in[k], CEED_NOTRANSPOSE, in_vec, impl_comp->e_vecs_in[k], request));
+  }
+
+  // Element sweeps
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt num_elem;
+    CeedCallBackend(CeedOperatorGetNumElements(sub_operators[i], &num_elem));
+    CeedCallBackend(CeedOperatorApplyAddCore_Ref(sub_operators[i], 0, num_elem, in_vec, out_vec, e_vecs_active[i], request));
+  }
+
+  // Sum active output E-vectors with the same CeedElemRestriction
+  for (CeedInt i = 0; i < num_sub; i++) {
+    CeedInt            num_output_fields;
+    CeedOperatorField *op_output_fields;
+    CeedOperator_Ref  *impl;
+    CeedCallBackend(CeedOperatorGetData(sub_operators[i], &impl));
+    CeedCallBackend(CeedOperatorGetFields(sub_operators[i], NULL, NULL, &num_output_fields, &op_output_fields));
+    for (CeedInt j = 0; j < num_output_fields; j++) {
+      CeedInt             k = 0;
+      CeedVector          vec;
+      CeedElemRestriction elem_restr;
+
+      CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[j], &vec));
+      if (vec != CEED_VECTOR_ACTIVE) continue;
+      CeedCallBackend(CeedOperatorFieldGetElemRestriction(op_output_fields[j], &elem_restr));
+      while (k < num_rstr_out && rstr_out[k] != elem_restr) k++;
+      if (k == num_rstr_out) {
+        rstr_out[k]   = elem_restr;
+        e_vecs_out[k] = impl->e_vecs_full[j + impl->num_inputs];
+        num_rstr_out++;
+      } else {
+        CeedCallBackend(CeedVectorAXPY(e_vecs_out[k], 1.0, impl->e_vecs_full[j + impl->num_inputs]));
+      }
+    }
+  }
+
+  // Output restriction
+  for (CeedInt k = 0; k < num_rstr_out; k++) {
+    CeedCallBackend(CeedElemRestrictionApply(rstr_out[k], CEED_TRANSPOSE, e_vecs_out[k], out_vec, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Replicate Passive QFunction Inputs for Batched Assembly
+//------------------------------------------------------------------------------
+static inline int CeedOperatorSetupBatchInputs_Ref(CeedInt num_input_fields, CeedQFunctionField *qf_input_fields, CeedOperatorField *op_input_fields,
+                                                   CeedInt num_active_in, CeedInt num_points, CeedOperator_Ref *impl) {
+  for (CeedInt i = 0; i < num_input_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_in;
+    CeedScalar       *q_batch;
+    // Active inputs hold fixed unit vectors
+    CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+    if (vec == CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->q_vecs_in[i], CEED_MEM_HOST, &q_in));
+    CeedCallBackend(CeedVectorGetArrayWrite(impl->qf_batch_in[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&q_batch[(field * num_active_in + in) * num_points], &q_in[field * num_points], num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->q_vecs_in[i], &q_in));
+    CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &q_batch));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// Copy Batched QFunction Outputs into Assembled Layout
+//------------------------------------------------------------------------------
+static inline int CeedOperatorAssembleBatchOutputs_Ref(CeedInt num_output_fields, CeedQFunctionField *qf_output_fields,
+                                                       CeedOperatorField *op_output_fields, CeedInt num_active_in, CeedInt num_active_out,
+                                                       CeedInt num_points, CeedScalar *assembled, CeedOperator_Ref *impl) {
+  CeedInt active_offset = 0;
+  for (CeedInt i = 0; i < num_output_fields; i++) {
+    CeedInt           size;
+    CeedVector        vec;
+    const CeedScalar *q_batch;
+    // Skip passive outputs
+    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[i], &vec));
+    if (vec != CEED_VECTOR_ACTIVE) continue;
+
+    CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+    CeedCallBackend(CeedVectorGetArrayRead(impl->qf_batch_out[i], CEED_MEM_HOST, &q_batch));
+    for (CeedInt field = 0; field < size; field++) {
+      for (CeedInt in = 0; in < num_active_in; in++) {
+        memcpy(&assembled[(in * num_active_out + active_offset + field) * num_points], &q_batch[(field * num_active_in + in) * num_points],
+               num_points * sizeof(CeedScalar));
+      }
+    }
+    CeedCallBackend(CeedVectorRestoreArrayRead(impl->qf_batch_out[i], &q_batch));
+    active_offset += size;
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -423,7 +803,6 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   CeedCallBackend(CeedQFunctionGetFields(qf, NULL, &qf_input_fields, NULL, &qf_output_fields));
   CeedVector  vec;
   CeedInt     num_active_in = impl->num_active_in, num_active_out = impl->num_active_out;
-  CeedVector *active_in = impl->qf_active_in;
   CeedScalar *a, *tmp;
   Ceed        ceed, ceed_parent;
   CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
@@ -442,7 +821,8 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
   }
 
   // Input Evecs and Restriction
-  CeedCallBackend(CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, e_data_full, impl, request));
+  CeedCallBackend(
+      CeedOperatorSetupInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, NULL, true, NULL, 0, num_elem, e_data_full, impl, request));
 
   // Count number of active input fields
   if (!num_active_in) {
@@ -452,20 +832,10 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
       // Check if active input
       if (vec == CEED_VECTOR_ACTIVE) {
         CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
-        CeedCallBackend(CeedVectorSetValue(impl->q_vecs_in[i], 0.0));
-        CeedCallBackend(CeedVectorGetArray(impl->q_vecs_in[i], CEED_MEM_HOST, &tmp));
-        CeedCallBackend(CeedRealloc(num_active_in + size, &active_in));
-        for (CeedInt field = 0; field < size; field++) {
-          q_size = (CeedSize)Q;
-          CeedCallBackend(CeedVectorCreate(ceed, q_size, &active_in[num_active_in + field]));
-          CeedCallBackend(CeedVectorSetArray(active_in[num_active_in + field], CEED_MEM_HOST, CEED_USE_POINTER, &tmp[field * Q]));
-        }
         num_active_in += size;
-        CeedCallBackend(CeedVectorRestoreArray(impl->q_vecs_in[i], &tmp));
       }
     }
     impl->num_active_in = num_active_in;
-    impl->qf_active_in  = active_in;
   }
 
   // Count number of active output fields
@@ -489,6 +859,35 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     // LCOV_EXCL_STOP
   }
 
+  // Batched Q-vectors, with one copy of the quadrature points per active input component
+  if (!impl->qf_batch_in) {
+    CeedInt active_offset = 0;
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_in));
+    CeedCallBackend(CeedCalloc(CEED_FIELD_MAX, &impl->qf_batch_out));
+    for (CeedInt i = 0; i < num_input_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_input_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_in[i]));
+      // Set unit vectors for active input components
+      CeedCallBackend(CeedOperatorFieldGetVector(op_input_fields[i], &vec));
+      if (vec == CEED_VECTOR_ACTIVE) {
+        CeedCallBackend(CeedVectorSetValue(impl->qf_batch_in[i], 0.0));
+        CeedCallBackend(CeedVectorGetArray(impl->qf_batch_in[i], CEED_MEM_HOST, &tmp));
+        for (CeedInt field = 0; field < size; field++) {
+          CeedScalar *unit_in = &tmp[(field * num_active_in + active_offset + field) * Q];
+          for (CeedInt j = 0; j < Q; j++) unit_in[j] = 1.0;
+        }
+        CeedCallBackend(CeedVectorRestoreArray(impl->qf_batch_in[i], &tmp));
+        active_offset += size;
+      }
+    }
+    for (CeedInt i = 0; i < num_output_fields; i++) {
+      CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[i], &size));
+      q_size = (CeedSize)num_active_in * size * Q;
+      CeedCallBackend(CeedVectorCreate(ceed, q_size, &impl->qf_batch_out[i]));
+    }
+  }
+
   // Build objects if needed
   if (build_objects) {
     // Create output restriction
@@ -508,41 +907,16 @@ static inline int CeedOperatorLinearAssembleQFunctionCore_Ref(CeedOperator op, b
     // Input basis apply
     CeedCallBackend(CeedOperatorInputBasis_Ref(e, Q, qf_input_fields, op_input_fields, num_input_fields, true, e_data_full, impl));
 
-    // Assemble QFunction
-    for (CeedInt in = 0; in < num_active_in; in++) {
-      // Set Inputs
-      CeedCallBackend(CeedVectorSetValue(active_in[in], 1.0));
-      if (num_active_in > 1) {
-        CeedCallBackend(CeedVectorSetValue(active_in[(in + num_active_in - 1) % num_active_in], 0.0));
-      }
-      // Set Outputs
-      for (CeedInt out = 0; out < num_output_fields; out++) {
-        // Get output vector
-        CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-        // Check if active output
-        if (vec == CEED_VECTOR_ACTIVE) {
-          CeedCallBackend(CeedVectorSetArray(impl->q_vecs_out[out], CEED_MEM_HOST, CEED_USE_POINTER, a));
-          CeedCallBackend(CeedQFunctionFieldGetSize(qf_output_fields[out], &size));
-          a += size * Q;  // Advance the pointer by the size of the output
-        }
-      }
-      // Apply QFunction
-      CeedCallBackend(CeedQFunctionApply(qf, Q, impl->q_vecs_in, impl->q_vecs_out));
-    }
-  }
-
-  // Un-set output Qvecs to prevent accidental overwrite of Assembled
-  for (CeedInt out = 0; out < num_output_fields; out++) {
-    // Get output vector
-    CeedCallBackend(CeedOperatorFieldGetVector(op_output_fields[out], &vec));
-    // Check if active output
-    if (vec == CEED_VECTOR_ACTIVE && num_elem > 0) {
-      CeedCallBackend(CeedVectorTakeArray(impl->q_vecs_out[out], CEED_MEM_HOST, NULL));
-    }
+    // Assemble QFunction for all active input components at once
+    CeedCallBackend(CeedOperatorSetupBatchInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, num_active_in, Q, impl));
+    CeedCallBackend(CeedQFunctionApply(qf, num_active_in * Q, impl->qf_batch_in, impl->qf_batch_out));
+    CeedCallBackend(
+        CeedOperatorAssembleBatchOutputs_Ref(num_output_fields, qf_output_fields, op_output_fields, num_active_in, num_active_out, Q, a, impl));
+    a += num_active_in * num_active_out * Q;
   }
 
   // Restore input arrays
-  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, e_data_full, impl));
+  CeedCallBackend(CeedOperatorRestoreInputs_Ref(num_input_fields, qf_input_fields, op_input_fields, true, NULL, e_data_full, impl));
 
   // Restore output
   CeedCallBackend(CeedVectorRestoreArray(*assembled, &a));
@@ -590,17 +964,39 @@ static int CeedOperatorDestroy_Ref(CeedOperator op) {
   }
   CeedCallBackend(CeedFree(&impl->e_vecs_out));
   CeedCallBackend(CeedFree(&impl->q_vecs_out));
+  CeedCallBackend(CeedOperatorRangeDestroy_Ref(&impl->range));
 
   // QFunction assembly
-  for (CeedInt i = 0; i < impl->num_active_in; i++) {
-    CeedCallBackend(CeedVectorDestroy(&impl->qf_active_in[i]));
+  if (impl->qf_batch_in) {
+    for (CeedInt i = 0; i < impl->num_inputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_in[i]));
+    }
+    for (CeedInt i = 0; i < impl->num_outputs; i++) {
+      CeedCallBackend(CeedVectorDestroy(&impl->qf_batch_out[i]));
+    }
   }
-  CeedCallBackend(CeedFree(&impl->qf_active_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_in));
+  CeedCallBackend(CeedFree(&impl->qf_batch_out));
 
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// Composite Operator Destroy
+//------------------------------------------------------------------------------
+static int CeedOperatorDestroyComposite_Ref(CeedOperator op) {
+  CeedOperatorComposite_Ref *impl;
+  CeedCallBackend(CeedOperatorGetData(op, &impl));
+
+  for (CeedInt k = 0; k < impl->num_rstr_in; k++) {
+    CeedCallBackend(CeedElemRestrictionDestroy(&impl->rstr_in[k]));
+    CeedCallBackend(CeedVectorDestroy(&impl->e_vecs_in[k]));
+  }
+  CeedCallBackend(CeedFree(&impl));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // Operator Create
 //------------------------------------------------------------------------------
@@ -615,6 +1011,23 @@ int CeedOperatorCreate_Ref(CeedOperator op) {
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunction", CeedOperatorLinearAssembleQFunction_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "LinearAssembleQFunctionUpdate", CeedOperatorLinearAssembleQFunctionUpdate_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAdd", CeedOperatorApplyAdd_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddRange", CeedOperatorApplyAddRange_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroy_Ref));
   return CEED_ERROR_SUCCESS;
 }
+
+//------------------------------------------------------------------------------
+// Composite Operator Create
+//------------------------------------------------------------------------------
+int CeedCompositeOperatorCreate_Ref(CeedOperator op) {
+  Ceed ceed;
+  CeedCallBackend(CeedOperatorGetCeed(op, &ceed));
+  CeedOperatorComposite_Ref *impl;
+
+  CeedCallBackend(CeedCalloc(1, &impl));
+  CeedCallBackend(CeedOperatorSetData(op, impl));
+
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "ApplyAddComposite", CeedOperatorApplyAddComposite_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "Operator", op, "Destroy", CeedOperatorDestroyComposite_Ref));
+  return CEED_ERROR_SUCCESS;
+}
@@ -14,45 +14,35 @@
 
 //------------------------------------------------------------------------------
 // Core ElemRestriction Apply Code
+//   Operates on host arrays, the caller holds access to the CeedVectors
 //------------------------------------------------------------------------------
 static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                                    CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v,
-                                                    CeedRequest *request) {
+                                                    CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                                    CeedScalar *vv) {
   CeedElemRestriction_Ref *impl;
   CeedCallBackend(CeedElemRestrictionGetData(r, &impl));
-  const CeedScalar *uu;
-  CeedScalar       *vv;
-  CeedInt           num_elem, elem_size, v_offset;
+  CeedInt num_elem, elem_size;
   CeedCallBackend(CeedElemRestrictionGetNumElements(r, &num_elem));
   CeedCallBackend(CeedElemRestrictionGetElementSize(r, &elem_size));
-  v_offset = start * blk_size * elem_size * num_comp;
 
   bool is_oriented;
   CeedCallBackend(CeedElemRestrictionIsOriented(r, &is_oriented));
-  CeedCallBackend(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu));
-  if (t_mode == CEED_TRANSPOSE) {
-    // Sum into for transpose mode, e-vec to l-vec
-    CeedCallBackend(CeedVectorGetArray(v, CEED_MEM_HOST, &vv));
-  } else {
-    // Overwrite for notranspose mode, l-vec to e-vec
-    CeedCallBackend(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &vv));
-  }
   // Restriction from L-vector to E-vector
   // Perform: v = r * u
   if (t_mode == CEED_NOTRANSPOSE) {
     // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (!impl->offsets && !impl->offsets_64) {
       bool has_backend_strides;
       CeedCallBackend(CeedElemRestrictionHasBackendStrides(r, &has_backend_strides));
       if (has_backend_strides) {
         // CPU backend strides are {1, elem_size, elem_size*num_comp}
         // This if branch is left separate to allow better inlining
-        for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
           CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
             CeedPragmaSIMD for (CeedInt n = 0; n < elem_size; n++) {
               CeedPragmaSIMD for (CeedInt j = 0; j < blk_size; j++) {
                 vv[e * elem_size * num_comp + (k * elem_size + n) * blk_size + j - v_offset] =
-                    uu[n + k * elem_size + CeedIntMin(e + j, num_elem - 1) * elem_size * num_comp];
+                    uu[n + k * elem_size + (CeedSize)CeedIntMin(e + j, num_elem - 1) * elem_size * num_comp];
               }
             }
           }
@@ -61,26 +51,36 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const
         // User provided strides
         CeedInt strides[3];
         CeedCallBackend(CeedElemRestrictionGetStrides(r, &strides));
-        for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
           CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
             CeedPragmaSIMD for (CeedInt n = 0; n < elem_size; n++) {
               CeedPragmaSIMD for (CeedInt j = 0; j < blk_size; j++) {
                 vv[e * elem_size * num_comp + (k * elem_size + n) * blk_size + j - v_offset] =
-                    uu[n * strides[0] + k * strides[1] + CeedIntMin(e + j, num_elem - 1) * strides[2]];
+                    uu[(CeedSize)n * strides[0] + (CeedSize)k * strides[1] + (CeedSize)CeedIntMin(e + j, num_elem - 1) * strides[2]];
               }
             }
           }
         }
       }
+    } else if (impl->offsets_64) {
+      // 64-bit offsets provided, standard or blocked restriction
+      for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
+          CeedPragmaSIMD for (CeedInt i = 0; i < elem_size * blk_size; i++) {
+            vv[elem_size * (k * blk_size + num_comp * e) + i - v_offset] =
+                uu[impl->offsets_64[i + elem_size * e] + (CeedSize)k * comp_stride] * (is_oriented && impl->orient[i + elem_size * e] ? -1. : 1.);
+          }
+        }
+      }
     } else {
       // Offsets provided, standard or blocked restriction
       // vv has shape [elem_size, num_comp, num_elem], row-major
       // uu has shape [nnodes, num_comp]
-      for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+      for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
         CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
           CeedPragmaSIMD for (CeedInt i = 0; i < elem_size * blk_size; i++) {
             vv[elem_size * (k * blk_size + num_comp * e) + i - v_offset] =
-                uu[impl->offsets[i + elem_size * e] + k * comp_stride] * (is_oriented && impl->orient[i + elem_size * e] ? -1. : 1.);
+                uu[impl->offsets[i + elem_size * e] + (CeedSize)k * comp_stride] * (is_oriented && impl->orient[i + elem_size * e] ? -1. : 1.);
           }
         }
       }
@@ -89,13 +89,13 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const
     // Restriction from E-vector to L-vector
     // Performing v += r^T * u
     // No offsets provided, Identity Restriction
-    if (!impl->offsets) {
+    if (!impl->offsets && !impl->offsets_64) {
       bool has_backend_strides;
       CeedCallBackend(CeedElemRestrictionHasBackendStrides(r, &has_backend_strides));
       if (has_backend_strides) {
         // CPU backend strides are {1, elem_size, elem_size*num_comp}
         // This if brach is left separate to allow better inlining
-        for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
           CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
             CeedPragmaSIMD for (CeedInt n = 0; n < elem_size; n++) {
               CeedPragmaSIMD for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem - e); j++) {
@@ -109,27 +109,40 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const
         // User provided strides
         CeedInt strides[3];
         CeedCallBackend(CeedElemRestrictionGetStrides(r, &strides));
-        for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
           CeedPragmaSIMD for (CeedInt k = 0; k < num_comp; k++) {
             CeedPragmaSIMD for (CeedInt n = 0; n < elem_size; n++) {
               CeedPragmaSIMD for (CeedInt j = 0; j < CeedIntMin(blk_size, num_elem - e); j++) {
-                vv[n * strides[0] + k * strides[1] + (e + j) * strides[2]] +=
+                vv[(CeedSize)n * strides[0] + (CeedSize)k * strides[1] + (e + j) * strides[2]] +=
                     uu[e * elem_size * num_comp + (k * elem_size + n) * blk_size + j - v_offset];
               }
             }
           }
         }
       }
+    } else if (impl->offsets_64) {
+      // 64-bit offsets provided, standard or blocked restriction
+      for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
+        for (CeedInt k = 0; k < num_comp; k++) {
+          for (CeedInt i = 0; i < elem_size * blk_size; i += blk_size) {
+            // Iteration bound set to discard padding elements
+            for (CeedInt j = i; j < i + CeedIntMin(blk_size, num_elem - e); j++) {
+              vv[impl->offsets_64[j + e * elem_size] + (CeedSize)k * comp_stride] +=
+                  uu[elem_size * (k * blk_size + num_comp * e) + j - v_offset] * (is_oriented && impl->orient[j + e * elem_size] ? -1. : 1.);
+            }
+          }
+        }
+      }
     } else {
       // Offsets provided, standard or blocked restriction
       // uu has shape [elem_size, num_comp, num_elem]
       // vv has shape [nnodes, num_comp]
-      for (CeedInt e = start * blk_size; e < stop * blk_size; e += blk_size) {
+      for (CeedSize e = start * blk_size; e < stop * blk_size; e += blk_size) {
         for (CeedInt k = 0; k < num_comp; k++) {
           for (CeedInt i = 0; i < elem_size * blk_size; i += blk_size) {
             // Iteration bound set to discard padding elements
             for (CeedInt j = i; j < i + CeedIntMin(blk_size, num_elem - e); j++) {
-              vv[impl->offsets[j + e * elem_size] + k * comp_stride] +=
+              vv[impl->offsets[j + e * elem_size] + (CeedSize)k * comp_stride] +=
                   uu[elem_size * (k * blk_size + num_comp * e) + j - v_offset] * (is_oriented && impl->orient[j + e * elem_size] ? -1. : 1.);
             }
           }
@@ -137,9 +150,6 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const
       }
     }
   }
-  CeedCallBackend(CeedVectorRestoreArrayRead(u, &uu));
-  CeedCallBackend(CeedVectorRestoreArray(v, &vv));
-  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED) *request = NULL;
   return CEED_ERROR_SUCCESS;
 }
 
@@ -147,82 +157,167 @@ static inline int CeedElemRestrictionApply_Ref_Core(CeedElemRestriction r, const
 // ElemRestriction Apply - Common Sizes
 //------------------------------------------------------------------------------
 static int CeedElemRestrictionApply_Ref_110(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_111(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 1, 1, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_180(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_181(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 8, 1, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_310(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_311(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 1, 1, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_380(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 
 static int CeedElemRestrictionApply_Ref_381(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 8, 1, start, stop, v_offset, t_mode, uu, vv);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_510(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_511(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 1, 1, start, stop, v_offset, t_mode, uu, vv);
 }
 
 // LCOV_EXCL_START
 static int CeedElemRestrictionApply_Ref_580(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, comp_stride, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
 // LCOV_EXCL_STOP
 
 static int CeedElemRestrictionApply_Ref_581(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
-                                            CeedInt start, CeedInt stop, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, 1, start, stop, t_mode, u, v, request);
+                                            CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                            CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 8, 1, start, stop, v_offset, t_mode, uu, vv);
+}
+
+static int CeedElemRestrictionApply_Ref_1160(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 16, comp_stride, start, stop, v_offset, t_mode, uu, vv);
+}
+
+static int CeedElemRestrictionApply_Ref_1161(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 1, 16, 1, start, stop, v_offset, t_mode, uu, vv);
+}
+
+static int CeedElemRestrictionApply_Ref_3160(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 16, comp_stride, start, stop, v_offset, t_mode, uu, vv);
+}
+
+static int CeedElemRestrictionApply_Ref_3161(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 3, 16, 1, start, stop, v_offset, t_mode, uu, vv);
+}
+
+// LCOV_EXCL_START
+static int CeedElemRestrictionApply_Ref_5160(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 16, comp_stride, start, stop, v_offset, t_mode, uu, vv);
 }
+// LCOV_EXCL_STOP
+
+// LCOV_EXCL_START
+static int CeedElemRestrictionApply_Ref_5161(CeedElemRestriction r, const CeedInt num_comp, const CeedInt blk_size, const CeedInt comp_stride,
+                                             CeedInt start, CeedInt stop, CeedSize v_offset, CeedTransposeMode t_mode, const CeedScalar *uu,
+                                             CeedScalar *vv) {
+  return CeedElemRestrictionApply_Ref_Core(r, 5, 16, 1, start, stop, v_offset, t_mode, uu, vv);
+}
+// LCOV_EXCL_STOP
 
 //------------------------------------------------------------------------------
-// ElemRestriction Apply
+// ElemRestriction Apply on Host Arrays
+//   Applies blocks [block_start, block_stop), v_offset is subtracted from the E-vector index
 //------------------------------------------------------------------------------
-static int CeedElemRestrictionApply_Ref(CeedElemRestriction r, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
-  CeedInt num_blk, blk_size, num_comp, comp_stride;
-  CeedCallBackend(CeedElemRestrictionGetNumBlocks(r, &num_blk));
+int CeedElemRestrictionApplyArrays_Ref(CeedElemRestriction r, CeedInt block_start, CeedInt block_stop, CeedSize v_offset, CeedTransposeMode t_mode,
+                                       const CeedScalar *uu, CeedScalar *vv) {
+  CeedInt blk_size, num_comp, comp_stride;
   CeedCallBackend(CeedElemRestrictionGetBlockSize(r, &blk_size));
   CeedCallBackend(CeedElemRestrictionGetNumComponents(r, &num_comp));
   CeedCallBackend(CeedElemRestrictionGetCompStride(r, &comp_stride));
   CeedElemRestriction_Ref *impl;
   CeedCallBackend(CeedElemRestrictionGetData(r, &impl));
 
-  return impl->Apply(r, num_comp, blk_size, comp_stride, 0, num_blk, t_mode, u, v, request);
+  return impl->Apply(r, num_comp, blk_size, comp_stride, block_start, block_stop, v_offset, t_mode, uu, vv);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply on CeedVectors
+//------------------------------------------------------------------------------
+static inline int CeedElemRestrictionApplyVectors_Ref(CeedElemRestriction r, CeedInt block_start, CeedInt block_stop, CeedSize v_offset,
+                                                      CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
+  const CeedScalar *uu;
+  CeedScalar       *vv;
+  CeedCallBackend(CeedVectorGetArrayRead(u, CEED_MEM_HOST, &uu));
+  if (t_mode == CEED_TRANSPOSE) {
+    // Sum into for transpose mode, e-vec to l-vec
+    CeedCallBackend(CeedVectorGetArray(v, CEED_MEM_HOST, &vv));
+  } else {
+    // Overwrite for notranspose mode, l-vec to e-vec
+    CeedCallBackend(CeedVectorGetArrayWrite(v, CEED_MEM_HOST, &vv));
+  }
+  CeedCallBackend(CeedElemRestrictionApplyArrays_Ref(r, block_start, block_stop, v_offset, t_mode, uu, vv));
+  CeedCallBackend(CeedVectorRestoreArrayRead(u, &uu));
+  CeedCallBackend(CeedVectorRestoreArray(v, &vv));
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED) *request = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Apply
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApply_Ref(CeedElemRestriction r, CeedTransposeMode t_mode, CeedVector u, CeedVector v, CeedRequest *request) {
+  CeedInt num_blk;
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(r, &num_blk));
+
+  return CeedElemRestrictionApplyVectors_Ref(r, 0, num_blk, 0, t_mode, u, v, request);
 }
 
 //------------------------------------------------------------------------------
@@ -230,14 +325,22 @@ static int CeedElemRestrictionApply_Ref(CeedElemRestriction r, CeedTransposeMode
 //------------------------------------------------------------------------------
 static int CeedElemRestrictionApplyBlock_Ref(CeedElemRestriction r, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector v,
                                              CeedRequest *request) {
-  CeedInt blk_size, num_comp, comp_stride;
+  CeedInt blk_size, num_comp, elem_size;
   CeedCallBackend(CeedElemRestrictionGetBlockSize(r, &blk_size));
   CeedCallBackend(CeedElemRestrictionGetNumComponents(r, &num_comp));
-  CeedCallBackend(CeedElemRestrictionGetCompStride(r, &comp_stride));
-  CeedElemRestriction_Ref *impl;
-  CeedCallBackend(CeedElemRestrictionGetData(r, &impl));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(r, &elem_size));
+
+  // E-vector holds a single block
+  return CeedElemRestrictionApplyVectors_Ref(r, block, block + 1, (CeedSize)block * blk_size * elem_size * num_comp, t_mode, u, v, request);
+}
 
-  return impl->Apply(r, num_comp, blk_size, comp_stride, block, block + 1, t_mode, u, v, request);
+//------------------------------------------------------------------------------
+// ElemRestriction Apply Block Range
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionApplyBlockRange_Ref(CeedElemRestriction r, CeedInt block_start, CeedInt block_stop, CeedTransposeMode t_mode,
+                                                  CeedVector u, CeedVector v, CeedRequest *request) {
+  // E-vector holds all blocks
+  return CeedElemRestrictionApplyVectors_Ref(r, block_start, block_stop, 0, t_mode, u, v, request);
 }
 
 //------------------------------------------------------------------------------
@@ -259,6 +362,86 @@ static int CeedElemRestrictionGetOffsets_Ref(CeedElemRestriction rstr, CeedMemTy
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Get 64-bit Offsets
+//------------------------------------------------------------------------------
+static int CeedElemRestrictionGetOffsets64_Ref(CeedElemRestriction rstr, CeedMemType mem_type, const CeedSize **offsets) {
+  CeedElemRestriction_Ref *impl;
+  CeedCallBackend(CeedElemRestrictionGetData(rstr, &impl));
+  Ceed ceed;
+  CeedCallBackend(CeedElemRestrictionGetCeed(rstr, &ceed));
+
+  if (mem_type != CEED_MEM_HOST) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "Can only provide to HOST memory");
+    // LCOV_EXCL_STOP
+  }
+
+  *offsets = impl->offsets_64;
+  return CEED_ERROR_SUCCESS;
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Transpose Map
+//   Lists the E-vector entries of each L-vector node, in E-vector order, so threaded backends can do the transpose as a gather over L-vector
+//   nodes without write conflicts. The map is only built on request, as the serial transpose apply keeps the scatter.
+//------------------------------------------------------------------------------
+int CeedElemRestrictionSetupTransposeMap_Ref(CeedElemRestriction r) {
+  CeedElemRestriction_Ref *impl;
+  CeedCallBackend(CeedElemRestrictionGetData(r, &impl));
+  if (impl->t_offsets) return CEED_ERROR_SUCCESS;
+  if (!impl->offsets && !impl->offsets_64) {
+    // LCOV_EXCL_START
+    Ceed ceed;
+    CeedCallBackend(CeedElemRestrictionGetCeed(r, &ceed));
+    return CeedError(ceed, CEED_ERROR_BACKEND, "Transpose map requires a CeedElemRestriction with offsets");
+    // LCOV_EXCL_STOP
+  }
+  CeedSize l_size, num_entries = 0;
+  CeedInt  num_elem, elem_size, num_blk, blk_size, num_comp;
+  CeedCallBackend(CeedElemRestrictionGetLVectorSize(r, &l_size));
+  CeedCallBackend(CeedElemRestrictionGetNumElements(r, &num_elem));
+  CeedCallBackend(CeedElemRestrictionGetElementSize(r, &elem_size));
+  CeedCallBackend(CeedElemRestrictionGetNumBlocks(r, &num_blk));
+  CeedCallBackend(CeedElemRestrictionGetBlockSize(r, &blk_size));
+  CeedCallBackend(CeedElemRestrictionGetNumComponents(r, &num_comp));
+  const CeedSize blk_entries = (CeedSize)blk_size * elem_size, size_offsets = num_blk * blk_entries;
+
+  // Count node multiplicity, discarding padding elements
+  CeedSize *ind_to_offset;
+  CeedCallBackend(CeedCalloc(l_size, &ind_to_offset));
+  for (CeedSize p = 0; p < size_offsets; p++) {
+    if ((p / blk_entries) * blk_size + p % blk_size >= num_elem) continue;
+    ind_to_offset[impl->offsets_64 ? impl->offsets_64[p] : impl->offsets[p]]++;
+    num_entries++;
+  }
+
+  // L-vector indices and transpose offsets
+  impl->num_nodes = 0;
+  for (CeedSize i = 0; i < l_size; i++) impl->num_nodes += ind_to_offset[i] > 0;
+  CeedCallBackend(CeedCalloc(impl->num_nodes, &impl->l_vec_indices));
+  CeedCallBackend(CeedCalloc(impl->num_nodes + 1, &impl->t_offsets));
+  for (CeedSize i = 0, n = 0; i < l_size; i++) {
+    if (ind_to_offset[i] > 0) {
+      impl->l_vec_indices[n] = i;
+      impl->t_offsets[n + 1] = impl->t_offsets[n] + ind_to_offset[i];
+      ind_to_offset[i]       = impl->t_offsets[n];
+      n++;
+    }
+  }
+
+  // E-vector indices, for the first component, associated with each L-vector node
+  CeedCallBackend(CeedMalloc(num_entries, &impl->t_indices));
+  for (CeedSize p = 0; p < size_offsets; p++) {
+    const CeedSize b = p / blk_entries, i = p % blk_entries;
+
+    if (b * blk_size + i % blk_size >= num_elem) continue;
+    impl->t_indices[ind_to_offset[impl->offsets_64 ? impl->offsets_64[p] : impl->offsets[p]]++] = b * blk_entries * num_comp + i;
+  }
+  CeedCallBackend(CeedFree(&ind_to_offset));
+  return CEED_ERROR_SUCCESS;
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Destroy
 //------------------------------------------------------------------------------
@@ -267,15 +450,20 @@ static int CeedElemRestrictionDestroy_Ref(CeedElemRestriction r) {
   CeedCallBackend(CeedElemRestrictionGetData(r, &impl));
 
   CeedCallBackend(CeedFree(&impl->offsets_allocated));
+  CeedCallBackend(CeedFree(&impl->offsets_64_allocated));
   CeedCallBackend(CeedFree(&impl->orient_allocated));
+  CeedCallBackend(CeedFree(&impl->l_vec_indices));
+  CeedCallBackend(CeedFree(&impl->t_offsets));
+  CeedCallBackend(CeedFree(&impl->t_indices));
   CeedCallBackend(CeedFree(&impl));
   return CEED_ERROR_SUCCESS;
 }
 
 //------------------------------------------------------------------------------
-// ElemRestriction Create
+// ElemRestriction Create Core, with either 32-bit or 64-bit offsets
 //------------------------------------------------------------------------------
-int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r) {
+static int CeedElemRestrictionCreate_Ref_Core(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const CeedSize *offsets_64,
+                                              CeedElemRestriction r) {
   CeedElemRestriction_Ref *impl;
   CeedInt                  num_elem, elem_size, num_blk, blk_size, num_comp, comp_stride;
   CeedCallBackend(CeedElemRestrictionGetNumElements(r, &num_elem));
@@ -311,29 +499,46 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
       CeedSize l_size;
       CeedCallBackend(CeedElemRestrictionGetLVectorSize(r, &l_size));
 
-      for (CeedInt i = 0; i < num_elem * elem_size; i++) {
-        if (offsets[i] < 0 || l_size <= offsets[i] + (num_comp - 1) * comp_stride) {
+      for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) {
+        const CeedSize offset = offsets_64 ? offsets_64[i] : offsets[i];
+
+        if (offset < 0 || l_size <= offset + (CeedSize)(num_comp - 1) * comp_stride) {
           // LCOV_EXCL_START
-          return CeedError(ceed, CEED_ERROR_BACKEND, "Restriction offset %" CeedInt_FMT " (%" CeedInt_FMT ") out of range [0, %" CeedInt_FMT "]", i,
-                           offsets[i], l_size);
+          return CeedError(ceed, CEED_ERROR_BACKEND, "Restriction offset %td (%td) out of range [0, %td]", i, offset, l_size);
           // LCOV_EXCL_STOP
         }
       }
     }
 
     // Copy data
-    switch (copy_mode) {
-      case CEED_COPY_VALUES:
-        CeedCallBackend(CeedMalloc(num_elem * elem_size, &impl->offsets_allocated));
-        memcpy(impl->offsets_allocated, offsets, num_elem * elem_size * sizeof(offsets[0]));
-        impl->offsets = impl->offsets_allocated;
-        break;
-      case CEED_OWN_POINTER:
-        impl->offsets_allocated = (CeedInt *)offsets;
-        impl->offsets           = impl->offsets_allocated;
-        break;
-      case CEED_USE_POINTER:
-        impl->offsets = offsets;
+    if (offsets_64) {
+      switch (copy_mode) {
+        case CEED_COPY_VALUES:
+          CeedCallBackend(CeedMalloc((CeedSize)num_elem * elem_size, &impl->offsets_64_allocated));
+          memcpy(impl->offsets_64_allocated, offsets_64, (CeedSize)num_elem * elem_size * sizeof(offsets_64[0]));
+          impl->offsets_64 = impl->offsets_64_allocated;
+          break;
+        case CEED_OWN_POINTER:
+          impl->offsets_64_allocated = (CeedSize *)offsets_64;
+          impl->offsets_64           = impl->offsets_64_allocated;
+          break;
+        case CEED_USE_POINTER:
+          impl->offsets_64 = offsets_64;
+      }
+    } else {
+      switch (copy_mode) {
+        case CEED_COPY_VALUES:
+          CeedCallBackend(CeedMalloc((CeedSize)num_elem * elem_size, &impl->offsets_allocated));
+          memcpy(impl->offsets_allocated, offsets, (CeedSize)num_elem * elem_size * sizeof(offsets[0]));
+          impl->offsets = impl->offsets_allocated;
+          break;
+        case CEED_OWN_POINTER:
+          impl->offsets_allocated = (CeedInt *)offsets;
+          impl->offsets           = impl->offsets_allocated;
+          break;
+        case CEED_USE_POINTER:
+          impl->offsets = offsets;
+      }
     }
   }
 
@@ -342,61 +547,101 @@ int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode,
   CeedCallBackend(CeedElemRestrictionSetELayout(r, layout));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "Apply", CeedElemRestrictionApply_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlock", CeedElemRestrictionApplyBlock_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "ApplyBlockRange", CeedElemRestrictionApplyBlockRange_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets", CeedElemRestrictionGetOffsets_Ref));
+  CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "GetOffsets64", CeedElemRestrictionGetOffsets64_Ref));
   CeedCallBackend(CeedSetBackendFunction(ceed, "ElemRestriction", r, "Destroy", CeedElemRestrictionDestroy_Ref));
 
   // Set apply function based upon num_comp, blk_size, and comp_stride
-  CeedInt idx = -1;
-  if (blk_size < 10) idx = 100 * num_comp + 10 * blk_size + (comp_stride == 1);
-  switch (idx) {
-    case 110:
-      impl->Apply = CeedElemRestrictionApply_Ref_110;
-      break;
-    case 111:
-      impl->Apply = CeedElemRestrictionApply_Ref_111;
-      break;
-    case 180:
-      impl->Apply = CeedElemRestrictionApply_Ref_180;
-      break;
-    case 181:
-      impl->Apply = CeedElemRestrictionApply_Ref_181;
-      break;
-    case 310:
-      impl->Apply = CeedElemRestrictionApply_Ref_310;
-      break;
-    case 311:
-      impl->Apply = CeedElemRestrictionApply_Ref_311;
-      break;
-    case 380:
-      impl->Apply = CeedElemRestrictionApply_Ref_380;
-      break;
-    case 381:
-      impl->Apply = CeedElemRestrictionApply_Ref_381;
-      break;
-    // LCOV_EXCL_START
-    case 510:
-      impl->Apply = CeedElemRestrictionApply_Ref_510;
-      break;
-    // LCOV_EXCL_STOP
-    case 511:
-      impl->Apply = CeedElemRestrictionApply_Ref_511;
-      break;
-    // LCOV_EXCL_START
-    case 580:
-      impl->Apply = CeedElemRestrictionApply_Ref_580;
-      break;
-    // LCOV_EXCL_STOP
-    case 581:
-      impl->Apply = CeedElemRestrictionApply_Ref_581;
-      break;
-    default:
-      impl->Apply = CeedElemRestrictionApply_Ref_Core;
-      break;
+  //   Block size 16 has its own switch so its keys cannot collide with those of other block sizes
+  impl->Apply = CeedElemRestrictionApply_Ref_Core;
+  if (blk_size == 16) {
+    switch (10 * num_comp + (comp_stride == 1)) {
+      case 10:
+        impl->Apply = CeedElemRestrictionApply_Ref_1160;
+        break;
+      case 11:
+        impl->Apply = CeedElemRestrictionApply_Ref_1161;
+        break;
+      case 30:
+        impl->Apply = CeedElemRestrictionApply_Ref_3160;
+        break;
+      case 31:
+        impl->Apply = CeedElemRestrictionApply_Ref_3161;
+        break;
+      // LCOV_EXCL_START
+      case 50:
+        impl->Apply = CeedElemRestrictionApply_Ref_5160;
+        break;
+      // LCOV_EXCL_STOP
+      // LCOV_EXCL_START
+      case 51:
+        impl->Apply = CeedElemRestrictionApply_Ref_5161;
+        break;
+        // LCOV_EXCL_STOP
+    }
+  } else if (blk_size < 10) {
+    switch (100 * num_comp + 10 * blk_size + (comp_stride == 1)) {
+      case 110:
+        impl->Apply = CeedElemRestrictionApply_Ref_110;
+        break;
+      case 111:
+        impl->Apply = CeedElemRestrictionApply_Ref_111;
+        break;
+      case 180:
+        impl->Apply = CeedElemRestrictionApply_Ref_180;
+        break;
+      case 181:
+        impl->Apply = CeedElemRestrictionApply_Ref_181;
+        break;
+      case 310:
+        impl->Apply = CeedElemRestrictionApply_Ref_310;
+        break;
+      case 311:
+        impl->Apply = CeedElemRestrictionApply_Ref_311;
+        break;
+      case 380:
+        impl->Apply = CeedElemRestrictionApply_Ref_380;
+        break;
+      case 381:
+        impl->Apply = CeedElemRestrictionApply_Ref_381;
+        break;
+      // LCOV_EXCL_START
+      case 510:
+        impl->Apply = CeedElemRestrictionApply_Ref_510;
+        break;
+      // LCOV_EXCL_STOP
+      case 511:
+        impl->Apply = CeedElemRestrictionApply_Ref_511;
+        break;
+      // LCOV_EXCL_START
+      case 580:
+        impl->Apply = CeedElemRestrictionApply_Ref_580;
+        break;
+      // LCOV_EXCL_STOP
+      case 581:
+        impl->Apply = CeedElemRestrictionApply_Ref_581;
+        break;
+    }
   }
 
   return CEED_ERROR_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+// ElemRestriction Create
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r) {
+  return CeedElemRestrictionCreate_Ref_Core(mem_type, copy_mode, offsets, NULL, r);
+}
+
+//------------------------------------------------------------------------------
+// ElemRestriction Create with 64-bit offsets
+//------------------------------------------------------------------------------
+int CeedElemRestrictionCreate64_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedSize *offsets, CeedElemRestriction r) {
+  return CeedElemRestrictionCreate_Ref_Core(mem_type, copy_mode, NULL, offsets, r);
+}
+
 //------------------------------------------------------------------------------
 // ElemRestriction Create Oriented
 //------------------------------------------------------------------------------
@@ -413,8 +658,8 @@ int CeedElemRestrictionCreateOriented_Ref(CeedMemType mem_type, CeedCopyMode cop
   CeedCallBackend(CeedElemRestrictionGetElementSize(r, &elem_size));
   switch (copy_mode) {
     case CEED_COPY_VALUES:
-      CeedCallBackend(CeedMalloc(num_elem * elem_size, &impl->orient_allocated));
-      memcpy(impl->orient_allocated, orient, num_elem * elem_size * sizeof(orient[0]));
+      CeedCallBackend(CeedMalloc((CeedSize)num_elem * elem_size, &impl->orient_allocated));
+      memcpy(impl->orient_allocated, orient, (CeedSize)num_elem * elem_size * sizeof(orient[0]));
       impl->orient = impl->orient_allocated;
       break;
     case CEED_OWN_POINTER:
@@ -66,7 +66,7 @@ static int CeedVectorSetArray_Ref(CeedVector vec, CeedMemType mem_type, CeedCopy
   switch (copy_mode) {
     case CEED_COPY_VALUES:
       if (!impl->array_owned) {
-        CeedCallBackend(CeedCalloc(length, &impl->array_owned));
+        CeedCallBackend(CeedHostCalloc(ceed, length, &impl->array_owned));
       }
       impl->array_borrowed = NULL;
       impl->array          = impl->array_owned;
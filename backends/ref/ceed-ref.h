@@ -16,6 +16,8 @@
 typedef struct {
   CeedScalar *collo_grad_1d;
   bool        has_collo_interp;
+  CeedScalar *work;      /* Scratch space for tensor contractions */
+  CeedSize    work_size; /* Number of entries allocated in work */
 } CeedBasis_Ref;
 
 typedef struct {
@@ -25,13 +27,20 @@ typedef struct {
 } CeedVector_Ref;
 
 typedef struct {
-  const CeedInt *offsets;
-  CeedInt       *offsets_allocated;
+  const CeedInt  *offsets;
+  CeedInt        *offsets_allocated;
+  const CeedSize *offsets_64;
+  CeedSize       *offsets_64_allocated;
   // Orientation, if it exists, is true when the face must be flipped (multiplies by -1.).
   const bool *orient;
   bool       *orient_allocated;
-  int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt, const CeedInt, CeedInt, CeedInt, CeedTransposeMode, CeedVector, CeedVector,
-               CeedRequest *);
+  // Transpose map, E-vector entries of each L-vector node in CSR format, only built on request by CeedElemRestrictionSetupTransposeMap_Ref()
+  CeedSize  num_nodes;
+  CeedSize *l_vec_indices;
+  CeedSize *t_offsets;
+  CeedSize *t_indices;
+  int (*Apply)(CeedElemRestriction, const CeedInt, const CeedInt, const CeedInt, CeedInt, CeedInt, CeedSize, CeedTransposeMode, const CeedScalar *,
+               CeedScalar *);
 } CeedElemRestriction_Ref;
 
 typedef struct {
@@ -46,24 +55,67 @@ typedef struct {
 } CeedQFunctionContext_Ref;
 
 typedef struct {
-  bool        is_identity_qf, is_identity_restr_op;
-  CeedVector *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
-  uint64_t   *input_states; /* State counter of inputs */
-  CeedVector *e_vecs_in;    /* Single element input E-vectors  */
-  CeedVector *e_vecs_out;   /* Single element output E-vectors */
-  CeedVector *q_vecs_in;    /* Single element input Q-vectors  */
-  CeedVector *q_vecs_out;   /* Single element output Q-vectors */
-  CeedInt     num_inputs, num_outputs;
-  CeedInt     num_active_in, num_active_out;
-  CeedVector *qf_active_in;
+  bool        is_in_use;
+  CeedScalar *e_data[2 * CEED_FIELD_MAX]; /* Single block E-vectors, inputs followed by outputs */
+  CeedScalar *q_data[2 * CEED_FIELD_MAX]; /* Single block Q-vectors, inputs followed by outputs */
+  CeedScalar *work;                       /* Scratch space for tensor bases */
+  CeedSize    work_size;
+} CeedOperatorRangeSlot_Ref;
+
+typedef struct {
+  bool                        is_concurrent;   /* Element loop can run on raw pointers without the thread lock */
+  bool                        has_passive_out; /* Passive outputs are shared, so applications are serialized */
+  CeedInt                     blk_size, num_inputs, num_outputs;
+  CeedEvalMode                eval_modes[2 * CEED_FIELD_MAX];
+  CeedVector                  vecs[2 * CEED_FIELD_MAX];
+  CeedElemRestriction         blk_restr[2 * CEED_FIELD_MAX];
+  CeedBasis                   bases[2 * CEED_FIELD_MAX];
+  CeedSize                    e_sizes[2 * CEED_FIELD_MAX], q_sizes[2 * CEED_FIELD_MAX]; /* Single block E-vector and Q-vector lengths */
+  CeedScalar                 *q_weights[CEED_FIELD_MAX];                                /* Quadrature weights of a block */
+  CeedInt                     num_slots;
+  CeedOperatorRangeSlot_Ref **slots; /* Work data, one per concurrent application */
+} CeedOperatorRange_Ref;
+
+typedef struct {
+  bool                   is_identity_qf, is_identity_restr_op;
+  bool                   use_raw_ptrs; /* Element loop calls basis and QFunction on host arrays */
+  CeedEvalMode           eval_modes_in[CEED_FIELD_MAX], eval_modes_out[CEED_FIELD_MAX];
+  CeedInt                e_sizes_in[CEED_FIELD_MAX], e_sizes_out[CEED_FIELD_MAX]; /* Single element E-vector lengths */
+  CeedInt                q_sizes_in[CEED_FIELD_MAX], q_sizes_out[CEED_FIELD_MAX]; /* Single element Q-vector lengths */
+  CeedBasis              bases_in[CEED_FIELD_MAX], bases_out[CEED_FIELD_MAX];
+  CeedVector            *e_vecs_full;  /* Full E-vectors, inputs followed by outputs */
+  uint64_t              *input_states; /* State counter of inputs */
+  CeedVector            *e_vecs_in;    /* Single element input E-vectors  */
+  CeedVector            *e_vecs_out;   /* Single element output E-vectors */
+  CeedVector            *q_vecs_in;    /* Single element input Q-vectors  */
+  CeedVector            *q_vecs_out;   /* Single element output Q-vectors */
+  CeedInt                num_inputs, num_outputs;
+  CeedInt                num_active_in, num_active_out;
+  CeedVector            *qf_batch_in;  /* Batched input Q-vectors for QFunction assembly  */
+  CeedVector            *qf_batch_out; /* Batched output Q-vectors for QFunction assembly */
+  CeedOperatorRange_Ref *range;        /* Element range application data */
 } CeedOperator_Ref;
 
+typedef struct {
+  CeedInt             num_rstr_in;
+  CeedElemRestriction rstr_in[CEED_COMPOSITE_MAX * CEED_FIELD_MAX]; /* Active input CeedElemRestrictions of the sub-operators */
+  CeedVector          e_vecs_in[CEED_COMPOSITE_MAX * CEED_FIELD_MAX]; /* Shared active input E-vectors, one per CeedElemRestriction */
+} CeedOperatorComposite_Ref;
+
 CEED_INTERN int CeedVectorCreate_Ref(CeedSize n, CeedVector vec);
 
 CEED_INTERN int CeedElemRestrictionCreate_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, CeedElemRestriction r);
+CEED_INTERN int CeedElemRestrictionCreate64_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedSize *offsets, CeedElemRestriction r);
 CEED_INTERN int CeedElemRestrictionCreateOriented_Ref(CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets, const bool *orient,
                                                       CeedElemRestriction r);
-
+CEED_INTERN int CeedElemRestrictionApplyArrays_Ref(CeedElemRestriction r, CeedInt block_start, CeedInt block_stop, CeedSize v_offset,
+                                                   CeedTransposeMode t_mode, const CeedScalar *uu, CeedScalar *vv);
+CEED_INTERN int CeedElemRestrictionSetupTransposeMap_Ref(CeedElemRestriction r);
+
+CEED_INTERN int CeedBasisApplyWork_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, const CeedScalar *u,
+                                       CeedScalar *v, CeedScalar **work_array, CeedSize *work_array_size);
+CEED_INTERN int CeedBasisApplyCore_Ref(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, const CeedScalar *u,
+                                       CeedScalar *v);
 CEED_INTERN int CeedBasisCreateTensorH1_Ref(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *interp_1d, const CeedScalar *grad_1d,
                                             const CeedScalar *q_ref_1d, const CeedScalar *q_weight_1d, CeedBasis basis);
 CEED_INTERN int CeedBasisCreateH1_Ref(CeedElemTopology topo, CeedInt dim, CeedInt num_nodes, CeedInt num_qpts, const CeedScalar *interp,
@@ -77,6 +129,11 @@ CEED_INTERN int CeedQFunctionCreate_Ref(CeedQFunction qf);
 
 CEED_INTERN int CeedQFunctionContextCreate_Ref(CeedQFunctionContext ctx);
 
+CEED_INTERN int CeedOperatorRangeCreate_Ref(CeedOperator op, CeedInt blk_size, CeedElemRestriction *blk_restr, CeedOperatorRange_Ref **range);
+CEED_INTERN int CeedOperatorRangeApply_Ref(CeedOperator op, CeedOperatorRange_Ref *range, CeedInt e_start, CeedInt e_end, CeedVector in_vec,
+                                           CeedVector out_vec);
+CEED_INTERN int CeedOperatorRangeDestroy_Ref(CeedOperatorRange_Ref **range);
 CEED_INTERN int CeedOperatorCreate_Ref(CeedOperator op);
+CEED_INTERN int CeedCompositeOperatorCreate_Ref(CeedOperator op);
 
 #endif  // _ceed_ref_h
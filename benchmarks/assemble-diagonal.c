@@ -0,0 +1,216 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+//                             libCEED Diagonal Assembly Benchmark
+//
+// This benchmark times CeedOperatorLinearAssembleDiagonal and CeedOperatorLinearAssemblePointBlockDiagonal for the Poisson operator on a
+// structured mesh with a tensor product H1 basis, which uses sum factorized assembly, and with the same basis wrapped as a non-tensor basis, which
+// uses the dense basis matrices.
+//
+// Build with:
+//
+//     make assemble-diagonal [CEED_DIR=</path/to/libceed>]
+//
+// Sample runs:
+//
+//     ./assemble-diagonal
+//     ./assemble-diagonal -ceed /cpu/self/opt/blocked -d 3 -p 6 -n 8
+//
+// Output is one CSV line per run:
+//
+//     backend,dim,degree,num_elem,point_block,tensor_seconds,dense_seconds,max_diff
+
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double Wtime(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Element restriction for a structured box of n^dim elements with P nodes in each direction
+static void BuildRestriction(Ceed ceed, CeedInt dim, CeedInt n, CeedInt P, CeedInt num_comp, CeedElemRestriction *rstr, CeedSize *num_dofs) {
+  const CeedInt nodes_1d = n * (P - 1) + 1, elem_size = CeedIntPow(P, dim), num_elem = CeedIntPow(n, dim);
+  CeedInt      *offsets = malloc(sizeof(CeedInt) * num_elem * elem_size);
+
+  *num_dofs = CeedIntPow(nodes_1d, dim);
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt node = 0; node < elem_size; node++) {
+      CeedInt offset = 0, stride = 1;
+      for (CeedInt d = 0; d < dim; d++) {
+        const CeedInt e_d = (e / CeedIntPow(n, d)) % n, node_d = (node / CeedIntPow(P, d)) % P;
+        offset += (e_d * (P - 1) + node_d) * stride;
+        stride *= nodes_1d;
+      }
+      offsets[e * elem_size + node] = offset;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, *num_dofs, num_comp * *num_dofs, CEED_MEM_HOST, CEED_COPY_VALUES, offsets, rstr);
+  free(offsets);
+}
+
+// Time diagonal assembly, returning seconds per assembly
+static double TimeAssembleDiagonal(CeedOperator op, CeedVector diag, int point_block, int num_reps) {
+  double start;
+
+  // Warm up, including QFunction assembly
+  CeedVectorSetValue(diag, 0.0);
+  if (point_block) CeedOperatorLinearAssemblePointBlockDiagonal(op, diag, CEED_REQUEST_IMMEDIATE);
+  else CeedOperatorLinearAssembleDiagonal(op, diag, CEED_REQUEST_IMMEDIATE);
+  start = Wtime();
+  for (int i = 0; i < num_reps; i++) {
+    if (point_block) CeedOperatorLinearAssemblePointBlockDiagonal(op, diag, CEED_REQUEST_IMMEDIATE);
+    else CeedOperatorLinearAssembleDiagonal(op, diag, CEED_REQUEST_IMMEDIATE);
+  }
+  return (Wtime() - start) / num_reps;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec   = "/cpu/self";
+  CeedInt     dim         = 3;
+  CeedInt     degree      = 4;
+  CeedInt     n           = 6;
+  CeedInt     num_reps    = 3;
+  int         point_block = 0;
+
+  // Process command line arguments
+  for (int ia = 1; ia < argc; ia++) {
+    // LCOV_EXCL_START
+    int next_arg = ((ia + 1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia], "-h")) {
+      printf("usage: %s [-ceed resource] [-d dim] [-p degree] [-n elements per dim] [-r reps] [-pb]\n", argv[0]);
+      return 0;
+    } else if (!strcmp(argv[ia], "-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia], "-d")) {
+      parse_error = next_arg ? dim = atoi(argv[++ia]), 0 : 1;
+      if (dim < 1 || dim > 3) parse_error = 1;
+    } else if (!strcmp(argv[ia], "-p")) {
+      parse_error = next_arg ? degree = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-n")) {
+      parse_error = next_arg ? n = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-r")) {
+      parse_error = next_arg ? num_reps = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-pb")) {
+      point_block = 1;
+    }
+    if (parse_error) {
+      printf("Error parsing command line options.\n");
+      return 1;
+    }
+    // LCOV_EXCL_STOP
+  }
+
+  Ceed ceed;
+  CeedInit(ceed_spec, &ceed);
+
+  const CeedInt P = degree + 1, Q = P + 1, num_elem = CeedIntPow(n, dim), num_qpts = CeedIntPow(Q, dim);
+  const CeedInt q_data_size = dim * (dim + 1) / 2;
+
+  // Bases; the dense basis has the same matrices without the tensor structure
+  CeedBasis basis_x, basis_u, basis_u_dense;
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, 1, P, Q, CEED_GAUSS, &basis_u);
+  {
+    const CeedScalar      *interp, *grad, *q_ref, *q_weight;
+    const CeedElemTopology topo[3] = {CEED_TOPOLOGY_LINE, CEED_TOPOLOGY_QUAD, CEED_TOPOLOGY_HEX};
+    CeedBasisGetInterp(basis_u, &interp);
+    CeedBasisGetGrad(basis_u, &grad);
+    CeedBasisGetQRef(basis_u, &q_ref);
+    CeedBasisGetQWeights(basis_u, &q_weight);
+    CeedBasisCreateH1(ceed, topo[dim - 1], 1, CeedIntPow(P, dim), num_qpts, interp, grad, q_ref, q_weight, &basis_u_dense);
+  }
+
+  // Restrictions
+  CeedElemRestriction rstr_x, rstr_u, rstr_q_data;
+  CeedSize            num_dofs_x, num_dofs_u;
+  BuildRestriction(ceed, dim, n, 2, dim, &rstr_x, &num_dofs_x);
+  BuildRestriction(ceed, dim, n, P, 1, &rstr_u, &num_dofs_u);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, q_data_size, q_data_size * num_elem * num_qpts, CEED_STRIDES_BACKEND, &rstr_q_data);
+
+  // Mesh coordinates on [0, 1]^dim
+  CeedVector x, q_data, diag_tensor, diag_dense;
+  CeedVectorCreate(ceed, dim * num_dofs_x, &x);
+  {
+    CeedScalar *x_array;
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt i = 0; i < num_dofs_x; i++) {
+      for (CeedInt d = 0; d < dim; d++) x_array[i + d * num_dofs_x] = ((i / CeedIntPow(n + 1, d)) % (n + 1)) / (CeedScalar)n;
+    }
+    CeedVectorRestoreArray(x, &x_array);
+  }
+  CeedVectorCreate(ceed, q_data_size * num_elem * num_qpts, &q_data);
+
+  // Geometric factors
+  CeedQFunction qf_build, qf_apply;
+  CeedOperator  op_build, op_tensor, op_dense;
+  char          name[32];
+  snprintf(name, sizeof(name), "Poisson%" CeedInt_FMT "DBuild", dim);
+  CeedQFunctionCreateInteriorByName(ceed, name, &qf_build);
+  CeedOperatorCreate(ceed, qf_build, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_build);
+  CeedOperatorSetField(op_build, "dx", rstr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_build, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_build, "qdata", rstr_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_build, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Poisson operators
+  snprintf(name, sizeof(name), "Poisson%" CeedInt_FMT "DApply", dim);
+  CeedQFunctionCreateInteriorByName(ceed, name, &qf_apply);
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_tensor);
+  CeedOperatorSetField(op_tensor, "du", rstr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_tensor, "qdata", rstr_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_tensor, "dv", rstr_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorCreate(ceed, qf_apply, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_dense);
+  CeedOperatorSetField(op_dense, "du", rstr_u, basis_u_dense, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_dense, "qdata", rstr_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_dense, "dv", rstr_u, basis_u_dense, CEED_VECTOR_ACTIVE);
+
+  // Time and compare
+  CeedVectorCreate(ceed, num_dofs_u, &diag_tensor);
+  CeedVectorCreate(ceed, num_dofs_u, &diag_dense);
+  const double time_tensor = TimeAssembleDiagonal(op_tensor, diag_tensor, point_block, num_reps);
+  const double time_dense  = TimeAssembleDiagonal(op_dense, diag_dense, point_block, num_reps);
+  CeedScalar   max_diff    = 0.0;
+  {
+    const CeedScalar *tensor_array, *dense_array;
+    CeedVectorGetArrayRead(diag_tensor, CEED_MEM_HOST, &tensor_array);
+    CeedVectorGetArrayRead(diag_dense, CEED_MEM_HOST, &dense_array);
+    for (CeedSize i = 0; i < num_dofs_u; i++) max_diff = fmax(max_diff, fabs(tensor_array[i] - dense_array[i]));
+    CeedVectorRestoreArrayRead(diag_tensor, &tensor_array);
+    CeedVectorRestoreArrayRead(diag_dense, &dense_array);
+  }
+  {
+    const char *resource;
+    CeedGetResource(ceed, &resource);
+    printf("%s,%" CeedInt_FMT ",%" CeedInt_FMT ",%" CeedInt_FMT ",%d,%.6e,%.6e,%.3e\n", resource, dim, degree, num_elem, point_block, time_tensor,
+           time_dense, max_diff);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&q_data);
+  CeedVectorDestroy(&diag_tensor);
+  CeedVectorDestroy(&diag_dense);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_u_dense);
+  CeedElemRestrictionDestroy(&rstr_x);
+  CeedElemRestrictionDestroy(&rstr_u);
+  CeedElemRestrictionDestroy(&rstr_q_data);
+  CeedQFunctionDestroy(&qf_build);
+  CeedQFunctionDestroy(&qf_apply);
+  CeedOperatorDestroy(&op_build);
+  CeedOperatorDestroy(&op_tensor);
+  CeedOperatorDestroy(&op_dense);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,464 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+//                             libCEED Kernel Benchmarks
+//
+// This benchmark times the kernels that make up a matrix-free operator application without PETSc or MPI:
+//   - CeedElemRestrictionApply, with and without transpose,
+//   - CeedBasisApply for interpolation and gradients, with a tensor product H1 basis and the same basis wrapped as a non-tensor basis,
+//   - CeedQFunctionApply for the gallery mass and Poisson QFunctions, and
+//   - CeedOperatorApply for the mass and Poisson operators of the CEED benchmark problems BP1 and BP3, or BP2 and BP4 with 3 components, and
+//     for the Poisson operator with CeedOperatorSetPrecision(CEED_SCALAR_FP32) on backends that support it.
+// It sweeps the polynomial degree, number of components, and number of elements on a structured mesh of [0, 1]^dim.
+//
+// Build with:
+//
+//     make bench-kernels [CEED_DIR=</path/to/libceed>]
+//
+// or run the sweep for every backend in $(BACKENDS) from the top level directory with `make bench-kernels`.
+//
+// Sample runs:
+//
+//     ./bench-kernels
+//     ./bench-kernels -ceed /cpu/self/opt/blocked -d 3 -pmin 2 -pmax 4 -k basis
+//
+// Output is one CSV line per kernel and problem size:
+//
+//     kernel,backend,memtype,dim,degree,quadrature_pts,num_comp,num_elem,num_unknowns,reps,seconds,gdofs_per_sec,gbytes_per_sec
+//
+// Rates are computed from the number of unknowns in the L-vector and from the bytes each kernel must read and write at least once, counting
+// CeedScalar data and CeedInt offsets; cached basis matrices are not counted.
+
+#define _POSIX_C_SOURCE 200112L
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef enum {
+  KERNEL_RESTRICTION_NOTRANSPOSE,
+  KERNEL_RESTRICTION_TRANSPOSE,
+  KERNEL_BASIS_INTERP,
+  KERNEL_BASIS_GRAD,
+  KERNEL_BASIS_INTERP_NONTENSOR,
+  KERNEL_BASIS_GRAD_NONTENSOR,
+  KERNEL_QFUNCTION_MASS,
+  KERNEL_QFUNCTION_POISSON,
+  KERNEL_OPERATOR_MASS,
+  KERNEL_OPERATOR_POISSON,
+  KERNEL_OPERATOR_POISSON_FP32,
+  NUM_KERNELS,
+} KernelType;
+
+static const char *const kernel_names[NUM_KERNELS] = {
+    [KERNEL_RESTRICTION_NOTRANSPOSE] = "restriction-notranspose",
+    [KERNEL_RESTRICTION_TRANSPOSE]   = "restriction-transpose",
+    [KERNEL_BASIS_INTERP]            = "basis-interp",
+    [KERNEL_BASIS_GRAD]              = "basis-grad",
+    [KERNEL_BASIS_INTERP_NONTENSOR]  = "basis-interp-nontensor",
+    [KERNEL_BASIS_GRAD_NONTENSOR]    = "basis-grad-nontensor",
+    [KERNEL_QFUNCTION_MASS]          = "qfunction-mass",
+    [KERNEL_QFUNCTION_POISSON]       = "qfunction-poisson",
+    [KERNEL_OPERATOR_MASS]           = "operator-mass",
+    [KERNEL_OPERATOR_POISSON]        = "operator-poisson",
+    [KERNEL_OPERATOR_POISSON_FP32]   = "operator-poisson-fp32",
+};
+
+// libCEED objects for one problem size
+typedef struct {
+  CeedInt             dim, num_comp, num_elem, elem_size, num_qpts, q_data_size;
+  CeedSize            num_unknowns;
+  CeedElemRestriction rstr_u;
+  CeedBasis           basis_u, basis_u_nontensor;
+  CeedQFunction       qf_mass, qf_poisson;
+  CeedOperator        op_mass, op_poisson, op_poisson_fp32;
+  CeedVector          u, v, u_e, u_q, du_q, v_q, dv_q, q_data_mass, q_data_poisson;
+} BenchData;
+
+static double Wtime(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + 1e-9 * t.tv_nsec;
+}
+
+// Element restriction for a structured box of n^dim elements with P nodes in each direction
+static void BuildRestriction(Ceed ceed, CeedInt dim, CeedInt n, CeedInt P, CeedInt num_comp, CeedElemRestriction *rstr, CeedSize *num_nodes) {
+  const CeedInt nodes_1d = n * (P - 1) + 1, elem_size = CeedIntPow(P, dim), num_elem = CeedIntPow(n, dim);
+  CeedInt      *offsets = malloc(sizeof(CeedInt) * num_elem * elem_size);
+
+  *num_nodes = CeedIntPow(nodes_1d, dim);
+  for (CeedInt e = 0; e < num_elem; e++) {
+    for (CeedInt node = 0; node < elem_size; node++) {
+      CeedInt offset = 0, stride = 1;
+      for (CeedInt d = 0; d < dim; d++) {
+        const CeedInt e_d = (e / CeedIntPow(n, d)) % n, node_d = (node / CeedIntPow(P, d)) % P;
+        offset += (e_d * (P - 1) + node_d) * stride;
+        stride *= nodes_1d;
+      }
+      offsets[e * elem_size + node] = offset;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, *num_nodes, num_comp * *num_nodes, CEED_MEM_HOST, CEED_COPY_VALUES, offsets,
+                            rstr);
+  free(offsets);
+}
+
+// Build the geometric factors with a gallery QFunction
+static void BuildQData(Ceed ceed, const char *name, CeedElemRestriction rstr_x, CeedBasis basis_x, CeedVector x, CeedElemRestriction rstr_q_data,
+                       CeedVector q_data) {
+  CeedQFunction qf_build;
+  CeedOperator  op_build;
+
+  CeedQFunctionCreateInteriorByName(ceed, name, &qf_build);
+  CeedOperatorCreate(ceed, qf_build, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_build);
+  CeedOperatorSetField(op_build, "dx", rstr_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_build, "weights", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_build, "qdata", rstr_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorApply(op_build, x, q_data, CEED_REQUEST_IMMEDIATE);
+  CeedQFunctionDestroy(&qf_build);
+  CeedOperatorDestroy(&op_build);
+}
+
+// Set up the restriction, bases, QFunctions, and operators for a mesh with n^dim elements of degree P - 1
+static void BenchDataCreate(Ceed ceed, CeedInt dim, CeedInt P, CeedInt Q, CeedInt num_comp, CeedInt n, BenchData *data) {
+  const CeedInt num_elem = CeedIntPow(n, dim), num_qpts = CeedIntPow(Q, dim), q_data_size = dim * (dim + 1) / 2;
+  CeedSize      num_nodes, num_nodes_x;
+  char          name[32];
+
+  memset(data, 0, sizeof(*data));
+  data->dim         = dim;
+  data->num_comp    = num_comp;
+  data->num_elem    = num_elem;
+  data->elem_size   = CeedIntPow(P, dim);
+  data->num_qpts    = num_qpts;
+  data->q_data_size = q_data_size;
+
+  // Bases; the non-tensor basis has the same matrices without the tensor structure
+  CeedBasis basis_x;
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, dim, 2, Q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, dim, num_comp, P, Q, CEED_GAUSS, &data->basis_u);
+  {
+    const CeedScalar      *interp, *grad, *q_ref, *q_weight;
+    const CeedElemTopology topo[3] = {CEED_TOPOLOGY_LINE, CEED_TOPOLOGY_QUAD, CEED_TOPOLOGY_HEX};
+    CeedBasisGetInterp(data->basis_u, &interp);
+    CeedBasisGetGrad(data->basis_u, &grad);
+    CeedBasisGetQRef(data->basis_u, &q_ref);
+    CeedBasisGetQWeights(data->basis_u, &q_weight);
+    CeedBasisCreateH1(ceed, topo[dim - 1], num_comp, data->elem_size, num_qpts, interp, grad, q_ref, q_weight, &data->basis_u_nontensor);
+  }
+
+  // Restrictions
+  CeedElemRestriction rstr_x, rstr_q_data_mass, rstr_q_data_poisson;
+  BuildRestriction(ceed, dim, n, 2, dim, &rstr_x, &num_nodes_x);
+  BuildRestriction(ceed, dim, n, P, num_comp, &data->rstr_u, &num_nodes);
+  data->num_unknowns = num_comp * num_nodes;
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, 1, num_elem * num_qpts, CEED_STRIDES_BACKEND, &rstr_q_data_mass);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, num_qpts, q_data_size, q_data_size * num_elem * num_qpts, CEED_STRIDES_BACKEND,
+                                   &rstr_q_data_poisson);
+
+  // Vectors
+  CeedVector x;
+  CeedVectorCreate(ceed, dim * num_nodes_x, &x);
+  {
+    CeedScalar *x_array;
+    CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt i = 0; i < num_nodes_x; i++) {
+      for (CeedInt d = 0; d < dim; d++) x_array[i + d * num_nodes_x] = ((i / CeedIntPow(n + 1, d)) % (n + 1)) / (CeedScalar)n;
+    }
+    CeedVectorRestoreArray(x, &x_array);
+  }
+  CeedVectorCreate(ceed, data->num_unknowns, &data->u);
+  CeedVectorCreate(ceed, data->num_unknowns, &data->v);
+  CeedVectorCreate(ceed, num_comp * data->elem_size * num_elem, &data->u_e);
+  CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &data->u_q);
+  CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &data->du_q);
+  CeedVectorCreate(ceed, num_comp * num_qpts * num_elem, &data->v_q);
+  CeedVectorCreate(ceed, dim * num_comp * num_qpts * num_elem, &data->dv_q);
+  CeedVectorCreate(ceed, num_qpts * num_elem, &data->q_data_mass);
+  CeedVectorCreate(ceed, q_data_size * num_qpts * num_elem, &data->q_data_poisson);
+  CeedVectorSetValue(data->u, 1.0);
+  CeedVectorSetValue(data->v, 0.0);
+  CeedVectorSetValue(data->u_e, 1.0);
+  CeedVectorSetValue(data->u_q, 1.0);
+  CeedVectorSetValue(data->du_q, 1.0);
+  CeedVectorSetValue(data->v_q, 0.0);
+  CeedVectorSetValue(data->dv_q, 0.0);
+
+  // Geometric factors
+  snprintf(name, sizeof(name), "Mass%" CeedInt_FMT "DBuild", dim);
+  BuildQData(ceed, name, rstr_x, basis_x, x, rstr_q_data_mass, data->q_data_mass);
+  snprintf(name, sizeof(name), "Poisson%" CeedInt_FMT "DBuild", dim);
+  BuildQData(ceed, name, rstr_x, basis_x, x, rstr_q_data_poisson, data->q_data_poisson);
+
+  // Gallery QFunctions and operators, only for scalar and 3 component problems
+  if (num_comp == 1 || num_comp == 3) {
+    snprintf(name, sizeof(name), "%sMassApply", num_comp == 1 ? "" : "Vector3");
+    CeedQFunctionCreateInteriorByName(ceed, name, &data->qf_mass);
+    CeedOperatorCreate(ceed, data->qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &data->op_mass);
+    CeedOperatorSetField(data->op_mass, "u", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(data->op_mass, "qdata", rstr_q_data_mass, CEED_BASIS_COLLOCATED, data->q_data_mass);
+    CeedOperatorSetField(data->op_mass, "v", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+
+    snprintf(name, sizeof(name), "%sPoisson%" CeedInt_FMT "DApply", num_comp == 1 ? "" : "Vector3", dim);
+    CeedQFunctionCreateInteriorByName(ceed, name, &data->qf_poisson);
+    CeedOperatorCreate(ceed, data->qf_poisson, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &data->op_poisson);
+    CeedOperatorSetField(data->op_poisson, "du", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(data->op_poisson, "qdata", rstr_q_data_poisson, CEED_BASIS_COLLOCATED, data->q_data_poisson);
+    CeedOperatorSetField(data->op_poisson, "dv", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+
+    // Same operator with geometric factors stored in single precision, if the backend supports it
+    CeedOperatorCreate(ceed, data->qf_poisson, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &data->op_poisson_fp32);
+    CeedOperatorSetField(data->op_poisson_fp32, "du", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(data->op_poisson_fp32, "qdata", rstr_q_data_poisson, CEED_BASIS_COLLOCATED, data->q_data_poisson);
+    CeedOperatorSetField(data->op_poisson_fp32, "dv", data->rstr_u, data->basis_u, CEED_VECTOR_ACTIVE);
+    {
+      const char *err_msg;
+
+      CeedSetErrorHandler(ceed, CeedErrorStore);
+      if (CeedOperatorSetPrecision(data->op_poisson_fp32, CEED_SCALAR_FP32)) CeedOperatorDestroy(&data->op_poisson_fp32);
+      CeedResetErrorMessage(ceed, &err_msg);
+      CeedSetErrorHandler(ceed, CeedErrorAbort);
+    }
+  }
+
+  CeedVectorDestroy(&x);
+  CeedBasisDestroy(&basis_x);
+  CeedElemRestrictionDestroy(&rstr_x);
+  CeedElemRestrictionDestroy(&rstr_q_data_mass);
+  CeedElemRestrictionDestroy(&rstr_q_data_poisson);
+}
+
+static void BenchDataDestroy(BenchData *data) {
+  CeedElemRestrictionDestroy(&data->rstr_u);
+  CeedBasisDestroy(&data->basis_u);
+  CeedBasisDestroy(&data->basis_u_nontensor);
+  CeedQFunctionDestroy(&data->qf_mass);
+  CeedQFunctionDestroy(&data->qf_poisson);
+  CeedOperatorDestroy(&data->op_mass);
+  CeedOperatorDestroy(&data->op_poisson);
+  CeedOperatorDestroy(&data->op_poisson_fp32);
+  CeedVectorDestroy(&data->u);
+  CeedVectorDestroy(&data->v);
+  CeedVectorDestroy(&data->u_e);
+  CeedVectorDestroy(&data->u_q);
+  CeedVectorDestroy(&data->du_q);
+  CeedVectorDestroy(&data->v_q);
+  CeedVectorDestroy(&data->dv_q);
+  CeedVectorDestroy(&data->q_data_mass);
+  CeedVectorDestroy(&data->q_data_poisson);
+}
+
+// Check if a kernel is available for this problem
+static int KernelIsAvailable(const BenchData *data, KernelType kernel) {
+  switch (kernel) {
+    case KERNEL_QFUNCTION_MASS:
+    case KERNEL_QFUNCTION_POISSON:
+    case KERNEL_OPERATOR_MASS:
+    case KERNEL_OPERATOR_POISSON:
+      return data->num_comp == 1 || data->num_comp == 3;
+    case KERNEL_OPERATOR_POISSON_FP32:
+      return data->op_poisson_fp32 != NULL;
+    default:
+      return 1;
+  }
+}
+
+// Apply one kernel
+static void KernelApply(BenchData *data, KernelType kernel) {
+  const CeedInt num_qpts_total = data->num_qpts * data->num_elem;
+
+  switch (kernel) {
+    case KERNEL_RESTRICTION_NOTRANSPOSE:
+      CeedElemRestrictionApply(data->rstr_u, CEED_NOTRANSPOSE, data->u, data->u_e, CEED_REQUEST_IMMEDIATE);
+      break;
+    case KERNEL_RESTRICTION_TRANSPOSE:
+      CeedElemRestrictionApply(data->rstr_u, CEED_TRANSPOSE, data->u_e, data->v, CEED_REQUEST_IMMEDIATE);
+      break;
+    case KERNEL_BASIS_INTERP:
+      CeedBasisApply(data->basis_u, data->num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, data->u_e, data->u_q);
+      break;
+    case KERNEL_BASIS_GRAD:
+      CeedBasisApply(data->basis_u, data->num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, data->u_e, data->du_q);
+      break;
+    case KERNEL_BASIS_INTERP_NONTENSOR:
+      CeedBasisApply(data->basis_u_nontensor, data->num_elem, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, data->u_e, data->u_q);
+      break;
+    case KERNEL_BASIS_GRAD_NONTENSOR:
+      CeedBasisApply(data->basis_u_nontensor, data->num_elem, CEED_NOTRANSPOSE, CEED_EVAL_GRAD, data->u_e, data->du_q);
+      break;
+    case KERNEL_QFUNCTION_MASS: {
+      CeedVector in[2] = {data->u_q, data->q_data_mass}, out[1] = {data->v_q};
+      CeedQFunctionApply(data->qf_mass, num_qpts_total, in, out);
+    } break;
+    case KERNEL_QFUNCTION_POISSON: {
+      CeedVector in[2] = {data->du_q, data->q_data_poisson}, out[1] = {data->dv_q};
+      CeedQFunctionApply(data->qf_poisson, num_qpts_total, in, out);
+    } break;
+    case KERNEL_OPERATOR_MASS:
+      CeedOperatorApply(data->op_mass, data->u, data->v, CEED_REQUEST_IMMEDIATE);
+      break;
+    case KERNEL_OPERATOR_POISSON:
+      CeedOperatorApply(data->op_poisson, data->u, data->v, CEED_REQUEST_IMMEDIATE);
+      break;
+    case KERNEL_OPERATOR_POISSON_FP32:
+      CeedOperatorApply(data->op_poisson_fp32, data->u, data->v, CEED_REQUEST_IMMEDIATE);
+      break;
+    default:
+      break;
+  }
+}
+
+// Bytes each kernel reads and writes at least once
+static double KernelBytes(const BenchData *data, KernelType kernel) {
+  const double scalar = sizeof(CeedScalar), num_l = data->num_unknowns, num_e = (double)data->num_comp * data->elem_size * data->num_elem;
+  const double num_q = (double)data->num_comp * data->num_qpts * data->num_elem, num_offsets = (double)data->elem_size * data->num_elem;
+  const double num_q_data_mass = (double)data->num_qpts * data->num_elem, num_q_data_poisson = data->q_data_size * num_q_data_mass;
+
+  switch (kernel) {
+    case KERNEL_RESTRICTION_NOTRANSPOSE:
+      return scalar * (num_l + num_e) + sizeof(CeedInt) * num_offsets;
+    case KERNEL_RESTRICTION_TRANSPOSE:
+      return scalar * (num_e + 2 * num_l) + sizeof(CeedInt) * num_offsets;
+    case KERNEL_BASIS_INTERP:
+    case KERNEL_BASIS_INTERP_NONTENSOR:
+      return scalar * (num_e + num_q);
+    case KERNEL_BASIS_GRAD:
+    case KERNEL_BASIS_GRAD_NONTENSOR:
+      return scalar * (num_e + data->dim * num_q);
+    case KERNEL_QFUNCTION_MASS:
+      return scalar * (2 * num_q + num_q_data_mass);
+    case KERNEL_QFUNCTION_POISSON:
+      return scalar * (2 * data->dim * num_q + num_q_data_poisson);
+    case KERNEL_OPERATOR_MASS:
+      return scalar * (2 * num_l + num_q_data_mass) + sizeof(CeedInt) * num_offsets;
+    case KERNEL_OPERATOR_POISSON:
+      return scalar * (2 * num_l + num_q_data_poisson) + sizeof(CeedInt) * num_offsets;
+    case KERNEL_OPERATOR_POISSON_FP32:
+      return scalar * 2 * num_l + sizeof(float) * num_q_data_poisson + sizeof(CeedInt) * num_offsets;
+    default:
+      return 0.0;
+  }
+}
+
+// Time a kernel, doubling the number of repetitions until the run takes at least min_time seconds
+static double KernelTime(BenchData *data, KernelType kernel, double min_time, CeedInt *num_reps) {
+  double elapsed = 0.0;
+
+  // Warm up, including backend setup
+  KernelApply(data, kernel);
+  for (*num_reps = 1;; *num_reps *= 2) {
+    const double start = Wtime();
+
+    for (CeedInt i = 0; i < *num_reps; i++) KernelApply(data, kernel);
+    elapsed = Wtime() - start;
+    if (elapsed >= min_time || *num_reps >= (1 << 20)) break;
+  }
+  return elapsed / *num_reps;
+}
+
+int main(int argc, const char *argv[]) {
+  const char *ceed_spec   = "/cpu/self";
+  const char *kernel_list = NULL;
+  CeedInt     dim         = 3;
+  CeedInt     degree_min  = 1;
+  CeedInt     degree_max  = 6;
+  CeedInt     num_comp[2] = {1, 3};
+  CeedSize    max_dofs    = 1 << 18;
+  double      min_time    = 0.02;
+  int         header      = 1;
+
+  // Process command line arguments
+  for (int ia = 1; ia < argc; ia++) {
+    // LCOV_EXCL_START
+    int next_arg = ((ia + 1) < argc), parse_error = 0;
+    if (!strcmp(argv[ia], "-h")) {
+      printf("usage: %s [-ceed resource] [-d dim] [-pmin degree] [-pmax degree] [-c num_comp] [-s max unknowns] [-t min seconds]\n", argv[0]);
+      printf("       [-k kernel prefix[,kernel prefix...]] [-no-header] [-header-only]\n");
+      return 0;
+    } else if (!strcmp(argv[ia], "-ceed")) {
+      parse_error = next_arg ? ceed_spec = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia], "-d")) {
+      parse_error = next_arg ? dim = atoi(argv[++ia]), 0 : 1;
+      if (dim < 1 || dim > 3) parse_error = 1;
+    } else if (!strcmp(argv[ia], "-pmin")) {
+      parse_error = next_arg ? degree_min = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-pmax")) {
+      parse_error = next_arg ? degree_max = atoi(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-c")) {
+      parse_error = next_arg ? num_comp[0] = num_comp[1] = atoi(argv[++ia]), 0 : 1;
+      if (num_comp[0] < 1) parse_error = 1;
+    } else if (!strcmp(argv[ia], "-s")) {
+      parse_error = next_arg ? max_dofs = atoll(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-t")) {
+      parse_error = next_arg ? min_time = atof(argv[++ia]), 0 : 1;
+    } else if (!strcmp(argv[ia], "-k")) {
+      parse_error = next_arg ? kernel_list = argv[++ia], 0 : 1;
+    } else if (!strcmp(argv[ia], "-no-header")) {
+      header = 0;
+    } else if (!strcmp(argv[ia], "-header-only")) {
+      header = 2;
+    } else {
+      parse_error = 1;
+    }
+    if (parse_error || degree_min < 1 || degree_max < degree_min) {
+      printf("Error parsing command line options.\n");
+      return 1;
+    }
+    // LCOV_EXCL_STOP
+  }
+
+  if (header) printf("kernel,backend,memtype,dim,degree,quadrature_pts,num_comp,num_elem,num_unknowns,reps,seconds,gdofs_per_sec,gbytes_per_sec\n");
+  if (header == 2) return 0;
+
+  Ceed        ceed;
+  const char *resource;
+  CeedMemType mem_type;
+  CeedInit(ceed_spec, &ceed);
+  CeedGetResource(ceed, &resource);
+  CeedGetPreferredMemType(ceed, &mem_type);
+
+  // Kernels selected by prefix
+  int use_kernel[NUM_KERNELS];
+  for (CeedInt k = 0; k < NUM_KERNELS; k++) {
+    use_kernel[k] = !kernel_list;
+    for (const char *prefix = kernel_list; prefix && *prefix; prefix += strcspn(prefix, ",") + (prefix[strcspn(prefix, ",")] == ',')) {
+      const size_t length = strcspn(prefix, ",");
+      if (length && !strncmp(kernel_names[k], prefix, length)) use_kernel[k] = 1;
+    }
+  }
+
+  // Sweep over degree, number of components, and number of elements, roughly doubling the number of elements each step
+  for (CeedInt degree = degree_min; degree <= degree_max; degree++) {
+    const CeedInt P = degree + 1, Q = P + 1;
+
+    for (CeedInt c = 0; c < (num_comp[0] == num_comp[1] ? 1 : 2); c++) {
+      for (CeedInt n = 1;; n = fmax(n + 1, round(n * pow(2.0, 1.0 / dim)))) {
+        const CeedSize num_unknowns = num_comp[c] * CeedIntPow(n * degree + 1, dim);
+        BenchData      data;
+
+        if (num_unknowns > max_dofs) break;
+        BenchDataCreate(ceed, dim, P, Q, num_comp[c], n, &data);
+        for (CeedInt k = 0; k < NUM_KERNELS; k++) {
+          CeedInt num_reps;
+
+          if (!use_kernel[k] || !KernelIsAvailable(&data, k)) continue;
+          const double seconds = KernelTime(&data, k, min_time, &num_reps);
+          printf("%s,%s,%s,%" CeedInt_FMT ",%" CeedInt_FMT ",%" CeedInt_FMT ",%" CeedInt_FMT ",%" CeedInt_FMT ",%td,%" CeedInt_FMT,
+                 kernel_names[k], resource, CeedMemTypes[mem_type], dim, degree, Q, num_comp[c], data.num_elem, data.num_unknowns, num_reps);
+          printf(",%.6e,%.6e,%.6e\n", seconds, 1e-9 * data.num_unknowns / seconds, 1e-9 * KernelBytes(&data, k) / seconds);
+          fflush(stdout);
+        }
+        BenchDataDestroy(&data);
+      }
+    }
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -40,9 +40,32 @@ def read_logs(files=None):
     data = data_default.copy()
 
     runs = []
+    csv_columns = None
     for line in fileinput.input(files):
+        # CSV output from bench-kernels, one run per line
+        if line.startswith('kernel,backend,'):
+            csv_columns = line.strip().split(',')
+        elif csv_columns and line.count(',') == len(csv_columns) - 1:
+            run = dict(zip(csv_columns, line.strip().split(',')))
+            data = data_default.copy()
+            runs.append(data)
+            data['file'] = fileinput.filename()
+            data['test'] = 'Kernel ' + run['kernel']
+            data['backend'] = run['backend']
+            data['backend_memtype'] = run['memtype']
+            data['num_procs'] = 1
+            data['num_procs_node'] = 1
+            data['case'] = 'scalar' if run['num_comp'] == '1' else 'vector'
+            for key in ['dim', 'degree', 'quadrature_pts', 'num_comp',
+                        'num_elem', 'num_unknowns', 'reps']:
+                data[key] = int(run[key])
+            for key in ['seconds', 'gdofs_per_sec', 'gbytes_per_sec']:
+                data[key] = float(run[key])
+            data['time_per_it'] = data['seconds']
+            # Plotted as DoFs x applications / seconds
+            data['cg_iteration_dps'] = 1e9 * data['gdofs_per_sec']
         # Legacy header contains number of MPI tasks
-        if 'Running the tests using a total of' in line:
+        elif 'Running the tests using a total of' in line:
             data = data_default.copy()
             data['num_procs'] = int(
                 line.split(
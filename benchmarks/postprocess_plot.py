@@ -59,6 +59,8 @@ print('Using test:', test)
 
 if 'CEED Benchmark Problem' in test:
     test_short = test.strip().split()[0] + ' BP' + test.strip().split()[-1]
+else:
+    test_short = test.strip()
 
 # Plot same BP
 sel_runs = sel_runs.loc[sel_runs['test'] == test]
@@ -14,6 +14,8 @@
 #include <ceed/ceed.h>
 #include <stdbool.h>
 
+#define CEED_RANGE_OPERATOR_MAX 16
+
 CEED_INTERN const char *CeedJitSourceRootDefault;
 
 /** @defgroup CeedUser Public API for Ceed
@@ -83,16 +85,82 @@ typedef struct {
   Ceed  delegate;
 } ObjDelegate;
 
+typedef struct CeedRequestQueue_private *CeedRequestQueue;
+typedef struct CeedThreadMutex_private  *CeedThreadMutex;
+
+// Profiled phases of CeedOperator application and assembly
+typedef enum {
+  CEED_PROFILE_PHASE_APPLY,
+  CEED_PROFILE_PHASE_RESTRICT_IN,
+  CEED_PROFILE_PHASE_RESTRICT_OUT,
+  CEED_PROFILE_PHASE_BASIS,
+  CEED_PROFILE_PHASE_QFUNCTION,
+  CEED_PROFILE_PHASE_ASSEMBLE_QFUNCTION,
+  CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL,
+  CEED_PROFILE_PHASE_ASSEMBLE,
+  CEED_PROFILE_NUM_PHASES,
+} CeedProfilePhase;
+
+typedef struct {
+  CeedSize num_calls;
+  double   time;
+  CeedSize flops, bytes;
+  bool     is_running;
+} CeedProfileStage;
+
+typedef struct {
+  char            *name;
+  CeedProfileStage stages[CEED_PROFILE_NUM_PHASES];
+} CeedProfileEntry;
+
+typedef struct CeedProfile_private *CeedProfile;
+struct CeedProfile_private {
+  CeedProfileFormat format;
+  CeedInt           num_entries, current;
+  CeedInt           num_suspended; /* Number of active CeedProfileSuspend() calls, phases are not recorded while suspended */
+  CeedProfileEntry *entries;
+};
+
+typedef struct {
+  CeedProfile      profile;
+  CeedProfilePhase phase;
+  CeedInt          entry, prev_entry;
+  double           start;
+  bool             is_active;
+} CeedProfileTimer;
+
+// Call a function inside a phase started with CeedProfileBegin(), stopping the timer without recording the phase on error
+#define CeedProfileCall(timer, ...) \
+  do {                              \
+    int ierr_p_ = __VA_ARGS__;      \
+    if (ierr_p_) {                  \
+      CeedProfileAbort(timer);      \
+      return ierr_p_;               \
+    }                               \
+  } while (0)
+
+typedef struct {
+  CeedInt     num_vecs, max_vecs;
+  bool       *is_in_use;
+  CeedVector *vecs;
+} CeedWorkVectors;
+
 struct Ceed_private {
-  const char  *resource;
-  Ceed         delegate;
-  Ceed         parent;
-  ObjDelegate *obj_delegates;
-  int          obj_delegate_count;
-  Ceed         op_fallback_ceed, op_fallback_parent;
-  const char  *op_fallback_resource;
-  char       **jit_source_roots;
-  CeedInt      num_jit_source_roots;
+  const char      *resource;
+  Ceed             delegate;
+  Ceed             parent;
+  ObjDelegate     *obj_delegates;
+  int              obj_delegate_count;
+  Ceed             op_fallback_ceed, op_fallback_parent;
+  const char      *op_fallback_resource;
+  char           **jit_source_roots;
+  CeedInt          num_jit_source_roots;
+  char            *jit_cache_dir;
+  CeedRequestQueue request_queue;
+  CeedThreadMutex  thread_mutex;
+  CeedProfile      profile;
+  int              host_memory_policy;
+  CeedWorkVectors  work_vectors;
   int (*Error)(Ceed, const char *, int, const char *, int, const char *, va_list *);
   int (*GetPreferredMemType)(CeedMemType *);
   int (*Destroy)(Ceed);
@@ -100,6 +168,8 @@ struct Ceed_private {
   int (*ElemRestrictionCreate)(CeedMemType, CeedCopyMode, const CeedInt *, CeedElemRestriction);
   int (*ElemRestrictionCreateOriented)(CeedMemType, CeedCopyMode, const CeedInt *, const bool *, CeedElemRestriction);
   int (*ElemRestrictionCreateBlocked)(CeedMemType, CeedCopyMode, const CeedInt *, CeedElemRestriction);
+  int (*ElemRestrictionCreate64)(CeedMemType, CeedCopyMode, const CeedSize *, CeedElemRestriction);
+  int (*ElemRestrictionCreateBlocked64)(CeedMemType, CeedCopyMode, const CeedSize *, CeedElemRestriction);
   int (*BasisCreateTensorH1)(CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *, CeedBasis);
   int (*BasisCreateH1)(CeedElemTopology, CeedInt, CeedInt, CeedInt, const CeedScalar *, const CeedScalar *, const CeedScalar *, const CeedScalar *,
                        CeedBasis);
@@ -110,6 +180,7 @@ struct Ceed_private {
   int (*QFunctionContextCreate)(CeedQFunctionContext);
   int (*OperatorCreate)(CeedOperator);
   int (*CompositeOperatorCreate)(CeedOperator);
+  int (*HostFirstTouch)(Ceed, void *, size_t);
   int      ref_count;
   void    *data;
   bool     is_debug;
@@ -119,6 +190,16 @@ struct Ceed_private {
   FOffset *f_offsets;
 };
 
+struct CeedRequest_private {
+  CeedRequestQueue queue;
+  CeedOperator     op;
+  CeedVector       in, out;
+  bool             is_done;
+  int              error_code;
+  CeedRequest      next;
+  int (*Apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+};
+
 struct CeedVector_private {
   Ceed ceed;
   int (*HasValidArray)(CeedVector, bool *);
@@ -133,9 +214,13 @@ struct CeedVector_private {
   int (*RestoreArray)(CeedVector);
   int (*RestoreArrayRead)(CeedVector);
   int (*Norm)(CeedVector, CeedNormType, CeedScalar *);
+  int (*Dot)(CeedVector, CeedVector, CeedScalar *);
+  int (*MDot)(CeedVector, CeedInt, CeedVector *, CeedScalar *);
   int (*Scale)(CeedVector, CeedScalar);
   int (*AXPY)(CeedVector, CeedScalar, CeedVector);
+  int (*MAXPY)(CeedVector, CeedInt, const CeedScalar *, CeedVector *);
   int (*AXPBY)(CeedVector, CeedScalar, CeedScalar, CeedVector);
+  int (*AXPBYPCZ)(CeedVector, CeedScalar, CeedScalar, CeedScalar, CeedVector, CeedVector);
   int (*PointwiseMult)(CeedVector, CeedVector, CeedVector);
   int (*Reciprocal)(CeedVector);
   int (*Destroy)(CeedVector);
@@ -150,21 +235,24 @@ struct CeedElemRestriction_private {
   Ceed ceed;
   int (*Apply)(CeedElemRestriction, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyBlock)(CeedElemRestriction, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyBlockRange)(CeedElemRestriction, CeedInt, CeedInt, CeedTransposeMode, CeedVector, CeedVector, CeedRequest *);
   int (*GetOffsets)(CeedElemRestriction, CeedMemType, const CeedInt **);
+  int (*GetOffsets64)(CeedElemRestriction, CeedMemType, const CeedSize **);
   int (*Destroy)(CeedElemRestriction);
   int      ref_count;
-  CeedInt  num_elem;    /* number of elements */
-  CeedInt  elem_size;   /* number of nodes per element */
-  CeedInt  num_comp;    /* number of components */
-  CeedInt  comp_stride; /* Component stride for L-vector ordering */
-  CeedSize l_size;      /* size of the L-vector, can be used for checking for correct vector sizes */
-  CeedInt  blk_size;    /* number of elements in a batch */
-  CeedInt  num_blk;     /* number of blocks of elements */
-  CeedInt *strides;     /* strides between [nodes, components, elements] */
-  CeedInt  layout[3];   /* E-vector layout [nodes, components, elements] */
-  uint64_t num_readers; /* number of instances of offset read only access */
-  bool     is_oriented; /* flag for oriented restriction */
-  void    *data;        /* place for the backend to store any data */
+  CeedInt  num_elem;       /* number of elements */
+  CeedInt  elem_size;      /* number of nodes per element */
+  CeedInt  num_comp;       /* number of components */
+  CeedInt  comp_stride;    /* Component stride for L-vector ordering */
+  CeedSize l_size;         /* size of the L-vector, can be used for checking for correct vector sizes */
+  CeedInt  blk_size;       /* number of elements in a batch */
+  CeedInt  num_blk;        /* number of blocks of elements */
+  CeedInt *strides;        /* strides between [nodes, components, elements] */
+  CeedInt  layout[3];      /* E-vector layout [nodes, components, elements] */
+  uint64_t num_readers;    /* number of instances of offset read only access */
+  bool     is_oriented;    /* flag for oriented restriction */
+  bool     has_offsets_64; /* flag for restriction with CeedSize offsets */
+  void    *data;           /* place for the backend to store any data */
 };
 
 struct CeedBasis_private {
@@ -254,6 +342,7 @@ struct CeedQFunctionContext_private {
   CeedInt                             max_fields;
   CeedContextFieldLabel              *field_labels;
   uint64_t                            state;
+  uint64_t                            backend_state; /* State changes from backend access during CeedQFunction application */
   uint64_t                            num_readers;
   size_t                              ctx_size;
   void                               *data;
@@ -295,6 +384,7 @@ struct CeedQFunctionAssemblyData_private {
   bool                is_setup;
   bool                reuse_data;
   bool                needs_data_update;
+  uint64_t            ctx_state; /* CeedQFunctionContext state at last assembly */
   CeedVector          vec;
   CeedElemRestriction rstr;
 };
@@ -303,10 +393,11 @@ struct CeedOperatorAssemblyData_private {
   Ceed                 ceed;
   CeedInt              num_active_bases;
   CeedBasis           *active_bases;
-  CeedElemRestriction *active_elem_rstrs;
+  CeedElemRestriction *active_elem_rstrs, *active_point_block_elem_rstrs;
   CeedInt             *num_eval_modes_in, *num_eval_modes_out;
   CeedEvalMode       **eval_modes_in, **eval_modes_out;
   CeedScalar         **assembled_bases_in, **assembled_bases_out;
+  CeedScalar         **diag_identities;
   CeedSize           **eval_mode_offsets_in, **eval_mode_offsets_out, num_output_components;
 };
 
@@ -328,7 +419,9 @@ struct CeedOperator_private {
   int (*ApplyComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAdd)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyAddComposite)(CeedOperator, CeedVector, CeedVector, CeedRequest *);
+  int (*ApplyAddRange)(CeedOperator, CeedInt, CeedInt, CeedVector, CeedVector, CeedRequest *);
   int (*ApplyJacobian)(CeedOperator, CeedVector, CeedVector, CeedVector, CeedVector, CeedRequest *);
+  int (*SetPrecision)(CeedOperator, CeedScalarType);
   int (*Destroy)(CeedOperator);
   CeedOperatorField        *input_fields;
   CeedOperatorField        *output_fields;
@@ -345,10 +438,27 @@ struct CeedOperator_private {
   bool                      is_backend_setup;
   bool                      is_composite;
   bool                      has_restriction;
+  CeedScalarType            precision; /* Requested precision for internal data */
   CeedQFunctionAssemblyData qf_assembled;
   CeedOperatorAssemblyData  op_assembled;
   CeedOperator             *sub_operators;
   CeedInt                   num_suboperators;
+  CeedInt                   num_ghost_elem; /* Number of elements touching ghost entries */
+  CeedInt                  *ghost_elems;    /* Sorted indices of elements touching ghost entries */
+  bool                      has_ghost_elems;
+  bool                      is_ghost_split_setup;
+  CeedOperator              op_interior, op_ghost;
+  CeedInt                   num_range_ops;    /* Number of cached element range operators */
+  CeedInt                   range_op_next;    /* Index of the next cached element range operator to replace */
+  CeedInt                  *range_bounds;     /* First and one past last element of each cached element range operator */
+  CeedOperator             *range_ops;        /* Cached element range operators for backends without ApplyAddRange */
+  CeedVector                mg_p_mult_fine;   /* Fine grid multiplicity for cached multigrid level */
+  uint64_t                  mg_p_mult_state;  /* State of fine grid multiplicity for cached multigrid level */
+  CeedElemRestriction       mg_rstr_coarse;   /* Coarse grid restriction for cached multigrid level */
+  CeedBasis                 mg_basis_coarse;  /* Coarse grid basis for cached multigrid level */
+  CeedBasis                 mg_basis_c_to_f;  /* Coarse to fine basis for cached multigrid level */
+  bool                      mg_is_projection; /* Coarse to fine basis is a projection between the coarse and fine bases */
+  CeedOperator              mg_op_coarse, mg_op_prolong, mg_op_restrict;
   void                     *data;
   CeedInt                   num_context_labels;
   CeedInt                   max_context_labels;
@@ -356,5 +466,17 @@ struct CeedOperator_private {
 };
 
 CEED_INTERN int CeedOperatorGetFallback(CeedOperator op, CeedOperator *op_fallback);
+CEED_INTERN int CeedOperatorApplyQueued(CeedOperator op, int (*apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *), CeedVector in,
+                                        CeedVector out, CeedRequest *request, bool *is_queued);
+CEED_INTERN int CeedRequestQueueWait(Ceed ceed);
+CEED_INTERN int CeedRequestQueueDestroy(Ceed ceed);
+CEED_INTERN int CeedThreadLockDestroy(Ceed ceed);
+CEED_INTERN int CeedProfileBegin(Ceed ceed, CeedOperator op, CeedProfilePhase phase, CeedProfileTimer *timer);
+CEED_INTERN int CeedProfileEnd(CeedProfileTimer *timer, CeedSize flops, CeedSize bytes);
+CEED_INTERN int CeedProfileAbort(CeedProfileTimer *timer);
+CEED_INTERN int CeedProfileEndElemRestriction(CeedElemRestriction rstr, CeedInt num_blk, CeedProfileTimer *timer);
+CEED_INTERN int CeedProfileEndBasis(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedProfileTimer *timer);
+CEED_INTERN int CeedProfileEndQFunction(CeedQFunction qf, CeedInt Q, CeedProfileTimer *timer);
+CEED_INTERN int CeedProfileDestroy(Ceed ceed);
 
 #endif
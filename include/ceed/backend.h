@@ -91,9 +91,10 @@ typedef struct CeedQFunctionAssemblyData_private *CeedQFunctionAssemblyData;
 /// @ingroup CeedOperator
 typedef struct CeedOperatorAssemblyData_private *CeedOperatorAssemblyData;
 
-/* In the next 3 functions, p has to be the address of a pointer type, i.e. p has to be a pointer to a pointer. */
+/* In the next 4 functions, p has to be the address of a pointer type, i.e. p has to be a pointer to a pointer. */
 CEED_INTERN int CeedMallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedCallocArray(size_t n, size_t unit, void *p);
+CEED_INTERN int CeedHostCallocArray(Ceed ceed, size_t n, size_t unit, void *p);
 CEED_INTERN int CeedReallocArray(size_t n, size_t unit, void *p);
 CEED_INTERN int CeedStringAllocCopy(const char *source, char **copy);
 CEED_INTERN int CeedFree(void *p);
@@ -127,6 +128,7 @@ CEED_INTERN int CeedFree(void *p);
    CeedMalloc returns pointers aligned at CEED_ALIGN bytes, while CeedCalloc uses the alignment of calloc. */
 #define CeedMalloc(n, p) CeedMallocArray((n), sizeof(**(p)), p)
 #define CeedCalloc(n, p) CeedCallocArray((n), sizeof(**(p)), p)
+#define CeedHostCalloc(ceed, n, p) CeedHostCallocArray((ceed), (n), sizeof(**(p)), p)
 #define CeedRealloc(n, p) CeedReallocArray((n), sizeof(**(p)), p)
 
 CEED_EXTERN int CeedRegister(const char *prefix, int (*init)(const char *, Ceed), unsigned int priority);
@@ -134,10 +136,17 @@ CEED_EXTERN int CeedRegisterImpl(const char *prefix, int (*init)(const char *, C
 
 CEED_EXTERN int CeedIsDebug(Ceed ceed, bool *is_debug);
 CEED_EXTERN int CeedGetParent(Ceed ceed, Ceed *parent);
+CEED_EXTERN int CeedIsProfiling(Ceed ceed, bool *is_profiling);
+CEED_EXTERN int CeedProfileSuspend(Ceed ceed);
+CEED_EXTERN int CeedProfileResume(Ceed ceed);
+CEED_EXTERN int CeedThreadLock(Ceed ceed);
+CEED_EXTERN int CeedThreadUnlock(Ceed ceed);
 CEED_EXTERN int CeedGetDelegate(Ceed ceed, Ceed *delegate);
 CEED_EXTERN int CeedSetDelegate(Ceed ceed, Ceed delegate);
 CEED_EXTERN int CeedGetObjectDelegate(Ceed ceed, Ceed *delegate, const char *obj_name);
 CEED_EXTERN int CeedSetObjectDelegate(Ceed ceed, Ceed delegate, const char *obj_name);
+CEED_EXTERN int CeedGetResourceRoot(Ceed ceed, const char *resource, const char *delineator, char **resource_root);
+CEED_EXTERN int CeedGetResourceBlockSize(Ceed ceed, const char *resource, CeedInt default_blk_size, CeedInt *blk_size);
 CEED_EXTERN int CeedGetOperatorFallbackResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedGetOperatorFallbackCeed(Ceed ceed, Ceed *fallback_ceed);
 CEED_EXTERN int CeedSetOperatorFallbackResource(Ceed ceed, const char *resource);
@@ -147,6 +156,9 @@ CEED_EXTERN int CeedSetBackendFunction(Ceed ceed, const char *type, void *object
 CEED_EXTERN int CeedGetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedSetData(Ceed ceed, void *data);
 CEED_EXTERN int CeedReference(Ceed ceed);
+CEED_EXTERN int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec);
+CEED_EXTERN int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec);
+CEED_EXTERN int CeedClearWorkVectors(Ceed ceed, CeedSize min_len);
 
 CEED_EXTERN int CeedVectorHasValidArray(CeedVector vec, bool *has_valid_array);
 CEED_EXTERN int CeedVectorHasBorrowedArrayOfType(CeedVector vec, CeedMemType mem_type, bool *has_borrowed_array_of_type);
@@ -160,6 +172,9 @@ CEED_EXTERN int CeedVectorReference(CeedVector vec);
 CEED_EXTERN int CeedElemRestrictionGetStrides(CeedElemRestriction rstr, CeedInt (*strides)[3]);
 CEED_EXTERN int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets);
 CEED_EXTERN int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **offsets);
+CEED_EXTERN int CeedElemRestrictionGetOffsets64(CeedElemRestriction rstr, CeedMemType mem_type, const CeedSize **offsets);
+CEED_EXTERN int CeedElemRestrictionRestoreOffsets64(CeedElemRestriction rstr, const CeedSize **offsets);
+CEED_EXTERN int CeedElemRestrictionHasOffsets64(CeedElemRestriction rstr, bool *has_offsets_64);
 CEED_EXTERN int CeedElemRestrictionIsStrided(CeedElemRestriction rstr, bool *is_strided);
 CEED_EXTERN int CeedElemRestrictionIsOriented(CeedElemRestriction rstr, bool *is_oriented);
 CEED_EXTERN int CeedElemRestrictionHasBackendStrides(CeedElemRestriction rstr, bool *has_backend_strides);
@@ -184,6 +199,7 @@ CEED_EXTERN int CeedBasisGetCollocatedGrad(CeedBasis basis, CeedScalar *colo_gra
 CEED_EXTERN int CeedHouseholderApplyQ(CeedScalar *A, const CeedScalar *Q, const CeedScalar *tau, CeedTransposeMode t_mode, CeedInt m, CeedInt n,
                                       CeedInt k, CeedInt row, CeedInt col);
 CEED_EXTERN int CeedBasisIsTensor(CeedBasis basis, bool *is_tensor);
+CEED_EXTERN int CeedBasisIsCollocated(CeedBasis basis, bool *is_collocated);
 CEED_EXTERN int CeedBasisGetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisSetData(CeedBasis basis, void *data);
 CEED_EXTERN int CeedBasisReference(CeedBasis basis);
@@ -266,6 +282,8 @@ CEED_EXTERN int CeedOperatorAssemblyDataGetBases(CeedOperatorAssemblyData data,
                                                  const CeedScalar ***assembled_bases_in, const CeedScalar ***assembled_bases_out);
 CEED_EXTERN int CeedOperatorAssemblyDataGetElemRestrictions(CeedOperatorAssemblyData data, CeedInt *num_active_elem_rstrs,
                                                             CeedElemRestriction **active_elem_rstrs);
+CEED_EXTERN int CeedOperatorAssemblyDataGetPointBlockElemRestrictions(CeedOperatorAssemblyData data, CeedInt *num_active_point_block_elem_rstrs,
+                                                                      CeedElemRestriction **active_point_block_elem_rstrs);
 CEED_EXTERN int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data);
 
 CEED_EXTERN int CeedOperatorGetOperatorAssemblyData(CeedOperator op, CeedOperatorAssemblyData *data);
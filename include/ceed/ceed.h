@@ -101,9 +101,38 @@ CEED_EXTERN int CeedReferenceCopy(Ceed ceed, Ceed *ceed_copy);
 CEED_EXTERN int CeedGetResource(Ceed ceed, const char **resource);
 CEED_EXTERN int CeedIsDeterministic(Ceed ceed, bool *is_deterministic);
 CEED_EXTERN int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root);
+CEED_EXTERN int CeedSetJitCacheDirectory(Ceed ceed, const char *jit_cache_dir);
 CEED_EXTERN int CeedView(Ceed ceed, FILE *stream);
 CEED_EXTERN int CeedDestroy(Ceed *ceed);
 
+/// Output format for profiling data collected by a Ceed
+/// @ingroup Ceed
+typedef enum {
+  /// Profiling disabled
+  CEED_PROFILE_NONE,
+  /// Table of phases for each CeedOperator
+  CEED_PROFILE_TABLE,
+  /// JSON object with phases for each CeedOperator
+  CEED_PROFILE_JSON,
+} CeedProfileFormat;
+
+CEED_EXTERN int CeedSetProfiling(Ceed ceed, CeedProfileFormat format);
+CEED_EXTERN int CeedProfileView(Ceed ceed, CeedProfileFormat format, FILE *stream);
+
+/// Policy for allocating host arrays of CeedVectors, values may be combined with bitwise or
+/// @ingroup Ceed
+typedef enum {
+  /// Allocate with calloc, pages are placed on the NUMA node of the first thread to write them
+  CEED_HOST_MEMORY_DEFAULT = 0,
+  /// Align arrays of at least 2 MiB to 2 MiB and advise transparent huge pages
+  CEED_HOST_MEMORY_HUGE_PAGES = 1,
+  /// Zero new arrays with the threads and static partition used by the element loops of threaded backends
+  CEED_HOST_MEMORY_FIRST_TOUCH = 2,
+} CeedHostMemoryPolicy;
+
+CEED_EXTERN int CeedSetHostMemoryPolicy(Ceed ceed, int policy);
+CEED_EXTERN int CeedGetHostMemoryPolicy(Ceed ceed, int *policy);
+
 CEED_EXTERN int CeedErrorImpl(Ceed, const char *, int, const char *, int, const char *, ...);
 /// Raise an error on ceed object
 ///
@@ -220,9 +249,13 @@ CEED_EXTERN int CeedVectorGetArrayWrite(CeedVector vec, CeedMemType mem_type, Ce
 CEED_EXTERN int CeedVectorRestoreArray(CeedVector vec, CeedScalar **array);
 CEED_EXTERN int CeedVectorRestoreArrayRead(CeedVector vec, const CeedScalar **array);
 CEED_EXTERN int CeedVectorNorm(CeedVector vec, CeedNormType type, CeedScalar *norm);
+CEED_EXTERN int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result);
+CEED_EXTERN int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y, CeedScalar *results);
 CEED_EXTERN int CeedVectorScale(CeedVector x, CeedScalar alpha);
 CEED_EXTERN int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x);
+CEED_EXTERN int CeedVectorMAXPY(CeedVector y, CeedInt num_vecs, const CeedScalar *alpha, CeedVector *x);
 CEED_EXTERN int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector x);
+CEED_EXTERN int CeedVectorAXPBYPCZ(CeedVector z, CeedScalar alpha, CeedScalar beta, CeedScalar gamma, CeedVector x, CeedVector y);
 CEED_EXTERN int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y);
 CEED_EXTERN int CeedVectorReciprocal(CeedVector vec);
 CEED_EXTERN int CeedVectorView(CeedVector vec, const char *fp_fmt, FILE *stream);
@@ -276,18 +309,27 @@ CEED_EXTERN int CeedElemRestrictionCreate(Ceed ceed, CeedInt num_elem, CeedInt e
 CEED_EXTERN int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride,
                                                   CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode, const CeedInt *offsets,
                                                   const bool *orient, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreate64(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
+                                            CeedMemType mem_type, CeedCopyMode copy_mode, const CeedSize *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedSize l_size,
                                                  const CeedInt strides[3], CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt blk_size, CeedInt num_comp,
                                                  CeedInt comp_stride, CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
                                                  const CeedInt *offsets, CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateBlocked64(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt blk_size, CeedInt num_comp,
+                                                   CeedInt comp_stride, CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode,
+                                                   const CeedSize *offsets, CeedElemRestriction *rstr);
 CEED_EXTERN int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt blk_size, CeedInt num_comp,
                                                         CeedSize l_size, const CeedInt strides[3], CeedElemRestriction *rstr);
+CEED_EXTERN int CeedElemRestrictionCreateSubset(CeedElemRestriction rstr, CeedInt num_elem, const CeedInt *elem_indices,
+                                                CeedElemRestriction *rstr_subset);
 CEED_EXTERN int CeedElemRestrictionReferenceCopy(CeedElemRestriction rstr, CeedElemRestriction *rstr_copy);
 CEED_EXTERN int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *lvec, CeedVector *evec);
 CEED_EXTERN int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedVector u, CeedVector ru, CeedRequest *request);
 CEED_EXTERN int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
                                               CeedRequest *request);
+CEED_EXTERN int CeedElemRestrictionApplyBlockRange(CeedElemRestriction rstr, CeedInt block_start, CeedInt block_stop, CeedTransposeMode t_mode,
+                                                   CeedVector u, CeedVector ru, CeedRequest *request);
 CEED_EXTERN int CeedElemRestrictionGetCeed(CeedElemRestriction rstr, Ceed *ceed);
 CEED_EXTERN int CeedElemRestrictionGetCompStride(CeedElemRestriction rstr, CeedInt *comp_stride);
 CEED_EXTERN int CeedElemRestrictionGetNumElements(CeedElemRestriction rstr, CeedInt *num_elem);
@@ -297,6 +339,7 @@ CEED_EXTERN int CeedElemRestrictionGetNumComponents(CeedElemRestriction rstr, Ce
 CEED_EXTERN int CeedElemRestrictionGetNumBlocks(CeedElemRestriction rstr, CeedInt *num_blk);
 CEED_EXTERN int CeedElemRestrictionGetBlockSize(CeedElemRestriction rstr, CeedInt *blk_size);
 CEED_EXTERN int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr, CeedVector mult);
+CEED_EXTERN int CeedElemRestrictionGetGhostElements(CeedElemRestriction rstr, CeedVector ghost_mask, CeedInt *num_ghost_elem, CeedInt *elem_indices);
 CEED_EXTERN int CeedElemRestrictionView(CeedElemRestriction rstr, FILE *stream);
 CEED_EXTERN int CeedElemRestrictionDestroy(CeedElemRestriction *rstr);
 
@@ -503,6 +546,8 @@ CEED_EXTERN int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVec
                                                    CeedOperator *op_prolong, CeedOperator *op_restrict);
 CEED_EXTERN int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv, CeedRequest *request);
 CEED_EXTERN int CeedOperatorSetNumQuadraturePoints(CeedOperator op, CeedInt num_qpts);
+CEED_EXTERN int CeedOperatorSetPrecision(CeedOperator op, CeedScalarType precision);
+CEED_EXTERN int CeedOperatorGetPrecision(CeedOperator op, CeedScalarType *precision);
 CEED_EXTERN int CeedOperatorSetName(CeedOperator op, const char *name);
 CEED_EXTERN int CeedOperatorView(CeedOperator op, FILE *stream);
 CEED_EXTERN int CeedOperatorGetCeed(CeedOperator op, Ceed *ceed);
@@ -519,6 +564,12 @@ CEED_EXTERN int CeedOperatorGetContextInt32Read(CeedOperator op, CeedContextFiel
 CEED_EXTERN int CeedOperatorRestoreContextInt32Read(CeedOperator op, CeedContextFieldLabel field_label, const int **values);
 CEED_EXTERN int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddRange(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in, CeedVector out,
+                                          CeedRequest *request);
+CEED_EXTERN int CeedOperatorSetGhostElements(CeedOperator op, CeedInt num_ghost_elem, const CeedInt *elem_indices);
+CEED_EXTERN int CeedOperatorApplyInterior(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddInterior(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
+CEED_EXTERN int CeedOperatorApplyAddGhost(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request);
 CEED_EXTERN int CeedOperatorDestroy(CeedOperator *op);
 
 CEED_EXTERN int CeedOperatorGetFieldByName(CeedOperator op, const char *field_name, CeedOperatorField *op_field);
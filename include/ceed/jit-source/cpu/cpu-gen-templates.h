@@ -0,0 +1,253 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+/// @file
+/// Internal header for CPU code generation backend element kernels
+///
+/// All sizes are passed as arguments; the generated operator calls these helpers with literal values so the host compiler can specialize each call.
+/// Element blocks are interleaved, with the element index fastest, so the contractions vectorize across the elements of a block.
+#ifndef _ceed_cpu_gen_templates_h
+#define _ceed_cpu_gen_templates_h
+
+#include <ceed/types.h>
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, offsets provided
+//   Element block E-vectors are interleaved, r_u[comp * r_comp_stride + node * blk_size + e], and the last block is padded with its final element
+//------------------------------------------------------------------------------
+static inline void readDofsOffset(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt blk_size,
+                                  const CeedInt num_elem, const CeedInt e_start, const CeedInt *restrict indices, const CeedScalar *restrict d_u,
+                                  CeedScalar *restrict r_u, const CeedInt r_comp_stride) {
+  for (CeedInt e = 0; e < blk_size; e++) {
+    const CeedInt elem = e_start + e < num_elem ? e_start + e : num_elem - 1;
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt node = 0; node < elem_size; node++) {
+        r_u[comp * r_comp_stride + node * blk_size + e] = d_u[indices[elem * elem_size + node] + comp * comp_stride];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// L-vector -> E-vector, strided
+//------------------------------------------------------------------------------
+static inline void readDofsStrided(const CeedInt num_comp, const CeedInt elem_size, const CeedInt blk_size, const CeedInt strides_node,
+                                   const CeedInt strides_comp, const CeedInt strides_elem, const CeedInt num_elem, const CeedInt e_start,
+                                   const CeedScalar *restrict d_u, CeedScalar *restrict r_u, const CeedInt r_comp_stride) {
+  for (CeedInt e = 0; e < blk_size; e++) {
+    const CeedInt elem = e_start + e < num_elem ? e_start + e : num_elem - 1;
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt node = 0; node < elem_size; node++) {
+        r_u[comp * r_comp_stride + node * blk_size + e] = d_u[node * strides_node + comp * strides_comp + elem * strides_elem];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, offsets provided
+//------------------------------------------------------------------------------
+static inline void writeDofsOffset(const CeedInt num_comp, const CeedInt comp_stride, const CeedInt elem_size, const CeedInt blk_size,
+                                   const CeedInt num_elem, const CeedInt e_start, const CeedInt *restrict indices, const CeedScalar *restrict r_v,
+                                   const CeedInt r_comp_stride, CeedScalar *restrict d_v) {
+  const CeedInt num_elem_blk = num_elem - e_start < blk_size ? num_elem - e_start : blk_size;
+
+  for (CeedInt e = 0; e < num_elem_blk; e++) {
+    const CeedInt elem = e_start + e;
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt node = 0; node < elem_size; node++) {
+        d_v[indices[elem * elem_size + node] + comp * comp_stride] += r_v[comp * r_comp_stride + node * blk_size + e];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// E-vector -> L-vector, strided
+//------------------------------------------------------------------------------
+static inline void writeDofsStrided(const CeedInt num_comp, const CeedInt elem_size, const CeedInt blk_size, const CeedInt strides_node,
+                                    const CeedInt strides_comp, const CeedInt strides_elem, const CeedInt num_elem, const CeedInt e_start,
+                                    const CeedScalar *restrict r_v, const CeedInt r_comp_stride, CeedScalar *restrict d_v) {
+  const CeedInt num_elem_blk = num_elem - e_start < blk_size ? num_elem - e_start : blk_size;
+
+  for (CeedInt e = 0; e < num_elem_blk; e++) {
+    const CeedInt elem = e_start + e;
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      for (CeedInt node = 0; node < elem_size; node++) {
+        d_v[node * strides_node + comp * strides_comp + elem * strides_elem] += r_v[comp * r_comp_stride + node * blk_size + e];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor contraction, same argument convention as CeedTensorContractApply
+//------------------------------------------------------------------------------
+static inline void contractTensor(const CeedInt A, const CeedInt B, const CeedInt C, const CeedInt J, const CeedScalar *restrict t,
+                                  const CeedInt t_mode, const CeedInt add, const CeedScalar *u, CeedScalar *v) {
+  const CeedInt t_stride_0 = t_mode ? 1 : B, t_stride_1 = t_mode ? J : 1;
+
+  if (!add) {
+    for (CeedInt q = 0; q < A * J * C; q++) v[q] = 0.0;
+  }
+  for (CeedInt a = 0; a < A; a++) {
+    for (CeedInt b = 0; b < B; b++) {
+      for (CeedInt j = 0; j < J; j++) {
+        const CeedScalar tq = t[j * t_stride_0 + b * t_stride_1];
+        CeedPragmaSIMD for (CeedInt c = 0; c < C; c++) v[(a * J + j) * C + c] += tq * u[(a * B + b) * C + c];
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Sum factorized action of one tensor product matrix on one component of an element block
+//   t_mode = 0 maps P^dim nodes to Q^dim points, t_mode = 1 maps back
+//------------------------------------------------------------------------------
+static inline void applyTensor(const CeedInt dim, const CeedInt P_1d, const CeedInt Q_1d, const CeedInt blk_size, const CeedScalar *const *mats,
+                               const CeedInt t_mode, const CeedInt add, const CeedScalar *restrict u, CeedScalar *restrict v,
+                               CeedScalar *restrict r_t0, CeedScalar *restrict r_t1) {
+  const CeedInt in = t_mode ? Q_1d : P_1d, out = t_mode ? P_1d : Q_1d;
+  CeedInt       pre = 1, post = blk_size;
+
+  for (CeedInt d = 0; d < dim - 1; d++) pre *= in;
+  for (CeedInt d = 0; d < dim; d++) {
+    const CeedScalar *r_in  = d == 0 ? u : (d % 2 ? r_t0 : r_t1);
+    CeedScalar       *r_out = d == dim - 1 ? v : (d % 2 ? r_t1 : r_t0);
+
+    contractTensor(pre, in, post, out, mats[d], t_mode, add && d == dim - 1, r_in, r_out);
+    pre /= in;
+    post *= out;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor basis interpolation
+//------------------------------------------------------------------------------
+static inline void interpTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d, const CeedInt blk_size,
+                                const CeedScalar *B, const CeedScalar *restrict r_u, CeedScalar *restrict r_v, CeedScalar *restrict r_t0,
+                                CeedScalar *restrict r_t1) {
+  const CeedScalar *mats[3] = {B, B, B};
+  CeedInt           P = blk_size, Q = blk_size;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    P *= P_1d;
+    Q *= Q_1d;
+  }
+  for (CeedInt comp = 0; comp < num_comp; comp++) applyTensor(dim, P_1d, Q_1d, blk_size, mats, 0, 0, &r_u[comp * P], &r_v[comp * Q], r_t0, r_t1);
+}
+
+//------------------------------------------------------------------------------
+// Tensor basis interpolation transpose
+//------------------------------------------------------------------------------
+static inline void interpTransposeTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d, const CeedInt blk_size,
+                                         const CeedScalar *B, const CeedScalar *restrict r_u, CeedScalar *restrict r_v, CeedScalar *restrict r_t0,
+                                         CeedScalar *restrict r_t1) {
+  const CeedScalar *mats[3] = {B, B, B};
+  CeedInt           P = blk_size, Q = blk_size;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    P *= P_1d;
+    Q *= Q_1d;
+  }
+  for (CeedInt comp = 0; comp < num_comp; comp++) applyTensor(dim, P_1d, Q_1d, blk_size, mats, 1, 0, &r_u[comp * Q], &r_v[comp * P], r_t0, r_t1);
+}
+
+//------------------------------------------------------------------------------
+// Tensor basis gradient, output ordered by dimension then component
+//------------------------------------------------------------------------------
+static inline void gradTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d, const CeedInt blk_size,
+                              const CeedScalar *B, const CeedScalar *G, const CeedScalar *restrict r_u, CeedScalar *restrict r_v,
+                              CeedScalar *restrict r_t0, CeedScalar *restrict r_t1) {
+  CeedInt P = blk_size, Q = blk_size;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    P *= P_1d;
+    Q *= Q_1d;
+  }
+  for (CeedInt dim_out = 0; dim_out < dim; dim_out++) {
+    const CeedScalar *mats[3] = {dim_out == 0 ? G : B, dim_out == 1 ? G : B, dim_out == 2 ? G : B};
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      applyTensor(dim, P_1d, Q_1d, blk_size, mats, 0, 0, &r_u[comp * P], &r_v[(dim_out * num_comp + comp) * Q], r_t0, r_t1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Tensor basis gradient transpose
+//------------------------------------------------------------------------------
+static inline void gradTransposeTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P_1d, const CeedInt Q_1d, const CeedInt blk_size,
+                                       const CeedScalar *B, const CeedScalar *G, const CeedScalar *restrict r_u, CeedScalar *restrict r_v,
+                                       CeedScalar *restrict r_t0, CeedScalar *restrict r_t1) {
+  CeedInt P = blk_size, Q = blk_size;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    P *= P_1d;
+    Q *= Q_1d;
+  }
+  for (CeedInt dim_in = 0; dim_in < dim; dim_in++) {
+    const CeedScalar *mats[3] = {dim_in == 0 ? G : B, dim_in == 1 ? G : B, dim_in == 2 ? G : B};
+
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      applyTensor(dim, P_1d, Q_1d, blk_size, mats, 1, dim_in > 0, &r_u[(dim_in * num_comp + comp) * Q], &r_v[comp * P], r_t0, r_t1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor basis interpolation
+//------------------------------------------------------------------------------
+static inline void interpNonTensor(const CeedInt num_comp, const CeedInt P, const CeedInt Q, const CeedInt blk_size, const CeedScalar *restrict B,
+                                   const CeedScalar *restrict r_u, CeedScalar *restrict r_v) {
+  for (CeedInt comp = 0; comp < num_comp; comp++) {
+    contractTensor(1, P, blk_size, Q, B, 0, 0, &r_u[comp * P * blk_size], &r_v[comp * Q * blk_size]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor basis interpolation transpose
+//------------------------------------------------------------------------------
+static inline void interpTransposeNonTensor(const CeedInt num_comp, const CeedInt P, const CeedInt Q, const CeedInt blk_size,
+                                            const CeedScalar *restrict B, const CeedScalar *restrict r_u, CeedScalar *restrict r_v) {
+  for (CeedInt comp = 0; comp < num_comp; comp++) {
+    contractTensor(1, Q, blk_size, P, B, 1, 0, &r_u[comp * Q * blk_size], &r_v[comp * P * blk_size]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor basis gradient, output ordered by dimension then component
+//------------------------------------------------------------------------------
+static inline void gradNonTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P, const CeedInt Q, const CeedInt blk_size,
+                                 const CeedScalar *restrict G, const CeedScalar *restrict r_u, CeedScalar *restrict r_v) {
+  for (CeedInt dim_out = 0; dim_out < dim; dim_out++) {
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      contractTensor(1, P, blk_size, Q, &G[dim_out * P * Q], 0, 0, &r_u[comp * P * blk_size], &r_v[(dim_out * num_comp + comp) * Q * blk_size]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Non-tensor basis gradient transpose
+//------------------------------------------------------------------------------
+static inline void gradTransposeNonTensor(const CeedInt dim, const CeedInt num_comp, const CeedInt P, const CeedInt Q, const CeedInt blk_size,
+                                          const CeedScalar *restrict G, const CeedScalar *restrict r_u, CeedScalar *restrict r_v) {
+  for (CeedInt dim_in = 0; dim_in < dim; dim_in++) {
+    for (CeedInt comp = 0; comp < num_comp; comp++) {
+      contractTensor(1, Q, blk_size, P, &G[dim_in * P * Q], 1, dim_in > 0, &r_u[(dim_in * num_comp + comp) * Q * blk_size],
+                     &r_v[comp * P * blk_size]);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+
+#endif
@@ -16,5 +16,9 @@ CEED_EXTERN int CeedLoadSourceToInitializedBuffer(Ceed ceed, const char *source_
 CEED_EXTERN int CeedPathConcatenate(Ceed ceed, const char *base_file_path, const char *relative_file_path, char **new_file_path);
 CEED_EXTERN int CeedGetJitRelativePath(const char *absolute_file_path, const char **relative_file_path);
 CEED_EXTERN int CeedGetJitAbsolutePath(Ceed ceed, const char *relative_file_path, char **absolute_file_path);
+CEED_EXTERN int CeedGetJitCachePath(Ceed ceed, const char *source, const char *options, const char *compiler, const char *extension,
+                                    char **cache_file_path);
+CEED_EXTERN int CeedReadJitCache(Ceed ceed, const char *cache_file_path, char **buffer, size_t *buffer_size);
+CEED_EXTERN int CeedWriteJitCache(Ceed ceed, const char *cache_file_path, const char *buffer, size_t buffer_size);
 
 #endif
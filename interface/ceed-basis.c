@@ -332,6 +332,31 @@ int CeedBasisIsTensor(CeedBasis basis, bool *is_tensor) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Determine if the interpolation of a CeedBasis is the identity
+
+  This is the case for H^1 bases whose quadrature points are collocated with the nodes, such as Gauss-Lobatto nodes with Gauss-Lobatto quadrature.
+  Backends may then use the element values directly as quadrature point values.
+
+  @param[in]  basis         CeedBasis
+  @param[out] is_collocated Variable to store collocated status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedBasisIsCollocated(CeedBasis basis, bool *is_collocated) {
+  const CeedInt     P      = basis->tensor_basis ? basis->P_1d : basis->P;
+  const CeedInt     Q      = basis->tensor_basis ? basis->Q_1d : basis->Q;
+  const CeedScalar *interp = basis->tensor_basis ? basis->interp_1d : basis->interp;
+
+  *is_collocated = basis != CEED_BASIS_COLLOCATED && basis->basis_space == 1 && basis->Q_comp == 1 && P == Q && interp;
+  for (CeedInt i = 0; i < P && *is_collocated; i++) {
+    for (CeedInt j = 0; j < P; j++) *is_collocated = *is_collocated && fabs(interp[j + P * i] - (i == j)) < 1e-14;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get backend data of a CeedBasis
 
@@ -1081,7 +1106,11 @@ int CeedBasisApply(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode,
     // LCOV_EXCL_STOP
   }
 
-  CeedCall(basis->Apply(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedProfileTimer timer;
+
+  CeedCall(CeedProfileBegin(basis->ceed, NULL, CEED_PROFILE_PHASE_BASIS, &timer));
+  CeedProfileCall(&timer, basis->Apply(basis, num_elem, t_mode, eval_mode, u, v));
+  CeedCall(CeedProfileEndBasis(basis, num_elem, t_mode, eval_mode, &timer));
   return CEED_ERROR_SUCCESS;
 }
 
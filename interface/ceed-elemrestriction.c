@@ -40,7 +40,34 @@ int CeedPermutePadOffsets(const CeedInt *offsets, CeedInt *blk_offsets, CeedInt
   for (CeedInt e = 0; e < num_blk * blk_size; e += blk_size) {
     for (CeedInt j = 0; j < blk_size; j++) {
       for (CeedInt k = 0; k < elem_size; k++) {
-        blk_offsets[e * elem_size + k * blk_size + j] = offsets[CeedIntMin(e + j, num_elem - 1) * elem_size + k];
+        blk_offsets[(CeedSize)e * elem_size + k * blk_size + j] = offsets[(CeedSize)CeedIntMin(e + j, num_elem - 1) * elem_size + k];
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Permute and pad 64-bit offsets for a blocked restriction
+
+  @param[in]  offsets     Array of shape [@a num_elem, @a elem_size].
+                            Row i holds the ordered list of the offsets (into the input CeedVector) for the unknowns corresponding to element i, where
+0 <= i < @a num_elem. All offsets must be in the range [0, @a l_size - 1].
+  @param[out] blk_offsets Array of permuted and padded offsets of shape [@a num_blk, @a elem_size, @a blk_size].
+  @param[in]  num_blk     Number of blocks
+  @param[in]  num_elem    Number of elements
+  @param[in]  blk_size    Number of elements in a block
+  @param[in]  elem_size   Size of each element
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Utility
+**/
+int CeedPermutePadOffsets64(const CeedSize *offsets, CeedSize *blk_offsets, CeedInt num_blk, CeedInt num_elem, CeedInt blk_size, CeedInt elem_size) {
+  for (CeedInt e = 0; e < num_blk * blk_size; e += blk_size) {
+    for (CeedInt j = 0; j < blk_size; j++) {
+      for (CeedInt k = 0; k < elem_size; k++) {
+        blk_offsets[(CeedSize)e * elem_size + k * blk_size + j] = offsets[(CeedSize)CeedIntMin(e + j, num_elem - 1) * elem_size + k];
       }
     }
   }
@@ -90,6 +117,11 @@ int CeedElemRestrictionGetStrides(CeedElemRestriction rstr, CeedInt (*strides)[3
   @ref User
 **/
 int CeedElemRestrictionGetOffsets(CeedElemRestriction rstr, CeedMemType mem_type, const CeedInt **offsets) {
+  if (rstr->has_offsets_64) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_INCOMPATIBLE, "ElemRestriction has 64-bit offsets, use CeedElemRestrictionGetOffsets64");
+    // LCOV_EXCL_STOP
+  }
   if (!rstr->GetOffsets) {
     // LCOV_EXCL_START
     return CeedError(rstr->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support GetOffsets");
@@ -117,6 +149,66 @@ int CeedElemRestrictionRestoreOffsets(CeedElemRestriction rstr, const CeedInt **
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get read-only access to the 64-bit offsets array of a CeedElemRestriction created with CeedElemRestrictionCreate64()
+
+  @param[in]  rstr     CeedElemRestriction to retrieve offsets
+  @param[in]  mem_type Memory type on which to access the array.
+                         If the backend uses a different memory type, this will perform a copy (possibly cached).
+  @param[out] offsets  Array on memory type mem_type
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionGetOffsets64(CeedElemRestriction rstr, CeedMemType mem_type, const CeedSize **offsets) {
+  if (!rstr->has_offsets_64) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_INCOMPATIBLE, "ElemRestriction does not have 64-bit offsets, use CeedElemRestrictionGetOffsets");
+    // LCOV_EXCL_STOP
+  }
+  if (!rstr->GetOffsets64) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support GetOffsets64");
+    // LCOV_EXCL_STOP
+  }
+
+  CeedCall(rstr->GetOffsets64(rstr, mem_type, offsets));
+  rstr->num_readers++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restore an offsets array obtained using CeedElemRestrictionGetOffsets64()
+
+  @param[in] rstr    CeedElemRestriction to restore
+  @param[in] offsets Array of offset data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionRestoreOffsets64(CeedElemRestriction rstr, const CeedSize **offsets) {
+  *offsets = NULL;
+  rstr->num_readers--;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the 64-bit offsets status of a CeedElemRestriction
+
+  @param[in]  rstr           CeedElemRestriction
+  @param[out] has_offsets_64 Variable to store status, true if the offsets are stored as CeedSize
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionHasOffsets64(CeedElemRestriction rstr, bool *has_offsets_64) {
+  *has_offsets_64 = rstr->has_offsets_64;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the strided status of a CeedElemRestriction
 
@@ -263,8 +355,9 @@ int CeedElemRestrictionReference(CeedElemRestriction rstr) {
   @ref Backend
 **/
 int CeedElemRestrictionGetFlopsEstimate(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedSize *flops) {
-  bool    is_oriented;
-  CeedInt e_size = rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp, scale = 0;
+  bool     is_oriented;
+  CeedInt  scale  = 0;
+  CeedSize e_size = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
 
   CeedCall(CeedElemRestrictionIsOriented(rstr, &is_oriented));
   switch (t_mode) {
@@ -445,6 +538,98 @@ int CeedElemRestrictionCreateOriented(Ceed ceed, CeedInt num_elem, CeedInt elem_
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a CeedElemRestriction with 64-bit offsets
+
+  This variant is intended for L-vectors with more than 2^31 entries, such as large vector-valued problems on a single rank.
+  Backends that do not support 64-bit offsets fall back to CeedElemRestrictionCreate() when the L-vector is small enough.
+
+  @param[in]  ceed        Ceed object where the CeedElemRestriction will be created
+  @param[in]  num_elem    Number of elements described in the @a offsets array
+  @param[in]  elem_size   Size (number of "nodes") per element
+  @param[in]  num_comp    Number of field components per interpolation node (1 for scalar fields)
+  @param[in]  comp_stride Stride between components for the same L-vector "node".
+                            Data for node i, component j, element k can be found in the L-vector at index offsets[i + k*elem_size] + j*comp_stride.
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the elements and fields given by this restriction.
+  @param[in]  mem_type    Memory type of the @a offsets array, see CeedMemType
+  @param[in]  copy_mode   Copy mode for the @a offsets array, see CeedCopyMode
+  @param[in]  offsets     Array of shape [@a num_elem, @a elem_size].
+                            Row i holds the ordered list of the offsets (into the input CeedVector) for the unknowns corresponding to element i, where
+0 <= i < @a num_elem. All offsets must be in the range [0, @a l_size - 1].
+  @param[out] rstr        Address of the variable where the newly created CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreate64(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt num_comp, CeedInt comp_stride, CeedSize l_size,
+                                CeedMemType mem_type, CeedCopyMode copy_mode, const CeedSize *offsets, CeedElemRestriction *rstr) {
+  if (!ceed->ElemRestrictionCreate) {
+    Ceed delegate;
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+
+    if (!delegate) {
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support ElemRestrictionCreate");
+      // LCOV_EXCL_STOP
+    }
+
+    CeedCall(CeedElemRestrictionCreate64(delegate, num_elem, elem_size, num_comp, comp_stride, l_size, mem_type, copy_mode, offsets, rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (!ceed->ElemRestrictionCreate64) {
+    // Narrow to 32-bit offsets for backends without 64-bit support
+    CeedInt *offsets_32;
+
+    if (l_size > INT32_MAX || mem_type != CEED_MEM_HOST) {
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support ElemRestrictionCreate64");
+      // LCOV_EXCL_STOP
+    }
+    CeedCall(CeedMalloc((CeedSize)num_elem * elem_size, &offsets_32));
+    for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) offsets_32[i] = (CeedInt)offsets[i];
+    CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER, offsets_32, rstr));
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (elem_size < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "Element size must be at least 1");
+    // LCOV_EXCL_STOP
+  }
+
+  if (num_comp < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "ElemRestriction must have at least 1 component");
+    // LCOV_EXCL_STOP
+  }
+
+  if (num_comp > 1 && comp_stride < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "ElemRestriction component stride must be at least 1");
+    // LCOV_EXCL_STOP
+  }
+
+  CeedCall(CeedCalloc(1, rstr));
+  (*rstr)->ceed = ceed;
+  CeedCall(CeedReference(ceed));
+  (*rstr)->ref_count      = 1;
+  (*rstr)->num_elem       = num_elem;
+  (*rstr)->elem_size      = elem_size;
+  (*rstr)->num_comp       = num_comp;
+  (*rstr)->comp_stride    = comp_stride;
+  (*rstr)->l_size         = l_size;
+  (*rstr)->num_blk        = num_elem;
+  (*rstr)->blk_size       = 1;
+  (*rstr)->is_oriented    = 0;
+  (*rstr)->has_offsets_64 = true;
+  CeedCall(ceed->ElemRestrictionCreate64(mem_type, copy_mode, offsets, *rstr));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a strided CeedElemRestriction
 
@@ -579,7 +764,7 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_s
 
   CeedCall(CeedCalloc(1, rstr));
 
-  CeedCall(CeedCalloc(num_blk * blk_size * elem_size, &blk_offsets));
+  CeedCall(CeedCalloc((CeedSize)num_blk * blk_size * elem_size, &blk_offsets));
   CeedCall(CeedPermutePadOffsets(offsets, blk_offsets, num_blk, num_elem, blk_size, elem_size));
 
   (*rstr)->ceed = ceed;
@@ -600,6 +785,116 @@ int CeedElemRestrictionCreateBlocked(Ceed ceed, CeedInt num_elem, CeedInt elem_s
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a blocked CeedElemRestriction with 64-bit offsets, typically only called by backends
+
+  @param[in]  ceed        Ceed object where the CeedElemRestriction will be created.
+  @param[in]  num_elem    Number of elements described in the @a offsets array.
+  @param[in]  elem_size   Size (number of unknowns) per element
+  @param[in]  blk_size    Number of elements in a block
+  @param[in]  num_comp    Number of field components per interpolation node (1 for scalar fields)
+  @param[in]  comp_stride Stride between components for the same L-vector "node".
+                            Data for node i, component j, element k can be found in the L-vector at index offsets[i + k*elem_size] + j*comp_stride.
+  @param[in]  l_size      The size of the L-vector.
+                            This vector may be larger than the elements and fields given by this restriction.
+  @param[in]  mem_type    Memory type of the @a offsets array, see CeedMemType
+  @param[in]  copy_mode   Copy mode for the @a offsets array, see CeedCopyMode
+  @param[in]  offsets     Array of shape [@a num_elem, @a elem_size].
+                            Row i holds the ordered list of the offsets (into the input CeedVector) for the unknowns corresponding to element i, where
+ 0 <= i < @a num_elem. All offsets must be in the range [0, @a l_size - 1]. The backend will permute and pad this array to the desired ordering for
+ the blocksize, which is typically given by the backend. The default reordering is to interlace elements.
+  @param[out] rstr        Address of the variable where the newly created CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+ **/
+int CeedElemRestrictionCreateBlocked64(Ceed ceed, CeedInt num_elem, CeedInt elem_size, CeedInt blk_size, CeedInt num_comp, CeedInt comp_stride,
+                                       CeedSize l_size, CeedMemType mem_type, CeedCopyMode copy_mode, const CeedSize *offsets,
+                                       CeedElemRestriction *rstr) {
+  CeedSize *blk_offsets;
+  CeedInt   num_blk = (num_elem / blk_size) + !!(num_elem % blk_size);
+
+  if (!ceed->ElemRestrictionCreateBlocked) {
+    Ceed delegate;
+    CeedCall(CeedGetObjectDelegate(ceed, &delegate, "ElemRestriction"));
+
+    if (!delegate) {
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support ElemRestrictionCreateBlocked");
+      // LCOV_EXCL_STOP
+    }
+
+    CeedCall(CeedElemRestrictionCreateBlocked64(delegate, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, mem_type, copy_mode, offsets,
+                                                rstr));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (!ceed->ElemRestrictionCreateBlocked64) {
+    // Narrow to 32-bit offsets for backends without 64-bit support
+    CeedInt *offsets_32;
+
+    if (l_size > INT32_MAX || mem_type != CEED_MEM_HOST) {
+      // LCOV_EXCL_START
+      return CeedError(ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support ElemRestrictionCreateBlocked64");
+      // LCOV_EXCL_STOP
+    }
+    CeedCall(CeedMalloc((CeedSize)num_elem * elem_size, &offsets_32));
+    for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) offsets_32[i] = (CeedInt)offsets[i];
+    CeedCall(CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, comp_stride, l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                              offsets_32, rstr));
+    if (copy_mode == CEED_OWN_POINTER) CeedCall(CeedFree(&offsets));
+    return CEED_ERROR_SUCCESS;
+  }
+
+  if (elem_size < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "Element size must be at least 1");
+    // LCOV_EXCL_STOP
+  }
+
+  if (blk_size < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "Block size must be at least 1");
+    // LCOV_EXCL_STOP
+  }
+
+  if (num_comp < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "ElemRestriction must have at least 1 component");
+    // LCOV_EXCL_STOP
+  }
+
+  if (num_comp > 1 && comp_stride < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_DIMENSION, "ElemRestriction component stride must be at least 1");
+    // LCOV_EXCL_STOP
+  }
+
+  CeedCall(CeedCalloc(1, rstr));
+
+  CeedCall(CeedCalloc((CeedSize)num_blk * blk_size * elem_size, &blk_offsets));
+  CeedCall(CeedPermutePadOffsets64(offsets, blk_offsets, num_blk, num_elem, blk_size, elem_size));
+
+  (*rstr)->ceed = ceed;
+  CeedCall(CeedReference(ceed));
+  (*rstr)->ref_count      = 1;
+  (*rstr)->num_elem       = num_elem;
+  (*rstr)->elem_size      = elem_size;
+  (*rstr)->num_comp       = num_comp;
+  (*rstr)->comp_stride    = comp_stride;
+  (*rstr)->l_size         = l_size;
+  (*rstr)->num_blk        = num_blk;
+  (*rstr)->blk_size       = blk_size;
+  (*rstr)->is_oriented    = 0;
+  (*rstr)->has_offsets_64 = true;
+  CeedCall(ceed->ElemRestrictionCreateBlocked64(CEED_MEM_HOST, CEED_OWN_POINTER, (const CeedSize *)blk_offsets, *rstr));
+  if (copy_mode == CEED_OWN_POINTER) {
+    CeedCall(CeedFree(&offsets));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Create a blocked strided CeedElemRestriction
 
@@ -673,6 +968,88 @@ int CeedElemRestrictionCreateBlockedStrided(Ceed ceed, CeedInt num_elem, CeedInt
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a CeedElemRestriction for a subset of the elements of an existing CeedElemRestriction.
+
+  The new CeedElemRestriction uses the same L-vector as @a rstr, with element i given by element @a elem_indices[i] of @a rstr.
+  Strided restrictions, including those with @a CEED_STRIDES_BACKEND, are converted to offset restrictions.
+
+  @param[in]  rstr         CeedElemRestriction
+  @param[in]  num_elem     Number of elements in the subset
+  @param[in]  elem_indices Array of length @a num_elem holding the indices of the elements of @a rstr, in the range [0, @a num_elem of @a rstr - 1]
+  @param[out] rstr_subset  Address of the variable where the newly created CeedElemRestriction will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionCreateSubset(CeedElemRestriction rstr, CeedInt num_elem, const CeedInt *elem_indices, CeedElemRestriction *rstr_subset) {
+  CeedInt   elem_size = rstr->elem_size, comp_stride = rstr->comp_stride;
+  CeedSize *offsets_subset;
+
+  if (rstr->blk_size > 1 || rstr->is_oriented) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_UNSUPPORTED, "Element subsets of blocked or oriented ElemRestrictions not supported");
+    // LCOV_EXCL_STOP
+  }
+  for (CeedInt e = 0; e < num_elem; e++) {
+    if (elem_indices[e] < 0 || elem_indices[e] >= rstr->num_elem) {
+      // LCOV_EXCL_START
+      return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Element index %" CeedInt_FMT " out of range for ElemRestriction with %" CeedInt_FMT
+                       " elements", elem_indices[e], rstr->num_elem);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Gather offsets of selected elements
+  CeedCall(CeedMalloc((CeedSize)num_elem * elem_size, &offsets_subset));
+  if (rstr->strides) {
+    CeedInt strides[3];
+    bool    has_backend_strides;
+
+    CeedCall(CeedElemRestrictionHasBackendStrides(rstr, &has_backend_strides));
+    if (has_backend_strides) CeedCall(CeedElemRestrictionGetELayout(rstr, &strides));
+    else CeedCall(CeedElemRestrictionGetStrides(rstr, &strides));
+    comp_stride = strides[1];
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < elem_size; i++) {
+        offsets_subset[(CeedSize)e * elem_size + i] = (CeedSize)i * strides[0] + (CeedSize)elem_indices[e] * strides[2];
+      }
+    }
+  } else if (rstr->has_offsets_64) {
+    const CeedSize *offsets;
+
+    CeedCall(CeedElemRestrictionGetOffsets64(rstr, CEED_MEM_HOST, &offsets));
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < elem_size; i++) offsets_subset[(CeedSize)e * elem_size + i] = offsets[(CeedSize)elem_indices[e] * elem_size + i];
+    }
+    CeedCall(CeedElemRestrictionRestoreOffsets64(rstr, &offsets));
+  } else {
+    const CeedInt *offsets;
+
+    CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+    for (CeedInt e = 0; e < num_elem; e++) {
+      for (CeedInt i = 0; i < elem_size; i++) offsets_subset[(CeedSize)e * elem_size + i] = offsets[(CeedSize)elem_indices[e] * elem_size + i];
+    }
+    CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+  }
+
+  // Create restriction, with 32-bit offsets unless 64-bit offsets are needed
+  if (rstr->has_offsets_64 || rstr->l_size > INT32_MAX) {
+    CeedCall(CeedElemRestrictionCreate64(rstr->ceed, num_elem, elem_size, rstr->num_comp, comp_stride, rstr->l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                         offsets_subset, rstr_subset));
+  } else {
+    CeedInt *offsets_subset_32;
+
+    CeedCall(CeedMalloc((CeedSize)num_elem * elem_size, &offsets_subset_32));
+    for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) offsets_subset_32[i] = (CeedInt)offsets_subset[i];
+    CeedCall(CeedFree(&offsets_subset));
+    CeedCall(CeedElemRestrictionCreate(rstr->ceed, num_elem, elem_size, rstr->num_comp, comp_stride, rstr->l_size, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                       offsets_subset_32, rstr_subset));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Copy the pointer to a CeedElemRestriction.
            Both pointers should be destroyed with `CeedElemRestrictionDestroy()`.
@@ -708,7 +1085,7 @@ int CeedElemRestrictionReferenceCopy(CeedElemRestriction rstr, CeedElemRestricti
 int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *l_vec, CeedVector *e_vec) {
   CeedSize e_size, l_size;
   l_size = rstr->l_size;
-  e_size = rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+  e_size = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
   if (l_vec) CeedCall(CeedVectorCreate(rstr->ceed, l_size, l_vec));
   if (e_vec) CeedCall(CeedVectorCreate(rstr->ceed, e_size, e_vec));
   return CEED_ERROR_SUCCESS;
@@ -729,30 +1106,33 @@ int CeedElemRestrictionCreateVector(CeedElemRestriction rstr, CeedVector *l_vec,
   @ref User
 **/
 int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode, CeedVector u, CeedVector ru, CeedRequest *request) {
-  CeedInt m, n;
+  CeedSize m, n;
 
   if (t_mode == CEED_NOTRANSPOSE) {
-    m = rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+    m = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
     n = rstr->l_size;
   } else {
     m = rstr->l_size;
-    n = rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+    n = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
   }
   if (n != u->length) {
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
-                     "Input vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", u->length, m,
-                     n);
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Input vector size %td not compatible with element restriction (%td, %td)", u->length, m, n);
     // LCOV_EXCL_STOP
   }
   if (m != ru->length) {
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
-                     "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", ru->length,
-                     m, n);
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Output vector size %td not compatible with element restriction (%td, %td)", ru->length, m, n);
     // LCOV_EXCL_STOP
   }
-  if (rstr->num_elem > 0) CeedCall(rstr->Apply(rstr, t_mode, u, ru, request));
+  if (rstr->num_elem > 0) {
+    CeedProfileTimer timer;
+
+    CeedCall(CeedProfileBegin(rstr->ceed, NULL, t_mode == CEED_NOTRANSPOSE ? CEED_PROFILE_PHASE_RESTRICT_IN : CEED_PROFILE_PHASE_RESTRICT_OUT,
+                              &timer));
+    CeedProfileCall(&timer, rstr->Apply(rstr, t_mode, u, ru, request));
+    CeedCall(CeedProfileEndElemRestriction(rstr, rstr->num_blk, &timer));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -774,27 +1154,23 @@ int CeedElemRestrictionApply(CeedElemRestriction rstr, CeedTransposeMode t_mode,
 **/
 int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedTransposeMode t_mode, CeedVector u, CeedVector ru,
                                   CeedRequest *request) {
-  CeedInt m, n;
+  CeedSize m, n;
 
   if (t_mode == CEED_NOTRANSPOSE) {
-    m = rstr->blk_size * rstr->elem_size * rstr->num_comp;
+    m = (CeedSize)rstr->blk_size * rstr->elem_size * rstr->num_comp;
     n = rstr->l_size;
   } else {
     m = rstr->l_size;
-    n = rstr->blk_size * rstr->elem_size * rstr->num_comp;
+    n = (CeedSize)rstr->blk_size * rstr->elem_size * rstr->num_comp;
   }
   if (n != u->length) {
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
-                     "Input vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", u->length, m,
-                     n);
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Input vector size %td not compatible with element restriction (%td, %td)", u->length, m, n);
     // LCOV_EXCL_STOP
   }
   if (m != ru->length) {
     // LCOV_EXCL_START
-    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
-                     "Output vector size %" CeedInt_FMT " not compatible with element restriction (%" CeedInt_FMT ", %" CeedInt_FMT ")", ru->length,
-                     m, n);
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Output vector size %td not compatible with element restriction (%td, %td)", ru->length, m, n);
     // LCOV_EXCL_STOP
   }
   if (rstr->blk_size * block > rstr->num_elem) {
@@ -804,7 +1180,76 @@ int CeedElemRestrictionApplyBlock(CeedElemRestriction rstr, CeedInt block, CeedT
                      rstr->blk_size * block, rstr->num_elem);
     // LCOV_EXCL_STOP
   }
-  CeedCall(rstr->ApplyBlock(rstr, block, t_mode, u, ru, request));
+  CeedProfileTimer timer;
+
+  CeedCall(CeedProfileBegin(rstr->ceed, NULL, t_mode == CEED_NOTRANSPOSE ? CEED_PROFILE_PHASE_RESTRICT_IN : CEED_PROFILE_PHASE_RESTRICT_OUT, &timer));
+  CeedProfileCall(&timer, rstr->ApplyBlock(rstr, block, t_mode, u, ru, request));
+  CeedCall(CeedProfileEndElemRestriction(rstr, 1, &timer));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Restrict an L-vector to a range of blocks of an E-vector or apply its transpose
+
+  Only the entries of @a ru for blocks [@a block_start, @a block_stop) are written when t_mode=@ref CEED_NOTRANSPOSE, and only those entries are read
+    when t_mode=@ref CEED_TRANSPOSE.
+  Whole blocks are restricted, so callers applying a range of elements that does not start and end on block boundaries read the entries of @a u
+    touched by the other elements of the first and last block.
+
+  @param[in]  rstr        CeedElemRestriction
+  @param[in]  block_start First block to restrict to/from
+  @param[in]  block_stop  One past the last block to restrict to/from, i.e. block_start=0 and block_stop=3 will handle elements [0 : 3*blk_size]
+  @param[in]  t_mode      Apply restriction or transpose
+  @param[in]  u           Input vector (of size @a l_size when t_mode=@ref CEED_NOTRANSPOSE)
+  @param[out] ru          Output vector (of shape [@a num_blk * @a blk_size * @a elem_size] when t_mode=@ref CEED_NOTRANSPOSE).
+                            Ordering of the e-vector is decided by the backend.
+  @param[in]  request     Request or @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedElemRestrictionApplyBlockRange(CeedElemRestriction rstr, CeedInt block_start, CeedInt block_stop, CeedTransposeMode t_mode, CeedVector u,
+                                       CeedVector ru, CeedRequest *request) {
+  CeedSize m, n;
+
+  if (!rstr->ApplyBlockRange) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support ElemRestrictionApplyBlockRange");
+    // LCOV_EXCL_STOP
+  }
+  if (t_mode == CEED_NOTRANSPOSE) {
+    m = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+    n = rstr->l_size;
+  } else {
+    m = rstr->l_size;
+    n = (CeedSize)rstr->num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+  }
+  if (n != u->length) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Input vector size %td not compatible with element restriction (%td, %td)", u->length, m, n);
+    // LCOV_EXCL_STOP
+  }
+  if (m != ru->length) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION, "Output vector size %td not compatible with element restriction (%td, %td)", ru->length, m, n);
+    // LCOV_EXCL_STOP
+  }
+  if (block_start < 0 || block_start > block_stop || block_stop > rstr->num_blk) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_DIMENSION,
+                     "Cannot retrieve blocks [%" CeedInt_FMT ", %" CeedInt_FMT "), total blocks %" CeedInt_FMT "", block_start, block_stop,
+                     rstr->num_blk);
+    // LCOV_EXCL_STOP
+  }
+  if (block_start < block_stop) {
+    CeedProfileTimer timer;
+
+    CeedCall(CeedProfileBegin(rstr->ceed, NULL, t_mode == CEED_NOTRANSPOSE ? CEED_PROFILE_PHASE_RESTRICT_IN : CEED_PROFILE_PHASE_RESTRICT_OUT,
+                              &timer));
+    CeedProfileCall(&timer, rstr->ApplyBlockRange(rstr, block_start, block_stop, t_mode, u, ru, request));
+    CeedCall(CeedProfileEndElemRestriction(rstr, block_stop - block_start, &timer));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -955,6 +1400,56 @@ int CeedElemRestrictionGetMultiplicity(CeedElemRestriction rstr, CeedVector mult
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the elements of a CeedElemRestriction that touch ghost entries of the L-vector
+
+  Ghost entries are the L-vector entries with nonzero value in @a ghost_mask, such as entries owned by another process.
+  The remaining elements only depend on owned entries, so they may be computed before ghost values are communicated.
+
+  @param[in]  rstr           CeedElemRestriction
+  @param[in]  ghost_mask     L-vector with nonzero values for ghost entries
+  @param[out] num_ghost_elem Variable to store the number of elements touching ghost entries
+  @param[out] elem_indices   Array of length at least the number of elements of @a rstr to store the indices of elements touching ghost entries,
+                               in increasing order
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedElemRestrictionGetGhostElements(CeedElemRestriction rstr, CeedVector ghost_mask, CeedInt *num_ghost_elem, CeedInt *elem_indices) {
+  CeedInt           layout[3];
+  const CeedScalar *e_array;
+  CeedVector        e_vec;
+
+  if (rstr->blk_size > 1) {
+    // LCOV_EXCL_START
+    return CeedError(rstr->ceed, CEED_ERROR_UNSUPPORTED, "Ghost elements of blocked ElemRestrictions not supported");
+    // LCOV_EXCL_STOP
+  }
+
+  // Restrict ghost mask to elements
+  CeedCall(CeedElemRestrictionCreateVector(rstr, NULL, &e_vec));
+  CeedCall(CeedElemRestrictionApply(rstr, CEED_NOTRANSPOSE, ghost_mask, e_vec, CEED_REQUEST_IMMEDIATE));
+  CeedCall(CeedElemRestrictionGetELayout(rstr, &layout));
+
+  // Find elements with any ghost entry
+  *num_ghost_elem = 0;
+  CeedCall(CeedVectorGetArrayRead(e_vec, CEED_MEM_HOST, &e_array));
+  for (CeedInt e = 0; e < rstr->num_elem; e++) {
+    bool is_ghost = false;
+
+    for (CeedInt j = 0; j < rstr->num_comp && !is_ghost; j++) {
+      for (CeedInt i = 0; i < rstr->elem_size && !is_ghost; i++) {
+        is_ghost = e_array[(CeedSize)i * layout[0] + (CeedSize)j * layout[1] + (CeedSize)e * layout[2]] != 0.0;
+      }
+    }
+    if (is_ghost) elem_indices[(*num_ghost_elem)++] = e;
+  }
+  CeedCall(CeedVectorRestoreArrayRead(e_vec, &e_array));
+  CeedCall(CeedVectorDestroy(&e_vec));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a CeedElemRestriction
 
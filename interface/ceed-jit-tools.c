@@ -5,13 +5,19 @@
 //
 // This file is part of CEED:  http://github.com/ceed
 
+#define _POSIX_C_SOURCE 200809L
 #include <ceed-impl.h>
 #include <ceed/backend.h>
 #include <ceed/ceed.h>
 #include <ceed/jit-tools.h>
+#include <errno.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 /**
   @brief Check if valid file exists at path given
@@ -295,3 +301,176 @@ int CeedGetJitAbsolutePath(Ceed ceed, const char *relative_file_path, char **abs
   return CeedError(ceed, CEED_ERROR_MAJOR, "Couldn't find matching JiT source file: %s", relative_file_path);
   // LCOV_EXCL_STOP
 }
+
+/**
+  @brief 128-bit FNV-1a hash of a string, continuing from a previous hash value
+
+  @param[in,out] hash Previous hash value or offset basis, as high and low 64-bit words
+  @param[in]     str  String to hash, including the terminating null character so that consecutive strings cannot run together
+
+  @ref Developer
+**/
+static void CeedJitCacheHash(uint64_t hash[2], const char *str) {
+  // FNV prime 2^88 + 0x13b, applied to the high and low words with 64-bit arithmetic
+  const uint64_t prime_low = 0x13b;
+
+  do {
+    hash[1] ^= (unsigned char)*str;
+    const uint64_t low_low = (hash[1] & 0xffffffffULL) * prime_low, low_high = (hash[1] >> 32) * prime_low;
+    const uint64_t low     = low_low + (low_high << 32);
+    const uint64_t carry   = (low_high >> 32) + (low < low_low);
+
+    hash[0] = hash[0] * prime_low + carry + (hash[1] << 24);
+    hash[1] = low;
+  } while (*str++);
+}
+
+/**
+  @brief Build the path to a compiled kernel in the JiT cache.
+           The file name is a 128-bit hash of the full kernel source, as returned by `CeedLoadSourceToBuffer()` and any generated code, the compiler
+             options, including kernel defines, and a string identifying the compiler and its version.
+           If no JiT cache directory is set, `cache_file_path` is set to NULL.
+         Note: Caller is responsible for freeing the string buffer with `CeedFree()`.
+
+  @param[in]  ceed            Ceed object for error handling
+  @param[in]  source          Kernel source
+  @param[in]  options         Compiler options and defines
+  @param[in]  compiler        Compiler identity
+  @param[in]  extension       File extension for compiled kernel, such as ".so" or ".ptx"
+  @param[out] cache_file_path String buffer for path to cached kernel, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetJitCachePath(Ceed ceed, const char *source, const char *options, const char *compiler, const char *extension, char **cache_file_path) {
+  Ceed ceed_parent;
+
+  *cache_file_path = NULL;
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  if (!ceed_parent->jit_cache_dir) return CEED_ERROR_SUCCESS;
+
+  // Create cache directory, if needed
+  if (mkdir(ceed_parent->jit_cache_dir, 0777) && errno != EEXIST) {
+    // LCOV_EXCL_START
+    CeedDebug256(ceed, 1, "Could not create JiT cache directory: ");
+    CeedDebug(ceed, "%s\n", ceed_parent->jit_cache_dir);
+    return CEED_ERROR_SUCCESS;
+    // LCOV_EXCL_STOP
+  }
+
+  // Key from the 128-bit hash of the source, options, and compiler
+  uint64_t hash[2] = {0x6c62272e07bb0142ULL, 0x62b821756295c58dULL};
+  CeedJitCacheHash(hash, source);
+  CeedJitCacheHash(hash, options ? options : "");
+  CeedJitCacheHash(hash, compiler ? compiler : "");
+
+  size_t path_length = strlen(ceed_parent->jit_cache_dir) + strlen(extension) + 34;
+  CeedCall(CeedCalloc(path_length, cache_file_path));
+  snprintf(*cache_file_path, path_length, "%s/%016llx%016llx%s", ceed_parent->jit_cache_dir, (unsigned long long)hash[0],
+           (unsigned long long)hash[1], extension);
+
+  // Debug
+  CeedDebug256(ceed, 1, "JiT cache file: ");
+  CeedDebug(ceed, "%s\n", *cache_file_path);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Read a compiled kernel from the JiT cache.
+           If the kernel is not in the cache, `buffer` is set to NULL.
+         Note: Caller is responsible for freeing the buffer with `CeedFree()`.
+
+  @param[in]  ceed            Ceed object for error handling
+  @param[in]  cache_file_path Path to cached kernel, from `CeedGetJitCachePath()`
+  @param[out] buffer          Buffer for compiled kernel, or NULL
+  @param[out] buffer_size     Size of compiled kernel in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedReadJitCache(Ceed ceed, const char *cache_file_path, char **buffer, size_t *buffer_size) {
+  FILE *cache_file;
+  long  file_size;
+
+  *buffer      = NULL;
+  *buffer_size = 0;
+  if (!cache_file_path) return CEED_ERROR_SUCCESS;
+  cache_file = fopen(cache_file_path, "rb");
+  if (!cache_file) return CEED_ERROR_SUCCESS;
+
+  // Read file, with a trailing null character for text formats such as PTX
+  fseek(cache_file, 0L, SEEK_END);
+  file_size = ftell(cache_file);
+  rewind(cache_file);
+  if (file_size > 0) {
+    CeedCall(CeedCalloc(file_size + 1, buffer));
+    if (fread(*buffer, 1, file_size, cache_file) != (size_t)file_size) {
+      // LCOV_EXCL_START
+      CeedCall(CeedFree(buffer));
+      // LCOV_EXCL_STOP
+    } else {
+      *buffer_size = file_size;
+    }
+  }
+  fclose(cache_file);
+
+  // Debug
+  CeedDebug256(ceed, 1, *buffer ? "Found JiT cache file: " : "Could not read JiT cache file: ");
+  CeedDebug(ceed, "%s\n", cache_file_path);
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a compiled kernel to the JiT cache.
+           The kernel is written to a temporary file in the cache directory, which is then renamed, so concurrent processes sharing the cache never
+             read a partial file.
+           Failure to write the cache is not an error.
+
+  @param[in] ceed            Ceed object for error handling
+  @param[in] cache_file_path Path to cached kernel, from `CeedGetJitCachePath()`
+  @param[in] buffer          Compiled kernel
+  @param[in] buffer_size     Size of compiled kernel in bytes
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedWriteJitCache(Ceed ceed, const char *cache_file_path, const char *buffer, size_t buffer_size) {
+  char *temp_file_path;
+  int   temp_fd;
+
+  if (!cache_file_path) return CEED_ERROR_SUCCESS;
+
+  // Write to temporary file in the same directory
+  size_t path_length = strlen(cache_file_path) + 8;
+  CeedCall(CeedCalloc(path_length, &temp_file_path));
+  snprintf(temp_file_path, path_length, "%s.XXXXXX", cache_file_path);
+  temp_fd = mkstemp(temp_file_path);
+  if (temp_fd >= 0) {
+    FILE *temp_file  = fdopen(temp_fd, "wb");
+    bool  is_written = false;
+
+    if (temp_file) {
+      is_written = fwrite(buffer, 1, buffer_size, temp_file) == buffer_size;
+      is_written = !fclose(temp_file) && is_written;
+    } else {
+      // LCOV_EXCL_START
+      close(temp_fd);
+      // LCOV_EXCL_STOP
+    }
+    // Atomic replace, so readers see either no file or the complete kernel
+    if (is_written) is_written = !rename(temp_file_path, cache_file_path);
+    if (!is_written) remove(temp_file_path);
+
+    // Debug
+    CeedDebug256(ceed, 1, is_written ? "Wrote JiT cache file: " : "Could not write JiT cache file: ");
+    CeedDebug(ceed, "%s\n", cache_file_path);
+  }
+  CeedCall(CeedFree(&temp_file_path));
+
+  return CEED_ERROR_SUCCESS;
+}
@@ -439,6 +439,175 @@ static int CeedOperatorContextRestoreGenericRead(CeedOperator op, CeedContextFie
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Create a CeedOperator applying an existing CeedOperator on a subset of its elements
+
+  Fields sharing a CeedElemRestriction in @a op share the subset CeedElemRestriction in @a op_subset.
+
+  @param[in]  op           CeedOperator
+  @param[in]  num_elem     Number of elements in the subset
+  @param[in]  elem_indices Array of length @a num_elem holding the indices of the elements in the subset
+  @param[out] op_subset    Address of the variable where the newly created CeedOperator will be stored
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorCreateElementSubset(CeedOperator op, CeedInt num_elem, const CeedInt *elem_indices, CeedOperator *op_subset) {
+  CeedInt              num_rstr = 0;
+  CeedElemRestriction *rstrs, *rstrs_subset;
+
+  CeedCall(CeedCalloc(2 * op->num_fields, &rstrs));
+  CeedCall(CeedCalloc(2 * op->num_fields, &rstrs_subset));
+  CeedCall(CeedOperatorCreate(op->ceed, op->qf, op->dqf, op->dqfT, op_subset));
+  for (CeedInt i = 0; i < op->qf->num_input_fields + op->qf->num_output_fields; i++) {
+    bool                is_input    = i < op->qf->num_input_fields;
+    CeedOperatorField   field       = is_input ? op->input_fields[i] : op->output_fields[i - op->qf->num_input_fields];
+    CeedElemRestriction rstr_subset = CEED_ELEMRESTRICTION_NONE;
+
+    if (field->elem_rstr != CEED_ELEMRESTRICTION_NONE) {
+      // Reuse subset restriction for shared restrictions
+      for (CeedInt j = 0; j < num_rstr; j++) {
+        if (rstrs[j] == field->elem_rstr) rstr_subset = rstrs_subset[j];
+      }
+      if (rstr_subset == CEED_ELEMRESTRICTION_NONE) {
+        CeedCall(CeedElemRestrictionCreateSubset(field->elem_rstr, num_elem, elem_indices, &rstr_subset));
+        rstrs[num_rstr]          = field->elem_rstr;
+        rstrs_subset[num_rstr++] = rstr_subset;
+      }
+    }
+    CeedCall(CeedOperatorSetField(*op_subset, field->field_name, rstr_subset, field->basis, field->vec));
+  }
+  for (CeedInt j = 0; j < num_rstr; j++) CeedCall(CeedElemRestrictionDestroy(&rstrs_subset[j]));
+  CeedCall(CeedFree(&rstrs));
+  CeedCall(CeedFree(&rstrs_subset));
+  if (op->name) CeedCall(CeedOperatorSetName(*op_subset, op->name));
+  (*op_subset)->precision = op->precision;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the CeedOperators applying the interior and ghost elements of a non-composite CeedOperator
+
+  Without ghost elements set by CeedOperatorSetGhostElements(), all elements are treated as ghost elements.
+  The CeedOperators are NULL when there are no elements in the corresponding set and may be @a op itself when all elements are in the set.
+
+  @param[in]  op          CeedOperator
+  @param[out] op_interior Variable to store CeedOperator applying interior elements
+  @param[out] op_ghost    Variable to store CeedOperator applying ghost elements
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetGhostSplit(CeedOperator op, CeedOperator *op_interior, CeedOperator *op_ghost) {
+  CeedInt num_interior_elem = op->num_elem - op->num_ghost_elem;
+
+  if (!op->has_ghost_elems) {
+    *op_interior = NULL;
+    *op_ghost    = op;
+    return CEED_ERROR_SUCCESS;
+  }
+
+  // Create operators for each element set
+  if (!op->is_ghost_split_setup && num_interior_elem > 0 && op->num_ghost_elem > 0) {
+    CeedInt *interior_elems;
+
+    CeedCall(CeedMalloc(num_interior_elem, &interior_elems));
+    for (CeedInt e = 0, i = 0, j = 0; e < op->num_elem; e++) {
+      if (j < op->num_ghost_elem && op->ghost_elems[j] == e) j++;
+      else interior_elems[i++] = e;
+    }
+    CeedCall(CeedOperatorCreateElementSubset(op, num_interior_elem, interior_elems, &op->op_interior));
+    CeedCall(CeedOperatorCreateElementSubset(op, op->num_ghost_elem, op->ghost_elems, &op->op_ghost));
+    CeedCall(CeedFree(&interior_elems));
+  }
+  op->is_ghost_split_setup = true;
+
+  *op_interior = num_interior_elem == 0 ? NULL : (op->num_ghost_elem == 0 ? op : op->op_interior);
+  *op_ghost    = op->num_ghost_elem == 0 ? NULL : (num_interior_elem == 0 ? op : op->op_ghost);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the CeedOperator applying a range of elements of a non-composite CeedOperator
+
+  The CeedOperator is created on first use for each range and cached, so repeated application of a fixed partition does not rebuild it.
+  At most CEED_RANGE_OPERATOR_MAX ranges are cached, further ranges replace the cached operators in order of creation.
+
+  @param[in]  op         CeedOperator
+  @param[in]  elem_start First element in range
+  @param[in]  elem_stop  One past the last element in range
+  @param[out] op_range   Variable to store CeedOperator applying the elements in the range
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorGetRangeOperator(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedOperator *op_range) {
+  CeedInt *elem_indices;
+
+  for (CeedInt i = 0; i < op->num_range_ops; i++) {
+    if (op->range_bounds[2 * i] == elem_start && op->range_bounds[2 * i + 1] == elem_stop) {
+      *op_range = op->range_ops[i];
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Create operator on the element subset, replacing the oldest cached operator if the cache is full
+  const CeedInt index = op->range_op_next;
+
+  if (!op->range_ops) {
+    CeedCall(CeedCalloc(CEED_RANGE_OPERATOR_MAX, &op->range_ops));
+    CeedCall(CeedCalloc(2 * CEED_RANGE_OPERATOR_MAX, &op->range_bounds));
+  }
+  CeedCall(CeedOperatorDestroy(&op->range_ops[index]));
+  CeedCall(CeedCalloc(elem_stop - elem_start, &elem_indices));
+  for (CeedInt e = elem_start; e < elem_stop; e++) elem_indices[e - elem_start] = e;
+  CeedCall(CeedOperatorCreateElementSubset(op, elem_stop - elem_start, elem_indices, &op->range_ops[index]));
+  CeedCall(CeedFree(&elem_indices));
+  op->range_bounds[2 * index]     = elem_start;
+  op->range_bounds[2 * index + 1] = elem_stop;
+  op->num_range_ops               = CeedIntMax(op->num_range_ops, index + 1);
+  op->range_op_next               = (index + 1) % CEED_RANGE_OPERATOR_MAX;
+  *op_range                       = op->range_ops[index];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply a range of elements of a CeedOperator with the thread lock held
+
+  This path is used when profiling and for backends without element range support.
+
+  @param[in]  op         CeedOperator to apply
+  @param[in]  elem_start First element to apply
+  @param[in]  elem_stop  One past the last element to apply
+  @param[in]  in         CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out        CeedVector to sum in result of applying the elements or @ref CEED_VECTOR_NONE if there are no active outputs
+  @param[in]  request    Address of CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorApplyAddRangeSerial(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in, CeedVector out,
+                                           CeedRequest *request) {
+  CeedProfileTimer timer;
+
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_APPLY, &timer));
+  if (op->ApplyAddRange) {
+    CeedProfileCall(&timer, op->ApplyAddRange(op, elem_start, elem_stop, in, out, request));
+  } else {
+    // Fallback to a cached operator on the element subset
+    CeedOperator op_range;
+
+    CeedProfileCall(&timer, CeedOperatorGetRangeOperator(op, elem_start, elem_stop, &op_range));
+    CeedProfileCall(&timer, CeedOperatorApplyAdd(op_range, in, out, request));
+  }
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -631,6 +800,7 @@ int CeedOperatorCreate(Ceed ceed, CeedQFunction qf, CeedQFunction dqf, CeedQFunc
   (*op)->qf          = qf;
   (*op)->input_size  = -1;
   (*op)->output_size = -1;
+  (*op)->precision   = CEED_SCALAR_TYPE;
   CeedCall(CeedQFunctionReference(qf));
   if (dqf && dqf != CEED_QFUNCTION_NONE) {
     (*op)->dqf = dqf;
@@ -676,6 +846,7 @@ int CeedCompositeOperatorCreate(Ceed ceed, CeedOperator *op) {
   CeedCall(CeedCalloc(CEED_COMPOSITE_MAX, &(*op)->sub_operators));
   (*op)->input_size  = -1;
   (*op)->output_size = -1;
+  (*op)->precision   = CEED_SCALAR_TYPE;
 
   if (ceed->CompositeOperatorCreate) {
     CeedCall(ceed->CompositeOperatorCreate(*op));
@@ -1171,7 +1342,8 @@ int CeedOperatorGetActiveVectorLengths(CeedOperator op, CeedSize *input_size, Ce
   @brief Set reuse of CeedQFunction data in CeedOperatorLinearAssemble* functions.
            When `reuse_assembly_data = false` (default), the CeedQFunction associated with this CeedOperator is re-assembled every time a
 `CeedOperatorLinearAssemble*` function is called. When `reuse_assembly_data = true`, the CeedQFunction associated with this CeedOperator is reused
-between calls to `CeedOperatorSetQFunctionAssemblyDataUpdated`.
+between calls to `CeedOperatorSetQFunctionAssemblyDataUpdated` and changes to the CeedQFunctionContext data.
+Only changes through context field labels or CeedQFunctionContextGetData() count, not writes by the CeedQFunction during application.
 
   @param[in] op                  CeedOperator
   @param[in] reuse_assembly_data Boolean flag setting assembly data reuse
@@ -1252,6 +1424,59 @@ int CeedOperatorSetNumQuadraturePoints(CeedOperator op, CeedInt num_qpts) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the precision for applying a CeedOperator.
+           Vectors passed to the CeedOperator keep the precision of CeedScalar; backends may store internal data for the CeedOperator in
+lower precision, such as passive input E-vectors holding geometric factors, and convert to CeedScalar at the element restriction boundary.
+           This reduces memory traffic for CeedOperators that do not need full accuracy, such as multigrid smoothers and preconditioners.
+           Currently only the `/cpu/self/opt` and `/cpu/self/avx` backends support @ref CEED_SCALAR_FP32, and only for passive input E-vectors;
+active inputs and outputs, Q-vectors, basis actions, and the QFunction are evaluated in CeedScalar precision, and element range applications with
+CeedOperatorApplyAddRange() use CeedScalar passive inputs.
+           Backends without support for the requested precision return @ref CEED_ERROR_UNSUPPORTED; the precision of CeedScalar is always supported.
+           For composite CeedOperators, the precision is set for all sub-operators.
+
+  @param[in,out] op        CeedOperator
+  @param[in]     precision Precision to use for CeedOperator data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorSetPrecision(CeedOperator op, CeedScalarType precision) {
+  if (op->is_immutable) {
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_MAJOR, "Operator cannot be changed after set as immutable");
+    // LCOV_EXCL_STOP
+  }
+  if (op->is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorSetPrecision(op->sub_operators[i], precision));
+  } else if (precision != CEED_SCALAR_TYPE) {
+    if (!op->SetPrecision) {
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not implement CeedOperatorSetPrecision");
+      // LCOV_EXCL_STOP
+    }
+    CeedCall(op->SetPrecision(op, precision));
+  }
+  op->precision = precision;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the precision requested for applying a CeedOperator
+
+  @param[in]  op        CeedOperator
+  @param[out] precision Variable to store precision
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Advanced
+**/
+int CeedOperatorGetPrecision(CeedOperator op, CeedScalarType *precision) {
+  *precision = op->precision;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Set name of CeedOperator for CeedOperatorView output
 
@@ -1276,6 +1501,56 @@ int CeedOperatorSetName(CeedOperator op, const char *name) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set the elements of a CeedOperator that touch ghost entries of the active input or output L-vectors
+
+  The remaining interior elements may be applied with CeedOperatorApplyInterior() or CeedOperatorApplyAddInterior() before ghost values are
+    communicated, and the ghost elements applied with CeedOperatorApplyAddGhost() afterwards.
+  Ghost elements are typically found with CeedElemRestrictionGetGhostElements() for the active CeedElemRestriction.
+  Without ghost elements set, all elements are treated as ghost elements.
+
+  @param[in,out] op             CeedOperator, not composite
+  @param[in]     num_ghost_elem Number of elements touching ghost entries
+  @param[in]     elem_indices   Array of length @a num_ghost_elem holding the indices of elements touching ghost entries, in increasing order
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorSetGhostElements(CeedOperator op, CeedInt num_ghost_elem, const CeedInt *elem_indices) {
+  if (op->is_composite) {
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_MINOR, "Ghost elements must be set on composite CeedOperator sub-operators");
+    // LCOV_EXCL_STOP
+  }
+  if (!op->has_restriction) {
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_INCOMPLETE, "At least one restriction required to set ghost elements");
+    // LCOV_EXCL_STOP
+  }
+  for (CeedInt i = 0; i < num_ghost_elem; i++) {
+    if (elem_indices[i] < 0 || elem_indices[i] >= op->num_elem || (i > 0 && elem_indices[i] <= elem_indices[i - 1])) {
+      // LCOV_EXCL_START
+      return CeedError(op->ceed, CEED_ERROR_DIMENSION, "Ghost element indices must be increasing and in the range [0, %" CeedInt_FMT "]",
+                       op->num_elem - 1);
+      // LCOV_EXCL_STOP
+    }
+  }
+
+  // Clear previous split
+  CeedCall(CeedOperatorDestroy(&op->op_interior));
+  CeedCall(CeedOperatorDestroy(&op->op_ghost));
+  CeedCall(CeedFree(&op->ghost_elems));
+  op->is_ghost_split_setup = false;
+
+  // Copy ghost elements
+  CeedCall(CeedMalloc(num_ghost_elem, &op->ghost_elems));
+  for (CeedInt i = 0; i < num_ghost_elem; i++) op->ghost_elems[i] = elem_indices[i];
+  op->num_ghost_elem  = num_ghost_elem;
+  op->has_ghost_elems = true;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a CeedOperator
 
@@ -1647,6 +1922,10 @@ int CeedOperatorRestoreContextInt32Read(CeedOperator op, CeedContextFieldLabel f
 
   Note: Calling this function asserts that setup is complete and sets the CeedOperator as immutable.
 
+  Note: With a non-blocking request, no other libCEED call may use the Ceed of @a op, or any object created from it, until CeedRequestWait() returns,
+    except further non-blocking applications, which are queued in order.
+        This includes @a op, @a in, @a out, and the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects of @a op.
+
   @param[in]  op      CeedOperator to apply
   @param[in]  in      CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
   @param[out] out     CeedVector to store result of applying operator (must be distinct from @a in) or @ref CEED_VECTOR_NONE if there are no active
@@ -1658,12 +1937,18 @@ outputs
   @ref User
 **/
 int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool             is_queued;
+  CeedProfileTimer timer;
+
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyQueued(op, CeedOperatorApply, in, out, request, &is_queued));
+  if (is_queued) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_APPLY, &timer));
 
   if (op->num_elem) {
     // Standard Operator
     if (op->Apply) {
-      CeedCall(op->Apply(op, in, out, request));
+      CeedProfileCall(&timer, op->Apply(op, in, out, request));
     } else {
       // Zero all output vectors
       CeedQFunction qf = op->qf;
@@ -1671,40 +1956,45 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
         CeedVector vec = op->output_fields[i]->vec;
         if (vec == CEED_VECTOR_ACTIVE) vec = out;
         if (vec != CEED_VECTOR_NONE) {
-          CeedCall(CeedVectorSetValue(vec, 0.0));
+          CeedProfileCall(&timer, CeedVectorSetValue(vec, 0.0));
         }
       }
       // Apply
-      CeedCall(op->ApplyAdd(op, in, out, request));
+      CeedProfileCall(&timer, op->ApplyAdd(op, in, out, request));
     }
   } else if (op->is_composite) {
     // Composite Operator
     if (op->ApplyComposite) {
-      CeedCall(op->ApplyComposite(op, in, out, request));
+      CeedProfileCall(&timer, op->ApplyComposite(op, in, out, request));
     } else {
       CeedInt num_suboperators;
-      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+      CeedProfileCall(&timer, CeedCompositeOperatorGetNumSub(op, &num_suboperators));
       CeedOperator *sub_operators;
-      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+      CeedProfileCall(&timer, CeedCompositeOperatorGetSubList(op, &sub_operators));
 
       // Zero all output vectors
       if (out != CEED_VECTOR_NONE) {
-        CeedCall(CeedVectorSetValue(out, 0.0));
+        CeedProfileCall(&timer, CeedVectorSetValue(out, 0.0));
       }
       for (CeedInt i = 0; i < num_suboperators; i++) {
         for (CeedInt j = 0; j < sub_operators[i]->qf->num_output_fields; j++) {
           CeedVector vec = sub_operators[i]->output_fields[j]->vec;
           if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) {
-            CeedCall(CeedVectorSetValue(vec, 0.0));
+            CeedProfileCall(&timer, CeedVectorSetValue(vec, 0.0));
           }
         }
       }
       // Apply
-      for (CeedInt i = 0; i < op->num_suboperators; i++) {
-        CeedCall(CeedOperatorApplyAdd(op->sub_operators[i], in, out, request));
+      if (op->ApplyAddComposite) {
+        CeedProfileCall(&timer, op->ApplyAddComposite(op, in, out, request));
+      } else {
+        for (CeedInt i = 0; i < op->num_suboperators; i++) {
+          CeedProfileCall(&timer, CeedOperatorApplyAdd(op->sub_operators[i], in, out, request));
+        }
       }
     }
   }
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1714,6 +2004,10 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   This computes the action of the operator on the specified (active) input, yielding its (active) output.
   All inputs and outputs must be specified using CeedOperatorSetField().
 
+  Note: With a non-blocking request, no other libCEED call may use the Ceed of @a op, or any object created from it, until CeedRequestWait() returns,
+    except further non-blocking applications, which are queued in order.
+        This includes @a op, @a in, @a out, and the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects of @a op.
+
   @param[in]  op      CeedOperator to apply
   @param[in]  in      CeedVector containing input state or NULL if there are no active inputs
   @param[out] out     CeedVector to sum in result of applying operator (must be distinct from @a in) or NULL if there are no active outputs
@@ -1724,26 +2018,219 @@ int CeedOperatorApply(CeedOperator op, CeedVector in, CeedVector out, CeedReques
   @ref User
 **/
 int CeedOperatorApplyAdd(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool             is_queued;
+  CeedProfileTimer timer;
+
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyQueued(op, CeedOperatorApplyAdd, in, out, request, &is_queued));
+  if (is_queued) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_APPLY, &timer));
 
   if (op->num_elem) {
     // Standard Operator
-    CeedCall(op->ApplyAdd(op, in, out, request));
+    CeedProfileCall(&timer, op->ApplyAdd(op, in, out, request));
   } else if (op->is_composite) {
     // Composite Operator
     if (op->ApplyAddComposite) {
-      CeedCall(op->ApplyAddComposite(op, in, out, request));
+      CeedProfileCall(&timer, op->ApplyAddComposite(op, in, out, request));
     } else {
       CeedInt num_suboperators;
-      CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+      CeedProfileCall(&timer, CeedCompositeOperatorGetNumSub(op, &num_suboperators));
       CeedOperator *sub_operators;
-      CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
+      CeedProfileCall(&timer, CeedCompositeOperatorGetSubList(op, &sub_operators));
 
       for (CeedInt i = 0; i < num_suboperators; i++) {
-        CeedCall(CeedOperatorApplyAdd(sub_operators[i], in, out, request));
+        CeedProfileCall(&timer, CeedOperatorApplyAdd(sub_operators[i], in, out, request));
       }
     }
   }
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the interior elements of a CeedOperator to a vector
+
+  This computes the action of the elements that do not touch ghost entries, set with CeedOperatorSetGhostElements(), on the (active) input.
+  Ghost entries of @a in are not read, so this may be called before ghost values are communicated.
+  The action of the ghost elements is added with CeedOperatorApplyAddGhost() to complete CeedOperatorApply().
+  For composite CeedOperators, the interior elements of each sub-operator are applied.
+
+  Note: With a non-blocking request, no other libCEED call may use the Ceed of @a op, or any object created from it, until CeedRequestWait() returns,
+    except further non-blocking applications, which are queued in order.
+        This includes @a op, @a in, @a out, and the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects of @a op.
+
+  @param[in]  op      CeedOperator to apply
+  @param[in]  in      CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out     CeedVector to store result of applying interior elements (must be distinct from @a in) or @ref CEED_VECTOR_NONE if there are
+                        no active outputs
+  @param[in]  request Address of CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyInterior(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_queued;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyQueued(op, CeedOperatorApplyInterior, in, out, request, &is_queued));
+  if (is_queued) return CEED_ERROR_SUCCESS;
+
+  // Zero all output vectors
+  if (out != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(out, 0.0));
+  for (CeedInt i = 0; i < (op->is_composite ? op->num_suboperators : 1); i++) {
+    CeedOperator sub_op = op->is_composite ? op->sub_operators[i] : op;
+
+    for (CeedInt j = 0; j < sub_op->qf->num_output_fields; j++) {
+      CeedVector vec = sub_op->output_fields[j]->vec;
+
+      if (vec != CEED_VECTOR_ACTIVE && vec != CEED_VECTOR_NONE) CeedCall(CeedVectorSetValue(vec, 0.0));
+    }
+  }
+  // Apply
+  CeedCall(CeedOperatorApplyAddInterior(op, in, out, request));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the interior elements of a CeedOperator to a vector and add result to output vector
+
+  See CeedOperatorApplyInterior().
+
+  Note: With a non-blocking request, no other libCEED call may use the Ceed of @a op, or any object created from it, until CeedRequestWait() returns,
+    except further non-blocking applications, which are queued in order.
+        This includes @a op, @a in, @a out, and the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects of @a op.
+
+  @param[in]  op      CeedOperator to apply
+  @param[in]  in      CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out     CeedVector to sum in result of applying interior elements (must be distinct from @a in) or @ref CEED_VECTOR_NONE if there are
+                        no active outputs
+  @param[in]  request Address of CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddInterior(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_queued;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyQueued(op, CeedOperatorApplyAddInterior, in, out, request, &is_queued));
+  if (is_queued) return CEED_ERROR_SUCCESS;
+
+  if (op->is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorApplyAddInterior(op->sub_operators[i], in, out, request));
+  } else {
+    CeedOperator op_interior, op_ghost;
+
+    CeedCall(CeedOperatorGetGhostSplit(op, &op_interior, &op_ghost));
+    if (op_interior) CeedCall(CeedOperatorApplyAdd(op_interior, in, out, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply the ghost elements of a CeedOperator to a vector and add result to output vector
+
+  This adds the action of the elements that touch ghost entries, set with CeedOperatorSetGhostElements(), on the (active) input.
+  After CeedOperatorApplyInterior(), this completes CeedOperatorApply().
+  For composite CeedOperators, the ghost elements of each sub-operator are applied.
+
+  Note: With a non-blocking request, no other libCEED call may use the Ceed of @a op, or any object created from it, until CeedRequestWait() returns,
+    except further non-blocking applications, which are queued in order.
+        This includes @a op, @a in, @a out, and the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects of @a op.
+
+  @param[in]  op      CeedOperator to apply
+  @param[in]  in      CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out     CeedVector to sum in result of applying ghost elements (must be distinct from @a in) or @ref CEED_VECTOR_NONE if there are no
+                        active outputs
+  @param[in]  request Address of CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddGhost(CeedOperator op, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_queued;
+
+  CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedOperatorApplyQueued(op, CeedOperatorApplyAddGhost, in, out, request, &is_queued));
+  if (is_queued) return CEED_ERROR_SUCCESS;
+
+  if (op->is_composite) {
+    for (CeedInt i = 0; i < op->num_suboperators; i++) CeedCall(CeedOperatorApplyAddGhost(op->sub_operators[i], in, out, request));
+  } else {
+    CeedOperator op_interior, op_ghost;
+
+    CeedCall(CeedOperatorGetGhostSplit(op, &op_interior, &op_ghost));
+    if (op_ghost) CeedCall(CeedOperatorApplyAdd(op_ghost, in, out, request));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Apply a range of elements of a CeedOperator to a vector and add result to output vector
+
+  This adds the action of the elements [@a elem_start, @a elem_stop) on the (active) input, so that applying a partition of [0, num_elem) into ranges
+    sums to CeedOperatorApplyAdd().
+  Only the entries of @a out touched by the elements in the range are written.
+  Backends applying elements in blocks may read the entries of @a in touched by the other elements of a partially covered block.
+  This is not supported for composite CeedOperators, since sub-operators do not share an element numbering.
+
+  Range applications of the same CeedOperator may run concurrently from different threads, for instance one per element range, if each call sums
+    into its own @a out vector.
+  During concurrent range applications, @a in, the passive inputs, and the CeedQFunctionContext must not be modified, the context is only read, and
+    no other application of the CeedOperator may run.
+  Range applications of CeedOperators with passive outputs, profiled range applications, and range applications on backends without element range
+    support are serialized.
+
+  Note: Range applications are not queued; any pending non-blocking applications are completed first and @a request is set to NULL.
+  Note: Backends without element range support apply an operator on the element subset, which is created on first use of each range and cached.
+
+  @param[in]  op         CeedOperator to apply
+  @param[in]  elem_start First element to apply
+  @param[in]  elem_stop  One past the last element to apply
+  @param[in]  in         CeedVector containing input state or @ref CEED_VECTOR_NONE if there are no active inputs
+  @param[out] out        CeedVector to sum in result of applying the elements (must be distinct from @a in) or @ref CEED_VECTOR_NONE if there are no
+                           active outputs
+  @param[in]  request    Address of CeedRequest for non-blocking completion, else @ref CEED_REQUEST_IMMEDIATE
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedOperatorApplyAddRange(CeedOperator op, CeedInt elem_start, CeedInt elem_stop, CeedVector in, CeedVector out, CeedRequest *request) {
+  bool is_profiling = false, is_serial;
+  int  ierr;
+
+  if (request != CEED_REQUEST_IMMEDIATE && request != CEED_REQUEST_ORDERED) *request = NULL;
+  if (op->is_composite) {
+    // LCOV_EXCL_START
+    return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Element range application not supported for composite operator");
+    // LCOV_EXCL_STOP
+  }
+
+  // Setup, profiling data, and the element subset operators are shared, so they are only used with the thread lock held
+  CeedCall(CeedThreadLock(op->ceed));
+  ierr = CeedOperatorCheckReady(op);
+  if (ierr == CEED_ERROR_SUCCESS) ierr = CeedRequestQueueWait(op->ceed);
+  if (ierr == CEED_ERROR_SUCCESS) ierr = CeedIsProfiling(op->ceed, &is_profiling);
+  if (ierr == CEED_ERROR_SUCCESS && (elem_start < 0 || elem_start > elem_stop || elem_stop > op->num_elem)) {
+    // LCOV_EXCL_START
+    ierr = CeedError(op->ceed, CEED_ERROR_DIMENSION,
+                     "Cannot apply elements [%" CeedInt_FMT ", %" CeedInt_FMT "), total elements %" CeedInt_FMT "", elem_start, elem_stop,
+                     op->num_elem);
+    // LCOV_EXCL_STOP
+  }
+  is_serial = is_profiling || !op->ApplyAddRange;
+  if (ierr == CEED_ERROR_SUCCESS && is_serial && elem_start < elem_stop) {
+    ierr = CeedOperatorApplyAddRangeSerial(op, elem_start, elem_stop, in, out, request);
+  }
+  CeedCall(CeedThreadUnlock(op->ceed));
+  CeedCall(ierr);
+
+  if (!is_serial && elem_start < elem_stop) CeedCall(op->ApplyAddRange(op, elem_start, elem_stop, in, out, request));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1792,6 +2279,22 @@ int CeedOperatorDestroy(CeedOperator *op) {
       CeedCall(CeedFree(&(*op)->output_fields[i]));
     }
   }
+  // Destroy interior and ghost element operators
+  CeedCall(CeedOperatorDestroy(&(*op)->op_interior));
+  CeedCall(CeedOperatorDestroy(&(*op)->op_ghost));
+  CeedCall(CeedFree(&(*op)->ghost_elems));
+  // Destroy element range operators
+  for (CeedInt i = 0; i < (*op)->num_range_ops; i++) CeedCall(CeedOperatorDestroy(&(*op)->range_ops[i]));
+  CeedCall(CeedFree(&(*op)->range_ops));
+  CeedCall(CeedFree(&(*op)->range_bounds));
+  // Destroy cached multigrid level
+  CeedCall(CeedVectorDestroy(&(*op)->mg_p_mult_fine));
+  CeedCall(CeedElemRestrictionDestroy(&(*op)->mg_rstr_coarse));
+  CeedCall(CeedBasisDestroy(&(*op)->mg_basis_coarse));
+  CeedCall(CeedBasisDestroy(&(*op)->mg_basis_c_to_f));
+  CeedCall(CeedOperatorDestroy(&(*op)->mg_op_coarse));
+  CeedCall(CeedOperatorDestroy(&(*op)->mg_op_prolong));
+  CeedCall(CeedOperatorDestroy(&(*op)->mg_op_restrict));
   // Destroy sub_operators
   for (CeedInt i = 0; i < (*op)->num_suboperators; i++) {
     if ((*op)->sub_operators[i]) {
@@ -208,6 +208,76 @@ static inline void CeedOperatorGetBasisPointer(CeedEvalMode eval_mode, const Cee
   assert(*basis_ptr != NULL);
 }
 
+/**
+  @brief Get the identity matrix used for CEED_EVAL_NONE in diagonal assembly of an active CeedBasis
+
+  The matrix is created on first use and cached with the CeedOperatorAssemblyData, so repeated diagonal assembly does not rebuild it.
+
+  @param[in]  data     CeedOperatorAssemblyData
+  @param[in]  b        Index of the active CeedBasis
+  @param[in]  num_rows Number of rows, the number of quadrature points
+  @param[in]  num_cols Number of columns, the number of nodes
+  @param[out] identity Pointer to hold the num_rows * num_cols identity matrix
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedOperatorAssemblyDataGetDiagonalIdentity(CeedOperatorAssemblyData data, CeedInt b, CeedInt num_rows, CeedInt num_cols,
+                                                       const CeedScalar **identity) {
+  if (!data->diag_identities) CeedCall(CeedCalloc(data->num_active_bases, &data->diag_identities));
+  if (!data->diag_identities[b]) {
+    CeedCall(CeedCalloc(num_rows * num_cols, &data->diag_identities[b]));
+    for (CeedInt i = 0; i < (num_cols < num_rows ? num_cols : num_rows); i++) data->diag_identities[b][i * num_cols + i] = 1.0;
+  }
+  *identity = data->diag_identities[b];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Sum factorized diagonal contribution for a tensor product basis.
+           Computes v += (M_{dim-1} x ... x M_0)^T u, a Kronecker product, where each M_d is the entrywise product of the 1D test and trial basis
+             matrices in dimension d.
+           The cost is O(Q_1d^dim P_1d) rather than O(Q_1d^dim P_1d^dim) for the dense basis matrices.
+
+  @param[in]     dim  Dimension of basis
+  @param[in]     P_1d Number of nodes in 1D
+  @param[in]     Q_1d Number of quadrature points in 1D
+  @param[in]     mats dim matrices of size Q_1d x P_1d, with the first for the fastest varying dimension
+  @param[in]     u    Input array of Q_1d^dim values at quadrature points
+  @param[in,out] v    Output array of P_1d^dim values at nodes, summed into
+  @param[out]    work Work array of size 2 max(P_1d, Q_1d)^dim
+
+  @ref Developer
+**/
+static inline void CeedOperatorTensorDiagonalContract(CeedInt dim, CeedInt P_1d, CeedInt Q_1d, const CeedScalar *mats, const CeedScalar *u,
+                                                      CeedScalar *v, CeedScalar *work) {
+  const CeedInt     max_size = CeedIntPow(CeedIntMax(P_1d, Q_1d), dim);
+  CeedInt           pre = CeedIntPow(Q_1d, dim - 1), post = 1;
+  const CeedScalar *in  = u;
+
+  for (CeedInt d = 0; d < dim; d++) {
+    const CeedScalar *mat = &mats[d * Q_1d * P_1d];
+    CeedScalar       *out = d == dim - 1 ? v : &work[(d % 2) * max_size];
+
+    if (d < dim - 1) {
+      for (CeedInt i = 0; i < pre * P_1d * post; i++) out[i] = 0.0;
+    }
+    for (CeedInt a = 0; a < pre; a++) {
+      for (CeedInt q = 0; q < Q_1d; q++) {
+        for (CeedInt p = 0; p < P_1d; p++) {
+          const CeedScalar m = mat[q * P_1d + p];
+
+          for (CeedInt c = 0; c < post; c++) out[(a * P_1d + p) * post + c] += m * in[(a * Q_1d + q) * post + c];
+        }
+      }
+    }
+    in = out;
+    pre /= Q_1d;
+    post *= P_1d;
+  }
+}
+
 /**
   @brief Create point block restriction for active operator field
 
@@ -221,11 +291,11 @@ static inline void CeedOperatorGetBasisPointer(CeedEvalMode eval_mode, const Cee
 static int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rstr, CeedElemRestriction *pointblock_rstr) {
   Ceed ceed;
   CeedCall(CeedElemRestrictionGetCeed(rstr, &ceed));
-  const CeedInt *offsets;
-  CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+  bool has_offsets_64;
+  CeedCall(CeedElemRestrictionHasOffsets64(rstr, &has_offsets_64));
 
   // Expand offsets
-  CeedInt  num_elem, num_comp, elem_size, comp_stride, *pointblock_offsets;
+  CeedInt  num_elem, num_comp, elem_size, comp_stride;
   CeedSize l_size;
   CeedCall(CeedElemRestrictionGetNumElements(rstr, &num_elem));
   CeedCall(CeedElemRestrictionGetNumComponents(rstr, &num_comp));
@@ -234,18 +304,34 @@ static int CeedOperatorCreateActivePointBlockRestriction(CeedElemRestriction rst
   CeedCall(CeedElemRestrictionGetLVectorSize(rstr, &l_size));
   CeedInt shift = num_comp;
   if (comp_stride != 1) shift *= num_comp;
-  CeedCall(CeedCalloc(num_elem * elem_size, &pointblock_offsets));
-  for (CeedInt i = 0; i < num_elem * elem_size; i++) {
-    pointblock_offsets[i] = offsets[i] * shift;
-  }
-
-  // Create new restriction
-  CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp * num_comp, 1, l_size * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER,
-                                     pointblock_offsets, pointblock_rstr));
-
-  // Cleanup
-  CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
 
+  // Create new restriction, with 64-bit offsets if the point block L-vector needs them
+  if (has_offsets_64 || l_size * num_comp > INT32_MAX) {
+    CeedSize *pointblock_offsets;
+    CeedCall(CeedCalloc((CeedSize)num_elem * elem_size, &pointblock_offsets));
+    if (has_offsets_64) {
+      const CeedSize *offsets;
+      CeedCall(CeedElemRestrictionGetOffsets64(rstr, CEED_MEM_HOST, &offsets));
+      for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) pointblock_offsets[i] = offsets[i] * shift;
+      CeedCall(CeedElemRestrictionRestoreOffsets64(rstr, &offsets));
+    } else {
+      const CeedInt *offsets;
+      CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+      for (CeedSize i = 0; i < (CeedSize)num_elem * elem_size; i++) pointblock_offsets[i] = (CeedSize)offsets[i] * shift;
+      CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+    }
+    CeedCall(CeedElemRestrictionCreate64(ceed, num_elem, elem_size, num_comp * num_comp, 1, l_size * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                         pointblock_offsets, pointblock_rstr));
+  } else {
+    const CeedInt *offsets;
+    CeedInt       *pointblock_offsets;
+    CeedCall(CeedElemRestrictionGetOffsets(rstr, CEED_MEM_HOST, &offsets));
+    CeedCall(CeedCalloc(num_elem * elem_size, &pointblock_offsets));
+    for (CeedInt i = 0; i < num_elem * elem_size; i++) pointblock_offsets[i] = offsets[i] * shift;
+    CeedCall(CeedElemRestrictionRestoreOffsets(rstr, &offsets));
+    CeedCall(CeedElemRestrictionCreate(ceed, num_elem, elem_size, num_comp * num_comp, 1, l_size * num_comp, CEED_MEM_HOST, CEED_OWN_POINTER,
+                                       pointblock_offsets, pointblock_rstr));
+  }
   return CEED_ERROR_SUCCESS;
 }
 
@@ -292,38 +378,38 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
   CeedCall(CeedOperatorAssemblyDataGetEvalModes(data, &num_active_bases, &num_eval_modes_in, &eval_modes_in, &eval_mode_offsets_in,
                                                 &num_eval_modes_out, &eval_modes_out, &eval_mode_offsets_out, &num_output_components));
   CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, &active_bases, NULL, NULL));
-  CeedCall(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs));
+  // Point block diagonal restrictions are cached with the assembly data
+  if (is_pointblock) CeedCall(CeedOperatorAssemblyDataGetPointBlockElemRestrictions(data, NULL, &active_elem_rstrs));
+  else CeedCall(CeedOperatorAssemblyDataGetElemRestrictions(data, NULL, &active_elem_rstrs));
 
   // Loop over all active bases
   for (CeedInt b = 0; b < num_active_bases; b++) {
-    // Assemble point block diagonal restriction, if needed
     CeedElemRestriction diag_elem_rstr = active_elem_rstrs[b];
 
-    if (is_pointblock) {
-      CeedElemRestriction point_block_elem_rstr;
-
-      CeedCall(CeedOperatorCreateActivePointBlockRestriction(diag_elem_rstr, &point_block_elem_rstr));
-      diag_elem_rstr = point_block_elem_rstr;
-    }
-
-    // Create diagonal vector
+    // Get diagonal work vector
     CeedVector elem_diag;
-    CeedCall(CeedElemRestrictionCreateVector(diag_elem_rstr, NULL, &elem_diag));
+    CeedInt    num_elem, elem_size, num_diag_comp;
+
+    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
+    CeedCall(CeedElemRestrictionGetElementSize(diag_elem_rstr, &elem_size));
+    CeedCall(CeedElemRestrictionGetNumComponents(diag_elem_rstr, &num_diag_comp));
+    CeedCall(CeedGetWorkVector(ceed, (CeedSize)num_elem * elem_size * num_diag_comp, &elem_diag));
 
     // Assemble element operator diagonals
     CeedScalar *elem_diag_array;
-    CeedInt     num_elem, num_nodes, num_qpts, num_components;
+    CeedInt     num_nodes, num_qpts, num_components;
 
     CeedCall(CeedVectorSetValue(elem_diag, 0.0));
     CeedCall(CeedVectorGetArray(elem_diag, CEED_MEM_HOST, &elem_diag_array));
-    CeedCall(CeedElemRestrictionGetNumElements(diag_elem_rstr, &num_elem));
     CeedCall(CeedBasisGetNumNodes(active_bases[b], &num_nodes));
     CeedCall(CeedBasisGetNumComponents(active_bases[b], &num_components));
     CeedCall(CeedBasisGetNumQuadraturePoints(active_bases[b], &num_qpts));
 
     // Basis matrices
-    const CeedScalar *interp, *grad;
-    CeedScalar       *identity      = NULL;
+    bool              is_tensor;
+    CeedInt           dim, P_1d = 0, Q_1d = 0;
+    const CeedScalar *interp = NULL, *grad = NULL, *identity = NULL;
+    CeedScalar       *diag_mats = NULL, *qf_values = NULL, *work = NULL;
     bool              has_eval_none = false;
     for (CeedInt i = 0; i < num_eval_modes_in[b]; i++) {
       has_eval_none = has_eval_none || (eval_modes_in[b][i] == CEED_EVAL_NONE);
@@ -331,12 +417,44 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
     for (CeedInt i = 0; i < num_eval_modes_out[b]; i++) {
       has_eval_none = has_eval_none || (eval_modes_out[b][i] == CEED_EVAL_NONE);
     }
-    if (has_eval_none) {
-      CeedCall(CeedCalloc(num_qpts * num_nodes, &identity));
-      for (CeedInt i = 0; i < (num_nodes < num_qpts ? num_nodes : num_qpts); i++) identity[i * num_nodes + i] = 1.0;
+    CeedCall(CeedBasisIsTensor(active_bases[b], &is_tensor));
+    if (is_tensor) {
+      CeedCall(CeedBasisGetDimension(active_bases[b], &dim));
+      CeedCall(CeedBasisGetNumNodes1D(active_bases[b], &P_1d));
+      CeedCall(CeedBasisGetNumQuadraturePoints1D(active_bases[b], &Q_1d));
+      // The dense identity is only a tensor product when P_1d = Q_1d
+      is_tensor = !has_eval_none || P_1d == Q_1d;
+    }
+    if (is_tensor) {
+      // Entrywise products of 1D test and trial basis matrices for each eval mode pair, so the diagonal is sum factorized
+      const CeedScalar *interp_1d, *grad_1d;
+      CeedInt           d_out = -1;
+
+      CeedCall(CeedBasisGetInterp1D(active_bases[b], &interp_1d));
+      CeedCall(CeedBasisGetGrad1D(active_bases[b], &grad_1d));
+      if (has_eval_none) CeedCall(CeedOperatorAssemblyDataGetDiagonalIdentity(data, b, Q_1d, P_1d, &identity));
+      CeedCall(CeedCalloc(num_eval_modes_out[b] * num_eval_modes_in[b] * dim * Q_1d * P_1d, &diag_mats));
+      for (CeedInt e_out = 0; e_out < num_eval_modes_out[b]; e_out++) {
+        CeedInt d_in = -1;
+        if (eval_modes_out[b][e_out] == CEED_EVAL_GRAD) d_out += 1;
+        for (CeedInt e_in = 0; e_in < num_eval_modes_in[b]; e_in++) {
+          CeedScalar *mats = &diag_mats[(e_out * num_eval_modes_in[b] + e_in) * dim * Q_1d * P_1d];
+          if (eval_modes_in[b][e_in] == CEED_EVAL_GRAD) d_in += 1;
+          for (CeedInt d = 0; d < dim; d++) {
+            const CeedScalar *B_t = NULL, *B = NULL;
+            CeedOperatorGetBasisPointer(eval_modes_out[b][e_out], identity, interp_1d, d == d_out ? grad_1d : interp_1d, &B_t);
+            CeedOperatorGetBasisPointer(eval_modes_in[b][e_in], identity, interp_1d, d == d_in ? grad_1d : interp_1d, &B);
+            for (CeedInt i = 0; i < Q_1d * P_1d; i++) mats[d * Q_1d * P_1d + i] = B_t[i] * B[i];
+          }
+        }
+      }
+      CeedCall(CeedCalloc(num_qpts, &qf_values));
+      CeedCall(CeedCalloc(2 * CeedIntPow(CeedIntMax(P_1d, Q_1d), dim), &work));
+    } else {
+      if (has_eval_none) CeedCall(CeedOperatorAssemblyDataGetDiagonalIdentity(data, b, num_qpts, num_nodes, &identity));
+      CeedCall(CeedBasisGetInterp(active_bases[b], &interp));
+      CeedCall(CeedBasisGetGrad(active_bases[b], &grad));
     }
-    CeedCall(CeedBasisGetInterp(active_bases[b], &interp));
-    CeedCall(CeedBasisGetGrad(active_bases[b], &grad));
     // Compute the diagonal of B^T D B
     // Each element
     for (CeedInt e = 0; e < num_elem; e++) {
@@ -345,32 +463,29 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
       for (CeedInt e_out = 0; e_out < num_eval_modes_out[b]; e_out++) {
         const CeedScalar *B_t = NULL;
         if (eval_modes_out[b][e_out] == CEED_EVAL_GRAD) d_out += 1;
-        CeedOperatorGetBasisPointer(eval_modes_out[b][e_out], identity, interp, &grad[d_out * num_qpts * num_nodes], &B_t);
+        if (!is_tensor) CeedOperatorGetBasisPointer(eval_modes_out[b][e_out], identity, interp, &grad[d_out * num_qpts * num_nodes], &B_t);
         CeedInt d_in = -1;
         for (CeedInt e_in = 0; e_in < num_eval_modes_in[b]; e_in++) {
           const CeedScalar *B = NULL;
           if (eval_modes_in[b][e_in] == CEED_EVAL_GRAD) d_in += 1;
-          CeedOperatorGetBasisPointer(eval_modes_in[b][e_in], identity, interp, &grad[d_in * num_qpts * num_nodes], &B);
-          // Each component
+          if (!is_tensor) CeedOperatorGetBasisPointer(eval_modes_in[b][e_in], identity, interp, &grad[d_in * num_qpts * num_nodes], &B);
+          // Each component, or component pair for point block diagonal
           for (CeedInt c_out = 0; c_out < num_components; c_out++) {
-            // Each qpt/node pair
-            for (CeedInt q = 0; q < num_qpts; q++) {
-              if (is_pointblock) {
-                // Point Block Diagonal
-                for (CeedInt c_in = 0; c_in < num_components; c_in++) {
-                  const CeedInt c_offset = (eval_mode_offsets_in[b][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b][e_out] + c_out;
-                  const CeedScalar qf_value = assembled_qf_array[q * layout[0] + c_offset * layout[1] + e * layout[2]];
-                  for (CeedInt n = 0; n < num_nodes; n++) {
-                    elem_diag_array[((e * num_components + c_out) * num_components + c_in) * num_nodes + n] +=
-                        B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
-                  }
-                }
+            for (CeedInt c_in = is_pointblock ? 0 : c_out; c_in < (is_pointblock ? num_components : c_out + 1); c_in++) {
+              const CeedInt     c_offset = (eval_mode_offsets_in[b][e_in] + c_in) * num_output_components + eval_mode_offsets_out[b][e_out] + c_out;
+              const CeedScalar *qf_array = &assembled_qf_array[c_offset * layout[1] + e * layout[2]];
+              CeedScalar       *elem_diag_nodes =
+                  &elem_diag_array[(is_pointblock ? (e * num_components + c_out) * num_components + c_in : e * num_components + c_out) * num_nodes];
+
+              if (is_tensor) {
+                for (CeedInt q = 0; q < num_qpts; q++) qf_values[q] = qf_array[q * layout[0]];
+                CeedOperatorTensorDiagonalContract(dim, P_1d, Q_1d, &diag_mats[(e_out * num_eval_modes_in[b] + e_in) * dim * Q_1d * P_1d],
+                                                   qf_values, elem_diag_nodes, work);
               } else {
-                // Diagonal Only
-                const CeedInt    c_offset = (eval_mode_offsets_in[b][e_in] + c_out) * num_output_components + eval_mode_offsets_out[b][e_out] + c_out;
-                const CeedScalar qf_value = assembled_qf_array[q * layout[0] + c_offset * layout[1] + e * layout[2]];
-                for (CeedInt n = 0; n < num_nodes; n++) {
-                  elem_diag_array[(e * num_components + c_out) * num_nodes + n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
+                // Each qpt/node pair
+                for (CeedInt q = 0; q < num_qpts; q++) {
+                  const CeedScalar qf_value = qf_array[q * layout[0]];
+                  for (CeedInt n = 0; n < num_nodes; n++) elem_diag_nodes[n] += B_t[q * num_nodes + n] * qf_value * B[q * num_nodes + n];
                 }
               }
             }
@@ -378,15 +493,16 @@ static inline int CeedSingleOperatorAssembleAddDiagonal_Core(CeedOperator op, Ce
         }
       }
     }
+    CeedCall(CeedFree(&diag_mats));
+    CeedCall(CeedFree(&qf_values));
+    CeedCall(CeedFree(&work));
     CeedCall(CeedVectorRestoreArray(elem_diag, &elem_diag_array));
 
     // Assemble local operator diagonal
     CeedCall(CeedElemRestrictionApply(diag_elem_rstr, CEED_TRANSPOSE, elem_diag, assembled, request));
 
     // Cleanup
-    if (is_pointblock) CeedCall(CeedElemRestrictionDestroy(&diag_elem_rstr));
-    CeedCall(CeedVectorDestroy(&elem_diag));
-    CeedCall(CeedFree(&identity));
+    CeedCall(CeedRestoreWorkVector(ceed, &elem_diag));
   }
   CeedCall(CeedVectorRestoreArrayRead(assembled_qf, &assembled_qf_array));
   CeedCall(CeedVectorDestroy(&assembled_qf));
@@ -463,18 +579,18 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
 
   // Determine elem_dof relation
   CeedVector index_vec;
-  CeedCall(CeedVectorCreate(ceed, num_nodes, &index_vec));
+  CeedCall(CeedGetWorkVector(ceed, num_nodes, &index_vec));
   CeedScalar *array;
   CeedCall(CeedVectorGetArrayWrite(index_vec, CEED_MEM_HOST, &array));
   for (CeedInt i = 0; i < num_nodes; i++) array[i] = i;
   CeedCall(CeedVectorRestoreArray(index_vec, &array));
   CeedVector elem_dof;
-  CeedCall(CeedVectorCreate(ceed, num_elem * elem_size * num_comp, &elem_dof));
+  CeedCall(CeedGetWorkVector(ceed, num_elem * elem_size * num_comp, &elem_dof));
   CeedCall(CeedVectorSetValue(elem_dof, 0.0));
   CeedCall(CeedElemRestrictionApply(rstr_in, CEED_NOTRANSPOSE, index_vec, elem_dof, CEED_REQUEST_IMMEDIATE));
   const CeedScalar *elem_dof_a;
   CeedCall(CeedVectorGetArrayRead(elem_dof, CEED_MEM_HOST, &elem_dof_a));
-  CeedCall(CeedVectorDestroy(&index_vec));
+  CeedCall(CeedRestoreWorkVector(ceed, &index_vec));
 
   // Determine i, j locations for element matrices
   CeedInt count = 0;
@@ -503,11 +619,65 @@ static int CeedSingleOperatorAssembleSymbolic(CeedOperator op, CeedInt offset, C
     // LCOV_EXCL_STOP
   }
   CeedCall(CeedVectorRestoreArrayRead(elem_dof, &elem_dof_a));
-  CeedCall(CeedVectorDestroy(&elem_dof));
+  CeedCall(CeedRestoreWorkVector(ceed, &elem_dof));
 
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute matrix product C = A B for element matrix assembly
+
+  The product is blocked over the inner dimension so a panel of B stays in cache while it is applied to all rows of A.
+  Four rows of C are updated per pass over a row of B.
+
+  @param[in]  mat_A Row-major matrix A
+  @param[in]  mat_B Row-major matrix B
+  @param[out] mat_C Row-major output matrix C
+  @param[in]  m     Number of rows of C
+  @param[in]  n     Number of columns of C
+  @param[in]  kk    Number of columns of A/rows of B
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedMatrixMatrixMultiplyBlocked(const CeedScalar *mat_A, const CeedScalar *mat_B, CeedScalar *mat_C, CeedInt m, CeedInt n, CeedInt kk) {
+  const CeedInt blk_k = 64;
+
+  for (CeedInt i = 0; i < m * n; i++) mat_C[i] = 0.0;
+  for (CeedInt k_start = 0; k_start < kk; k_start += blk_k) {
+    const CeedInt k_stop = CeedIntMin(k_start + blk_k, kk);
+    CeedInt       i      = 0;
+
+    for (; i + 4 <= m; i += 4) {
+      CeedScalar *C_0 = &mat_C[i * n], *C_1 = C_0 + n, *C_2 = C_1 + n, *C_3 = C_2 + n;
+
+      for (CeedInt k = k_start; k < k_stop; k++) {
+        const CeedScalar *B   = &mat_B[k * n];
+        const CeedScalar  A_0 = mat_A[i * kk + k], A_1 = mat_A[(i + 1) * kk + k], A_2 = mat_A[(i + 2) * kk + k], A_3 = mat_A[(i + 3) * kk + k];
+
+        CeedPragmaSIMD for (CeedInt j = 0; j < n; j++) {
+          C_0[j] += A_0 * B[j];
+          C_1[j] += A_1 * B[j];
+          C_2[j] += A_2 * B[j];
+          C_3[j] += A_3 * B[j];
+        }
+      }
+    }
+    for (; i < m; i++) {
+      CeedScalar *C = &mat_C[i * n];
+
+      for (CeedInt k = k_start; k < k_stop; k++) {
+        const CeedScalar *B = &mat_B[k * n];
+        const CeedScalar  A = mat_A[i * kk + k];
+
+        CeedPragmaSIMD for (CeedInt j = 0; j < n; j++) C[j] += A * B[j];
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Assemble nonzero entries for non-composite operator
 
@@ -618,43 +788,66 @@ static int CeedSingleOperatorAssemble(CeedOperator op, CeedInt offset, CeedVecto
   const CeedScalar **B_mats_in, **B_mats_out;
   CeedCall(CeedOperatorAssemblyDataGetBases(data, NULL, NULL, &B_mats_in, &B_mats_out));
   const CeedScalar *B_mat_in = B_mats_in[0], *B_mat_out = B_mats_out[0];
-  CeedScalar        BTD_mat[elem_size * num_qpts * num_eval_modes_in[0]];
-  CeedScalar        elem_mat[elem_size * elem_size];
+  const CeedInt     num_eval_in = num_eval_modes_in[0], num_eval_out = num_eval_modes_out[0];
+  const CeedInt     num_comp_pairs = num_comp * num_comp;
+  CeedScalar       *B_mat_out_t, *D_mat, *BTD_mat;
   CeedInt           count = 0;
   CeedScalar       *vals;
+
+  // B_mat_out transposed to [node][qpt][eval_mode] so the sum over output eval modes is contiguous
+  CeedCall(CeedMalloc(elem_size * num_qpts * num_eval_out, &B_mat_out_t));
+  for (CeedInt n = 0; n < elem_size; n++) {
+    for (CeedInt q = 0; q < num_qpts; q++) {
+      for (CeedInt e_out = 0; e_out < num_eval_out; e_out++) {
+        B_mat_out_t[(n * num_qpts + q) * num_eval_out + e_out] = B_mat_out[(num_eval_out * q + e_out) * elem_size + n];
+      }
+    }
+  }
+  CeedCall(CeedMalloc(num_comp_pairs * num_qpts * num_eval_in * num_eval_out, &D_mat));
+  CeedCall(CeedMalloc(num_comp_pairs * elem_size * num_qpts * num_eval_in, &BTD_mat));
+
   CeedCall(CeedVectorGetArray(values, CEED_MEM_HOST, &vals));
   for (CeedInt e = 0; e < num_elem; e++) {
+    // Gather D for this element as [comp_in][comp_out][qpt][eval_mode_in][eval_mode_out]
     for (CeedInt comp_in = 0; comp_in < num_comp; comp_in++) {
       for (CeedInt comp_out = 0; comp_out < num_comp; comp_out++) {
-        // Compute B^T*D
-        for (CeedInt n = 0; n < elem_size; n++) {
-          for (CeedInt q = 0; q < num_qpts; q++) {
-            for (CeedInt e_in = 0; e_in < num_eval_modes_in[0]; e_in++) {
-              const CeedInt btd_index = n * (num_qpts * num_eval_modes_in[0]) + (num_eval_modes_in[0] * q + e_in);
-              CeedScalar    sum       = 0.0;
-              for (CeedInt e_out = 0; e_out < num_eval_modes_out[0]; e_out++) {
-                const CeedInt b_out_index     = (num_eval_modes_out[0] * q + e_out) * elem_size + n;
-                const CeedInt eval_mode_index = ((e_in * num_comp + comp_in) * num_eval_modes_out[0] + e_out) * num_comp + comp_out;
-                const CeedInt qf_index        = q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2];
-                sum += B_mat_out[b_out_index] * assembled_qf_array[qf_index];
-              }
-              BTD_mat[btd_index] = sum;
+        CeedScalar *D_pair = &D_mat[(comp_in * num_comp + comp_out) * num_qpts * num_eval_in * num_eval_out];
+        for (CeedInt q = 0; q < num_qpts; q++) {
+          for (CeedInt e_in = 0; e_in < num_eval_in; e_in++) {
+            for (CeedInt e_out = 0; e_out < num_eval_out; e_out++) {
+              const CeedInt eval_mode_index = ((e_in * num_comp + comp_in) * num_eval_out + e_out) * num_comp + comp_out;
+              const CeedInt qf_index        = q * layout_qf[0] + eval_mode_index * layout_qf[1] + e * layout_qf[2];
+              D_pair[(q * num_eval_in + e_in) * num_eval_out + e_out] = assembled_qf_array[qf_index];
             }
           }
         }
-        // form element matrix itself (for each block component)
-        CeedCall(CeedMatrixMatrixMultiply(ceed, BTD_mat, B_mat_in, elem_mat, elem_size, elem_size, num_qpts * num_eval_modes_in[0]));
-
-        // put element matrix in coordinate data structure
-        for (CeedInt i = 0; i < elem_size; i++) {
-          for (CeedInt j = 0; j < elem_size; j++) {
-            vals[offset + count] = elem_mat[i * elem_size + j];
-            count++;
+      }
+    }
+    // Compute B^T*D for all component pairs
+    for (CeedInt pair = 0; pair < num_comp_pairs; pair++) {
+      const CeedScalar *D_pair   = &D_mat[pair * num_qpts * num_eval_in * num_eval_out];
+      CeedScalar       *BTD_pair = &BTD_mat[pair * elem_size * num_qpts * num_eval_in];
+      for (CeedInt n = 0; n < elem_size; n++) {
+        for (CeedInt q = 0; q < num_qpts; q++) {
+          const CeedScalar *B_out = &B_mat_out_t[(n * num_qpts + q) * num_eval_out];
+          for (CeedInt e_in = 0; e_in < num_eval_in; e_in++) {
+            const CeedScalar *D_q = &D_pair[(q * num_eval_in + e_in) * num_eval_out];
+            CeedScalar        sum = 0.0;
+            for (CeedInt e_out = 0; e_out < num_eval_out; e_out++) sum += B_out[e_out] * D_q[e_out];
+            BTD_pair[(n * num_qpts + q) * num_eval_in + e_in] = sum;
           }
         }
       }
     }
-  }
+    // Form element matrix blocks for all component pairs with one product
+    //   Rows are ordered [comp_in][comp_out][node], matching the coordinate data layout
+    CeedCall(
+        CeedMatrixMatrixMultiplyBlocked(BTD_mat, B_mat_in, &vals[offset + count], num_comp_pairs * elem_size, elem_size, num_qpts * num_eval_in));
+    count += num_comp_pairs * elem_size * elem_size;
+  }
+  CeedCall(CeedFree(&B_mat_out_t));
+  CeedCall(CeedFree(&D_mat));
+  CeedCall(CeedFree(&BTD_mat));
   if (count != local_num_entries) {
     // LCOV_EXCL_START
     return CeedError(ceed, CEED_ERROR_MAJOR, "Error computing entries");
@@ -698,6 +891,72 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedInt *num_
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get cached multigrid coarse operator and level transfer operators for a CeedOperator, if they were created for the same coarse grid
+
+  @param[in]  op_fine       Fine grid operator
+  @param[in]  p_mult_fine   L-vector multiplicity in parallel gather/scatter, or NULL if not creating prolongation/restriction operators
+  @param[in]  rstr_coarse   Coarse grid restriction
+  @param[in]  basis_coarse  Coarse grid active vector basis
+  @param[in]  interp_c_to_f Matrix for coarse to fine interpolation, or NULL if projecting between the coarse and fine bases
+  @param[out] op_coarse     Coarse grid operator
+  @param[out] op_prolong    Coarse to fine operator, or NULL
+  @param[out] op_restrict   Fine to coarse operator, or NULL
+  @param[out] is_cached     Boolean flag indicating if cached operators were returned
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedSingleOperatorMultigridLevelGetCached(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse,
+                                                     CeedBasis basis_coarse, const CeedScalar *interp_c_to_f, CeedOperator *op_coarse,
+                                                     CeedOperator *op_prolong, CeedOperator *op_restrict, bool *is_cached) {
+  *is_cached = false;
+  if (!op_fine->mg_op_coarse || op_fine->mg_rstr_coarse != rstr_coarse || op_fine->mg_basis_coarse != basis_coarse) return CEED_ERROR_SUCCESS;
+
+  // Check transfer operators
+  if (op_prolong || op_restrict) {
+    uint64_t p_mult_state;
+
+    if ((op_prolong && !op_fine->mg_op_prolong) || (op_restrict && !op_fine->mg_op_restrict)) return CEED_ERROR_SUCCESS;
+    if (!p_mult_fine || p_mult_fine != op_fine->mg_p_mult_fine) return CEED_ERROR_SUCCESS;
+    CeedCall(CeedVectorGetState(p_mult_fine, &p_mult_state));
+    if (p_mult_state != op_fine->mg_p_mult_state) return CEED_ERROR_SUCCESS;
+    if (!interp_c_to_f != op_fine->mg_is_projection) return CEED_ERROR_SUCCESS;
+    if (interp_c_to_f) {
+      bool              is_tensor;
+      CeedInt           P, Q;
+      const CeedScalar *interp;
+
+      CeedCall(CeedBasisIsTensor(op_fine->mg_basis_c_to_f, &is_tensor));
+      if (is_tensor) {
+        CeedCall(CeedBasisGetNumNodes1D(op_fine->mg_basis_c_to_f, &P));
+        CeedCall(CeedBasisGetNumQuadraturePoints1D(op_fine->mg_basis_c_to_f, &Q));
+        CeedCall(CeedBasisGetInterp1D(op_fine->mg_basis_c_to_f, &interp));
+      } else {
+        CeedCall(CeedBasisGetNumNodes(op_fine->mg_basis_c_to_f, &P));
+        CeedCall(CeedBasisGetNumQuadraturePoints(op_fine->mg_basis_c_to_f, &Q));
+        CeedCall(CeedBasisGetInterp(op_fine->mg_basis_c_to_f, &interp));
+      }
+      if (memcmp(interp, interp_c_to_f, P * Q * sizeof(CeedScalar))) return CEED_ERROR_SUCCESS;
+    }
+  }
+
+  // Copy references to cached operators
+  *op_coarse = NULL;
+  CeedCall(CeedOperatorReferenceCopy(op_fine->mg_op_coarse, op_coarse));
+  if (op_prolong) {
+    *op_prolong = NULL;
+    CeedCall(CeedOperatorReferenceCopy(op_fine->mg_op_prolong, op_prolong));
+  }
+  if (op_restrict) {
+    *op_restrict = NULL;
+    CeedCall(CeedOperatorReferenceCopy(op_fine->mg_op_restrict, op_restrict));
+  }
+  *is_cached = true;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Common code for creating a multigrid coarse operator and level transfer operators for a CeedOperator
 
@@ -705,17 +964,19 @@ static int CeedSingleOperatorAssemblyCountEntries(CeedOperator op, CeedInt *num_
   @param[in]  p_mult_fine  L-vector multiplicity in parallel gather/scatter, or NULL if not creating prolongation/restriction operators
   @param[in]  rstr_coarse  Coarse grid restriction
   @param[in]  basis_coarse Coarse grid active vector basis
-  @param[in]  basis_c_to_f Basis for coarse to fine interpolation, or NULL if not creating prolongation/restriction operators
-  @param[out] op_coarse    Coarse grid operator
-  @param[out] op_prolong   Coarse to fine operator, or NULL
-  @param[out] op_restrict  Fine to coarse operator, or NULL
+  @param[in]  basis_c_to_f  Basis for coarse to fine interpolation, or NULL if not creating prolongation/restriction operators
+  @param[in]  is_projection Boolean flag indicating if the coarse to fine basis is a projection between the coarse and fine bases
+  @param[out] op_coarse     Coarse grid operator
+  @param[out] op_prolong    Coarse to fine operator, or NULL
+  @param[out] op_restrict   Fine to coarse operator, or NULL
 
   @return An error code: 0 - success, otherwise - failure
 
   @ref Developer
 **/
 static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_mult_fine, CeedElemRestriction rstr_coarse, CeedBasis basis_coarse,
-                                            CeedBasis basis_c_to_f, CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
+                                            CeedBasis basis_c_to_f, bool is_projection, CeedOperator *op_coarse, CeedOperator *op_prolong,
+                                            CeedOperator *op_restrict) {
   Ceed       ceed;
   CeedVector mult_vec = NULL;
   CeedCall(CeedOperatorGetCeed(op_fine, &ceed));
@@ -731,6 +992,7 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
 
   // Coarse Grid
   CeedCall(CeedOperatorCreate(ceed, op_fine->qf, op_fine->dqf, op_fine->dqfT, op_coarse));
+  CeedCall(CeedOperatorSetPrecision(*op_coarse, op_fine->precision));
   CeedElemRestriction rstr_fine = NULL;
   // -- Clone input fields
   for (CeedInt i = 0; i < op_fine->qf->num_input_fields; i++) {
@@ -865,6 +1127,21 @@ static int CeedSingleOperatorMultigridLevel(CeedOperator op_fine, CeedVector p_m
   // Check
   CeedCall(CeedOperatorCheckReady(*op_coarse));
 
+  // Cache level for reuse by later calls with the same coarse grid
+  if (p_mult_fine) CeedCall(CeedVectorGetState(p_mult_fine, &op_fine->mg_p_mult_state));
+  CeedCall(CeedVectorDestroy(&op_fine->mg_p_mult_fine));
+  if (p_mult_fine) CeedCall(CeedVectorReferenceCopy(p_mult_fine, &op_fine->mg_p_mult_fine));
+  CeedCall(CeedElemRestrictionReferenceCopy(rstr_coarse, &op_fine->mg_rstr_coarse));
+  CeedCall(CeedBasisReferenceCopy(basis_coarse, &op_fine->mg_basis_coarse));
+  CeedCall(CeedBasisDestroy(&op_fine->mg_basis_c_to_f));
+  if (basis_c_to_f) CeedCall(CeedBasisReferenceCopy(basis_c_to_f, &op_fine->mg_basis_c_to_f));
+  op_fine->mg_is_projection = is_projection;
+  CeedCall(CeedOperatorReferenceCopy(*op_coarse, &op_fine->mg_op_coarse));
+  CeedCall(CeedOperatorDestroy(&op_fine->mg_op_prolong));
+  if (op_prolong) CeedCall(CeedOperatorReferenceCopy(*op_prolong, &op_fine->mg_op_prolong));
+  CeedCall(CeedOperatorDestroy(&op_fine->mg_op_restrict));
+  if (op_restrict) CeedCall(CeedOperatorReferenceCopy(*op_restrict, &op_fine->mg_op_restrict));
+
   // Cleanup
   CeedCall(CeedVectorDestroy(&mult_vec));
   CeedCall(CeedBasisDestroy(&basis_c_to_f));
@@ -1485,6 +1762,34 @@ int CeedOperatorAssemblyDataGetElemRestrictions(CeedOperatorAssemblyData data, C
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get CeedOperator point block CeedElemRestriction data for assembly.
+
+  The point block restrictions are created on first use and cached with the CeedOperatorAssemblyData, so repeated point block diagonal assembly
+    does not rebuild them.
+
+  @param[in]  data                              CeedOperatorAssemblyData
+  @param[out] num_active_point_block_elem_rstrs Number of active point block element restrictions, or NULL
+  @param[out] active_point_block_elem_rstrs     Pointer to hold active point block CeedElemRestrictions, or NULL
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedOperatorAssemblyDataGetPointBlockElemRestrictions(CeedOperatorAssemblyData data, CeedInt *num_active_point_block_elem_rstrs,
+                                                          CeedElemRestriction **active_point_block_elem_rstrs) {
+  if (!data->active_point_block_elem_rstrs) {
+    CeedCall(CeedCalloc(data->num_active_bases, &data->active_point_block_elem_rstrs));
+    for (CeedInt b = 0; b < data->num_active_bases; b++) {
+      CeedCall(CeedOperatorCreateActivePointBlockRestriction(data->active_elem_rstrs[b], &data->active_point_block_elem_rstrs[b]));
+    }
+  }
+  if (num_active_point_block_elem_rstrs) *num_active_point_block_elem_rstrs = data->num_active_bases;
+  if (active_point_block_elem_rstrs) *active_point_block_elem_rstrs = data->active_point_block_elem_rstrs;
+
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Destroy CeedOperatorAssemblyData
 
@@ -1503,15 +1808,18 @@ int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data) {
   for (CeedInt b = 0; b < (*data)->num_active_bases; b++) {
     CeedCall(CeedBasisDestroy(&(*data)->active_bases[b]));
     CeedCall(CeedElemRestrictionDestroy(&(*data)->active_elem_rstrs[b]));
+    if ((*data)->active_point_block_elem_rstrs) CeedCall(CeedElemRestrictionDestroy(&(*data)->active_point_block_elem_rstrs[b]));
     CeedCall(CeedFree(&(*data)->eval_modes_in[b]));
     CeedCall(CeedFree(&(*data)->eval_modes_out[b]));
     CeedCall(CeedFree(&(*data)->eval_mode_offsets_in[b]));
     CeedCall(CeedFree(&(*data)->eval_mode_offsets_out[b]));
     CeedCall(CeedFree(&(*data)->assembled_bases_in[b]));
     CeedCall(CeedFree(&(*data)->assembled_bases_out[b]));
+    if ((*data)->diag_identities) CeedCall(CeedFree(&(*data)->diag_identities[b]));
   }
   CeedCall(CeedFree(&(*data)->active_bases));
   CeedCall(CeedFree(&(*data)->active_elem_rstrs));
+  CeedCall(CeedFree(&(*data)->active_point_block_elem_rstrs));
   CeedCall(CeedFree(&(*data)->num_eval_modes_in));
   CeedCall(CeedFree(&(*data)->num_eval_modes_out));
   CeedCall(CeedFree(&(*data)->eval_modes_in));
@@ -1520,6 +1828,7 @@ int CeedOperatorAssemblyDataDestroy(CeedOperatorAssemblyData *data) {
   CeedCall(CeedFree(&(*data)->eval_mode_offsets_out));
   CeedCall(CeedFree(&(*data)->assembled_bases_in));
   CeedCall(CeedFree(&(*data)->assembled_bases_out));
+  CeedCall(CeedFree(&(*data)->diag_identities));
 
   CeedCall(CeedFree(data));
   return CEED_ERROR_SUCCESS;
@@ -1555,24 +1864,28 @@ and producing the output [dv_0, dv_1, v].
   @ref User
 **/
 int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  CeedProfileTimer timer;
+
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_QFUNCTION, &timer));
 
   if (op->LinearAssembleQFunction) {
     // Backend version
-    CeedCall(op->LinearAssembleQFunction(op, assembled, rstr, request));
+    CeedProfileCall(&timer, op->LinearAssembleQFunction(op, assembled, rstr, request));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssembleQFunction(op_fallback, assembled, rstr, request));
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleQFunction(op_fallback, assembled, rstr, request));
     } else {
       // LCOV_EXCL_START
-      return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunction");
+      CeedProfileCall(&timer, CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunction"));
       // LCOV_EXCL_STOP
     }
   }
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1592,50 +1905,61 @@ int CeedOperatorLinearAssembleQFunction(CeedOperator op, CeedVector *assembled,
   @ref User
 **/
 int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector *assembled, CeedElemRestriction *rstr, CeedRequest *request) {
+  CeedProfileTimer timer;
+
   CeedCall(CeedOperatorCheckReady(op));
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_QFUNCTION, &timer));
 
   if (op->LinearAssembleQFunctionUpdate) {
     // Backend version
     bool                qf_assembled_is_setup;
+    uint64_t            ctx_state      = 0;
     CeedVector          assembled_vec  = NULL;
     CeedElemRestriction assembled_rstr = NULL;
 
-    CeedCall(CeedQFunctionAssemblyDataIsSetup(op->qf_assembled, &qf_assembled_is_setup));
+    // Only user changes to the CeedQFunctionContext, not backend access while applying the CeedQFunction, invalidate reused data
+    if (op->qf && op->qf->ctx) ctx_state = op->qf->ctx->state - op->qf->ctx->backend_state;
+    CeedProfileCall(&timer, CeedQFunctionAssemblyDataIsSetup(op->qf_assembled, &qf_assembled_is_setup));
     if (qf_assembled_is_setup) {
       bool update_needed;
 
-      CeedCall(CeedQFunctionAssemblyDataGetObjects(op->qf_assembled, &assembled_vec, &assembled_rstr));
-      CeedCall(CeedQFunctionAssemblyDataIsUpdateNeeded(op->qf_assembled, &update_needed));
+      // Reused data is stale if the CeedQFunctionContext changed since the last assembly
+      if (ctx_state != op->qf_assembled->ctx_state) CeedProfileCall(&timer, CeedQFunctionAssemblyDataSetUpdateNeeded(op->qf_assembled, true));
+      CeedProfileCall(&timer, CeedQFunctionAssemblyDataGetObjects(op->qf_assembled, &assembled_vec, &assembled_rstr));
+      CeedProfileCall(&timer, CeedQFunctionAssemblyDataIsUpdateNeeded(op->qf_assembled, &update_needed));
       if (update_needed) {
-        CeedCall(op->LinearAssembleQFunctionUpdate(op, assembled_vec, assembled_rstr, request));
+        CeedProfileCall(&timer, op->LinearAssembleQFunctionUpdate(op, assembled_vec, assembled_rstr, request));
       }
     } else {
-      CeedCall(op->LinearAssembleQFunction(op, &assembled_vec, &assembled_rstr, request));
-      CeedCall(CeedQFunctionAssemblyDataSetObjects(op->qf_assembled, assembled_vec, assembled_rstr));
+      CeedProfileCall(&timer, op->LinearAssembleQFunction(op, &assembled_vec, &assembled_rstr, request));
+      CeedProfileCall(&timer, CeedQFunctionAssemblyDataSetObjects(op->qf_assembled, assembled_vec, assembled_rstr));
     }
-    CeedCall(CeedQFunctionAssemblyDataSetUpdateNeeded(op->qf_assembled, false));
+    CeedProfileCall(&timer, CeedQFunctionAssemblyDataSetUpdateNeeded(op->qf_assembled, false));
+    if (op->qf && op->qf->ctx) ctx_state = op->qf->ctx->state - op->qf->ctx->backend_state;
+    op->qf_assembled->ctx_state = ctx_state;
 
     // Copy reference from internally held copy
     *assembled = NULL;
     *rstr      = NULL;
-    CeedCall(CeedVectorReferenceCopy(assembled_vec, assembled));
-    CeedCall(CeedVectorDestroy(&assembled_vec));
-    CeedCall(CeedElemRestrictionReferenceCopy(assembled_rstr, rstr));
-    CeedCall(CeedElemRestrictionDestroy(&assembled_rstr));
+    CeedProfileCall(&timer, CeedVectorReferenceCopy(assembled_vec, assembled));
+    CeedProfileCall(&timer, CeedVectorDestroy(&assembled_vec));
+    CeedProfileCall(&timer, CeedElemRestrictionReferenceCopy(assembled_rstr, rstr));
+    CeedProfileCall(&timer, CeedElemRestrictionDestroy(&assembled_rstr));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_fallback, assembled, rstr, request));
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleQFunctionBuildOrUpdate(op_fallback, assembled, rstr, request));
     } else {
       // LCOV_EXCL_START
-      return CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunctionUpdate");
+      CeedProfileCall(&timer, CeedError(op->ceed, CEED_ERROR_UNSUPPORTED, "Backend does not support CeedOperatorLinearAssembleQFunctionUpdate"));
       // LCOV_EXCL_STOP
     }
   }
 
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1657,7 +1981,8 @@ int CeedOperatorLinearAssembleQFunctionBuildOrUpdate(CeedOperator op, CeedVector
   @ref User
 **/
 int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool is_composite;
+  CeedProfileTimer timer;
+  bool             is_composite;
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -1677,29 +2002,28 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL, &timer));
   if (op->LinearAssembleDiagonal) {
     // Backend version
-    CeedCall(op->LinearAssembleDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, op->LinearAssembleDiagonal(op, assembled, request));
   } else if (op->LinearAssembleAddDiagonal) {
     // Backend version with zeroing first
-    CeedCall(CeedVectorSetValue(assembled, 0.0));
-    CeedCall(op->LinearAssembleAddDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, CeedVectorSetValue(assembled, 0.0));
+    CeedProfileCall(&timer, op->LinearAssembleAddDiagonal(op, assembled, request));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssembleDiagonal(op_fallback, assembled, request));
-      return CEED_ERROR_SUCCESS;
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleDiagonal(op_fallback, assembled, request));
+    } else {
+      // Default interface implementation
+      CeedProfileCall(&timer, CeedVectorSetValue(assembled, 0.0));
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleAddDiagonal(op, assembled, request));
     }
   }
-  // Default interface implementation
-  CeedCall(CeedVectorSetValue(assembled, 0.0));
-  CeedCall(CeedOperatorLinearAssembleAddDiagonal(op, assembled, request));
-
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1721,7 +2045,8 @@ int CeedOperatorLinearAssembleDiagonal(CeedOperator op, CeedVector assembled, Ce
   @ref User
 **/
 int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool is_composite;
+  CeedProfileTimer timer;
+  bool             is_composite;
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -1741,27 +2066,27 @@ int CeedOperatorLinearAssembleAddDiagonal(CeedOperator op, CeedVector assembled,
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL, &timer));
   if (op->LinearAssembleAddDiagonal) {
     // Backend version
-    CeedCall(op->LinearAssembleAddDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, op->LinearAssembleAddDiagonal(op, assembled, request));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssembleAddDiagonal(op_fallback, assembled, request));
-      return CEED_ERROR_SUCCESS;
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleAddDiagonal(op_fallback, assembled, request));
+    } else {
+      // Default interface implementation
+      if (is_composite) {
+        CeedProfileCall(&timer, CeedCompositeOperatorLinearAssembleAddDiagonal(op, request, false, assembled));
+      } else {
+        CeedProfileCall(&timer, CeedSingleOperatorAssembleAddDiagonal_Core(op, request, false, assembled));
+      }
     }
   }
-  // Default interface implementation
-  if (is_composite) {
-    CeedCall(CeedCompositeOperatorLinearAssembleAddDiagonal(op, request, false, assembled));
-  } else {
-    CeedCall(CeedSingleOperatorAssembleAddDiagonal_Core(op, request, false, assembled));
-  }
-
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1785,7 +2110,8 @@ component in].
   @ref User
 **/
 int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool is_composite;
+  CeedProfileTimer timer;
+  bool             is_composite;
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -1805,29 +2131,28 @@ int CeedOperatorLinearAssemblePointBlockDiagonal(CeedOperator op, CeedVector ass
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL, &timer));
   if (op->LinearAssemblePointBlockDiagonal) {
     // Backend version
-    CeedCall(op->LinearAssemblePointBlockDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, op->LinearAssemblePointBlockDiagonal(op, assembled, request));
   } else if (op->LinearAssembleAddPointBlockDiagonal) {
     // Backend version with zeroing first
-    CeedCall(CeedVectorSetValue(assembled, 0.0));
-    CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, CeedVectorSetValue(assembled, 0.0));
+    CeedProfileCall(&timer, CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssemblePointBlockDiagonal(op_fallback, assembled, request));
-      return CEED_ERROR_SUCCESS;
+      CeedProfileCall(&timer, CeedOperatorLinearAssemblePointBlockDiagonal(op_fallback, assembled, request));
+    } else {
+      // Default interface implementation
+      CeedProfileCall(&timer, CeedVectorSetValue(assembled, 0.0));
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
     }
   }
-  // Default interface implementation
-  CeedCall(CeedVectorSetValue(assembled, 0.0));
-  CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op, assembled, request));
-
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1851,7 +2176,8 @@ component in].
   @ref User
 **/
 int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector assembled, CeedRequest *request) {
-  bool is_composite;
+  CeedProfileTimer timer;
+  bool             is_composite;
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -1871,27 +2197,27 @@ int CeedOperatorLinearAssembleAddPointBlockDiagonal(CeedOperator op, CeedVector
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL, &timer));
   if (op->LinearAssembleAddPointBlockDiagonal) {
     // Backend version
-    CeedCall(op->LinearAssembleAddPointBlockDiagonal(op, assembled, request));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, op->LinearAssembleAddPointBlockDiagonal(op, assembled, request));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssembleAddPointBlockDiagonal(op_fallback, assembled, request));
-      return CEED_ERROR_SUCCESS;
+      CeedProfileCall(&timer, CeedOperatorLinearAssembleAddPointBlockDiagonal(op_fallback, assembled, request));
+    } else {
+      // Default interface implementation
+      if (is_composite) {
+        CeedProfileCall(&timer, CeedCompositeOperatorLinearAssembleAddDiagonal(op, request, true, assembled));
+      } else {
+        CeedProfileCall(&timer, CeedSingleOperatorAssembleAddDiagonal_Core(op, request, true, assembled));
+      }
     }
   }
-  // Default interface implementation
-  if (is_composite) {
-    CeedCall(CeedCompositeOperatorLinearAssembleAddDiagonal(op, request, true, assembled));
-  } else {
-    CeedCall(CeedSingleOperatorAssembleAddDiagonal_Core(op, request, true, assembled));
-  }
-
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -1991,9 +2317,10 @@ their (i, j) locations are provided by CeedOperatorLinearAssembleSymbolic()
    @ref User
 **/
 int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
-  CeedInt       num_suboperators, single_entries = 0;
-  CeedOperator *sub_operators;
-  bool          is_composite;
+  CeedProfileTimer timer;
+  CeedInt          num_suboperators, single_entries = 0;
+  CeedOperator    *sub_operators;
+  bool             is_composite;
   CeedCall(CeedOperatorCheckReady(op));
   CeedCall(CeedOperatorIsComposite(op, &is_composite));
 
@@ -2005,36 +2332,35 @@ int CeedOperatorLinearAssemble(CeedOperator op, CeedVector values) {
     if (num_elem == 0) return CEED_ERROR_SUCCESS;
   }
 
+  CeedCall(CeedProfileBegin(op->ceed, op, CEED_PROFILE_PHASE_ASSEMBLE, &timer));
   if (op->LinearAssemble) {
     // Backend version
-    CeedCall(op->LinearAssemble(op, values));
-    return CEED_ERROR_SUCCESS;
+    CeedProfileCall(&timer, op->LinearAssemble(op, values));
   } else {
     // Operator fallback
     CeedOperator op_fallback;
 
-    CeedCall(CeedOperatorGetFallback(op, &op_fallback));
+    CeedProfileCall(&timer, CeedOperatorGetFallback(op, &op_fallback));
     if (op_fallback) {
-      CeedCall(CeedOperatorLinearAssemble(op_fallback, values));
-      return CEED_ERROR_SUCCESS;
-    }
-  }
-
-  // Default interface implementation
-  CeedInt offset = 0;
-  CeedCall(CeedVectorSetValue(values, 0.0));
-  if (is_composite) {
-    CeedCall(CeedCompositeOperatorGetNumSub(op, &num_suboperators));
-    CeedCall(CeedCompositeOperatorGetSubList(op, &sub_operators));
-    for (CeedInt k = 0; k < num_suboperators; k++) {
-      CeedCall(CeedSingleOperatorAssemble(sub_operators[k], offset, values));
-      CeedCall(CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
-      offset += single_entries;
+      CeedProfileCall(&timer, CeedOperatorLinearAssemble(op_fallback, values));
+    } else {
+      // Default interface implementation
+      CeedInt offset = 0;
+      CeedProfileCall(&timer, CeedVectorSetValue(values, 0.0));
+      if (is_composite) {
+        CeedProfileCall(&timer, CeedCompositeOperatorGetNumSub(op, &num_suboperators));
+        CeedProfileCall(&timer, CeedCompositeOperatorGetSubList(op, &sub_operators));
+        for (CeedInt k = 0; k < num_suboperators; k++) {
+          CeedProfileCall(&timer, CeedSingleOperatorAssemble(sub_operators[k], offset, values));
+          CeedProfileCall(&timer, CeedSingleOperatorAssemblyCountEntries(sub_operators[k], &single_entries));
+          offset += single_entries;
+        }
+      } else {
+        CeedProfileCall(&timer, CeedSingleOperatorAssemble(op, offset, values));
+      }
     }
-  } else {
-    CeedCall(CeedSingleOperatorAssemble(op, offset, values));
   }
-
+  CeedCall(CeedProfileEnd(&timer, 0, 0));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2115,6 +2441,9 @@ int CeedCompositeOperatorGetMultiplicity(CeedOperator op, CeedInt num_skip_indic
 grid interpolation
 
   Note: Calling this function asserts that setup is complete and sets all four CeedOperators as immutable.
+    The level is cached on the fine grid operator, so later calls with the same coarse grid restriction and basis return references to the same
+coarse grid and level transfer operators without rebuilding them.
+    Use @ref CeedOperatorSetQFunctionAssemblyReuse() on the fine grid operator to share one CeedQFunction assembly across all levels.
 
   @param[in]  op_fine      Fine grid operator
   @param[in]  p_mult_fine  L-vector multiplicity in parallel gather/scatter, or NULL if not creating prolongation/restriction operators
@@ -2132,16 +2461,28 @@ int CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fin
                                      CeedOperator *op_coarse, CeedOperator *op_prolong, CeedOperator *op_restrict) {
   CeedCall(CeedOperatorCheckReady(op_fine));
 
+  // Check for cached level
+  bool is_cached;
+  CeedCall(CeedSingleOperatorMultigridLevelGetCached(op_fine, p_mult_fine, rstr_coarse, basis_coarse, NULL, op_coarse, op_prolong, op_restrict,
+                                                     &is_cached));
+  if (is_cached) return CEED_ERROR_SUCCESS;
+
   // Build prolongation matrix, if required
   CeedBasis basis_c_to_f = NULL;
   if (op_prolong || op_restrict) {
-    CeedBasis basis_fine;
-    CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
-    CeedCall(CeedBasisCreateProjection(basis_coarse, basis_fine, &basis_c_to_f));
+    if (op_fine->mg_is_projection && op_fine->mg_basis_coarse == basis_coarse && op_fine->mg_basis_c_to_f) {
+      // Reuse cached projection
+      CeedCall(CeedBasisReferenceCopy(op_fine->mg_basis_c_to_f, &basis_c_to_f));
+    } else {
+      CeedBasis basis_fine;
+      CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
+      CeedCall(CeedBasisCreateProjection(basis_coarse, basis_fine, &basis_c_to_f));
+    }
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(
+      CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, true, op_coarse, op_prolong, op_restrict));
 
   return CEED_ERROR_SUCCESS;
 }
@@ -2150,6 +2491,9 @@ int CeedOperatorMultigridLevelCreate(CeedOperator op_fine, CeedVector p_mult_fin
   @brief Create a multigrid coarse operator and level transfer operators for a CeedOperator with a tensor basis for the active basis
 
   Note: Calling this function asserts that setup is complete and sets all four CeedOperators as immutable.
+    The level is cached on the fine grid operator, so later calls with the same coarse grid restriction and basis return references to the same
+coarse grid and level transfer operators without rebuilding them.
+    Use @ref CeedOperatorSetQFunctionAssemblyReuse() on the fine grid operator to share one CeedQFunction assembly across all levels.
 
   @param[in]  op_fine       Fine grid operator
   @param[in]  p_mult_fine   L-vector multiplicity in parallel gather/scatter, or NULL if not creating prolongation/restriction operators
@@ -2171,6 +2515,12 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
   Ceed ceed;
   CeedCall(CeedOperatorGetCeed(op_fine, &ceed));
 
+  // Check for cached level
+  bool is_cached;
+  CeedCall(CeedSingleOperatorMultigridLevelGetCached(op_fine, p_mult_fine, rstr_coarse, basis_coarse, interp_c_to_f, op_coarse, op_prolong,
+                                                     op_restrict, &is_cached));
+  if (is_cached) return CEED_ERROR_SUCCESS;
+
   // Check for compatible quadrature spaces
   CeedBasis basis_fine;
   CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
@@ -2209,7 +2559,8 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(
+      CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, false, op_coarse, op_prolong, op_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2217,6 +2568,9 @@ int CeedOperatorMultigridLevelCreateTensorH1(CeedOperator op_fine, CeedVector p_
   @brief Create a multigrid coarse operator and level transfer operators for a CeedOperator with a non-tensor basis for the active vector
 
   Note: Calling this function asserts that setup is complete and sets all four CeedOperators as immutable.
+    The level is cached on the fine grid operator, so later calls with the same coarse grid restriction and basis return references to the same
+coarse grid and level transfer operators without rebuilding them.
+    Use @ref CeedOperatorSetQFunctionAssemblyReuse() on the fine grid operator to share one CeedQFunction assembly across all levels.
 
   @param[in]  op_fine       Fine grid operator
   @param[in]  p_mult_fine   L-vector multiplicity in parallel gather/scatter, or NULL if not creating prolongation/restriction operators
@@ -2238,6 +2592,12 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   Ceed ceed;
   CeedCall(CeedOperatorGetCeed(op_fine, &ceed));
 
+  // Check for cached level
+  bool is_cached;
+  CeedCall(CeedSingleOperatorMultigridLevelGetCached(op_fine, p_mult_fine, rstr_coarse, basis_coarse, interp_c_to_f, op_coarse, op_prolong,
+                                                     op_restrict, &is_cached));
+  if (is_cached) return CEED_ERROR_SUCCESS;
+
   // Check for compatible quadrature spaces
   CeedBasis basis_fine;
   CeedCall(CeedOperatorGetActiveBasis(op_fine, &basis_fine));
@@ -2277,7 +2637,8 @@ int CeedOperatorMultigridLevelCreateH1(CeedOperator op_fine, CeedVector p_mult_f
   }
 
   // Core code
-  CeedCall(CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, op_coarse, op_prolong, op_restrict));
+  CeedCall(
+      CeedSingleOperatorMultigridLevel(op_fine, p_mult_fine, rstr_coarse, basis_coarse, basis_c_to_f, false, op_coarse, op_prolong, op_restrict));
   return CEED_ERROR_SUCCESS;
 }
 
@@ -2407,7 +2768,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedScalar       *elem_avg;
   const CeedScalar *assembled_array, *q_weight_array;
   CeedVector        q_weight;
-  CeedCall(CeedVectorCreate(ceed_parent, num_qpts, &q_weight));
+  CeedCall(CeedGetWorkVector(ceed_parent, num_qpts, &q_weight));
   CeedCall(CeedBasisApply(basis, 1, CEED_NOTRANSPOSE, CEED_EVAL_WEIGHT, CEED_VECTOR_NONE, q_weight));
   CeedCall(CeedVectorGetArrayRead(assembled, CEED_MEM_HOST, &assembled_array));
   CeedCall(CeedVectorGetArrayRead(q_weight, CEED_MEM_HOST, &q_weight_array));
@@ -2432,7 +2793,7 @@ int CeedOperatorCreateFDMElementInverse(CeedOperator op, CeedOperator *fdm_inv,
   CeedCall(CeedVectorRestoreArrayRead(assembled, &assembled_array));
   CeedCall(CeedVectorDestroy(&assembled));
   CeedCall(CeedVectorRestoreArrayRead(q_weight, &q_weight_array));
-  CeedCall(CeedVectorDestroy(&q_weight));
+  CeedCall(CeedRestoreWorkVector(ceed_parent, &q_weight));
 
   // Build FDM diagonal
   CeedVector  q_data;
@@ -0,0 +1,497 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 199309L
+#include <ceed-impl.h>
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/// @file
+/// Implementation of timing and counter instrumentation for CeedOperator application and assembly
+
+/// @cond DOXYGEN_SKIP
+static const char *const CeedProfilePhases[CEED_PROFILE_NUM_PHASES] = {
+    [CEED_PROFILE_PHASE_APPLY]              = "apply",
+    [CEED_PROFILE_PHASE_RESTRICT_IN]        = "restrict in",
+    [CEED_PROFILE_PHASE_RESTRICT_OUT]       = "restrict out",
+    [CEED_PROFILE_PHASE_BASIS]              = "basis",
+    [CEED_PROFILE_PHASE_QFUNCTION]          = "qfunction",
+    [CEED_PROFILE_PHASE_ASSEMBLE_QFUNCTION] = "assemble qfunction",
+    [CEED_PROFILE_PHASE_ASSEMBLE_DIAGONAL]  = "assemble diagonal",
+    [CEED_PROFILE_PHASE_ASSEMBLE]           = "assemble",
+};
+static const char CeedProfileUnnamed[] = "(unnamed)", CeedProfileNoOperator[] = "(no operator)";
+/// @endcond
+
+/// ----------------------------------------------------------------------------
+/// CeedProfile Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedDeveloper
+/// @{
+
+/**
+  @brief Get the Ceed that owns the profiling data for a Ceed and its delegates
+
+  @param[in]  ceed      Ceed context
+  @param[out] root_ceed Variable to store the root Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileGetCeed(Ceed ceed, Ceed *root_ceed) {
+  *root_ceed = ceed;
+  while ((*root_ceed)->parent || (*root_ceed)->op_fallback_parent) {
+    *root_ceed = (*root_ceed)->parent ? (*root_ceed)->parent : (*root_ceed)->op_fallback_parent;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get monotonic wall clock time in seconds
+
+  @return Wall clock time
+
+  @ref Developer
+**/
+static double CeedProfileWallTime(void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+/**
+  @brief Get the index of the profiling entry with a given name, adding it if needed
+
+  @param[in,out] profile CeedProfile
+  @param[in]     name    Entry name
+  @param[out]    entry   Variable to store entry index
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedProfileGetEntry(CeedProfile profile, const char *name, CeedInt *entry) {
+  for (*entry = 0; *entry < profile->num_entries; (*entry)++) {
+    if (!strcmp(profile->entries[*entry].name, name)) return CEED_ERROR_SUCCESS;
+  }
+  CeedCall(CeedRealloc(profile->num_entries + 1, &profile->entries));
+  memset(&profile->entries[*entry], 0, sizeof(profile->entries[*entry]));
+  CeedCall(CeedStringAllocCopy(name, &profile->entries[*entry].name));
+  profile->num_entries++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write a JSON string with escaped characters
+
+  @param[in] str    String to write
+  @param[in] stream Filestream to write to
+
+  @ref Developer
+**/
+static void CeedProfileWriteJSONString(const char *str, FILE *stream) {
+  fputc('"', stream);
+  for (const char *c = str; *c; c++) {
+    if (*c == '"' || *c == '\\') fputc('\\', stream);
+    if ((unsigned char)*c < 0x20) fprintf(stream, "\\u%04x", (unsigned char)*c);
+    else fputc(*c, stream);
+  }
+  fputc('"', stream);
+}
+
+/**
+  @brief Start timing a phase of CeedOperator application or assembly
+
+  If @a op is not NULL, the phase and all phases nested inside it are recorded for the name of @a op, set with CeedOperatorSetName().
+  Otherwise, the phase is recorded for the innermost CeedOperator being profiled.
+  Nested calls for the same phase and CeedOperator are only counted once.
+  Phases are not recorded while profiling is suspended with CeedProfileSuspend().
+  Calls between CeedProfileBegin() and CeedProfileEnd() should use CeedProfileCall() so that the timer is stopped on error.
+
+  @param[in]  ceed  Ceed context
+  @param[in]  op    CeedOperator starting the phase, or NULL for phases inside a CeedOperator
+  @param[in]  phase Phase to time
+  @param[out] timer Timer to pass to CeedProfileEnd()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileBegin(Ceed ceed, CeedOperator op, CeedProfilePhase phase, CeedProfileTimer *timer) {
+  CeedProfile       profile;
+  CeedProfileStage *stage;
+
+  timer->profile   = NULL;
+  timer->is_active = false;
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  profile = ceed->profile;
+  if (!profile || profile->format == CEED_PROFILE_NONE || profile->num_suspended > 0) return CEED_ERROR_SUCCESS;
+
+  timer->profile    = profile;
+  timer->phase      = phase;
+  timer->prev_entry = profile->current;
+  if (op) {
+    CeedCall(CeedProfileGetEntry(profile, op->name ? op->name : CeedProfileUnnamed, &timer->entry));
+    profile->current = timer->entry;
+  } else if (profile->current >= 0) {
+    timer->entry = profile->current;
+  } else {
+    CeedCall(CeedProfileGetEntry(profile, CeedProfileNoOperator, &timer->entry));
+  }
+
+  stage = &profile->entries[timer->entry].stages[phase];
+  if (stage->is_running) return CEED_ERROR_SUCCESS;
+  stage->is_running = true;
+  timer->is_active  = true;
+  timer->start      = CeedProfileWallTime();
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop timing a phase of CeedOperator application or assembly
+
+  @param[in,out] timer Timer from CeedProfileBegin()
+  @param[in]     flops Estimated floating point operations performed in the phase
+  @param[in]     bytes Estimated bytes moved to and from memory in the phase
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileEnd(CeedProfileTimer *timer, CeedSize flops, CeedSize bytes) {
+  if (!timer->profile) return CEED_ERROR_SUCCESS;
+  if (timer->is_active) {
+    CeedProfileStage *stage = &timer->profile->entries[timer->entry].stages[timer->phase];
+
+    stage->time += CeedProfileWallTime() - timer->start;
+    stage->num_calls++;
+    stage->flops += flops;
+    stage->bytes += bytes;
+    stage->is_running = false;
+    timer->is_active  = false;
+  }
+  timer->profile->current = timer->prev_entry;
+  timer->profile          = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop timing a phase of CeedOperator application or assembly that failed, without recording it
+
+  @param[in,out] timer Timer from CeedProfileBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileAbort(CeedProfileTimer *timer) {
+  if (!timer->profile) return CEED_ERROR_SUCCESS;
+  if (timer->is_active) {
+    timer->profile->entries[timer->entry].stages[timer->phase].is_running = false;
+    timer->is_active                                                      = false;
+  }
+  timer->profile->current = timer->prev_entry;
+  timer->profile          = NULL;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop timing a CeedElemRestriction application
+
+  Memory traffic is estimated as a read and write of each E-vector entry for restriction and an additional read of each L-vector entry for the
+    transpose, plus the offsets.
+
+  @param[in]     rstr    CeedElemRestriction applied
+  @param[in]     num_blk Number of blocks applied
+  @param[in,out] timer   Timer from CeedProfileBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileEndElemRestriction(CeedElemRestriction rstr, CeedInt num_blk, CeedProfileTimer *timer) {
+  bool              is_strided;
+  CeedSize          flops, e_size = (CeedSize)num_blk * rstr->blk_size * rstr->elem_size * rstr->num_comp;
+  CeedTransposeMode t_mode        = timer->phase == CEED_PROFILE_PHASE_RESTRICT_OUT ? CEED_TRANSPOSE : CEED_NOTRANSPOSE;
+
+  if (!timer->is_active) return CeedProfileEnd(timer, 0, 0);
+  CeedCall(CeedElemRestrictionGetFlopsEstimate(rstr, t_mode, &flops));
+  if (rstr->num_blk) flops = flops / rstr->num_blk * num_blk;
+  CeedCall(CeedElemRestrictionIsStrided(rstr, &is_strided));
+  CeedCall(CeedProfileEnd(timer, flops,
+                          e_size * (t_mode == CEED_TRANSPOSE ? 3 : 2) * sizeof(CeedScalar) +
+                              (is_strided ? 0 : (CeedSize)num_blk * rstr->blk_size * rstr->elem_size * sizeof(CeedInt))));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop timing a CeedBasis application
+
+  Memory traffic is estimated as a read or write of the element and quadrature point values.
+
+  @param[in]     basis     CeedBasis applied
+  @param[in]     num_elem  Number of elements applied
+  @param[in]     t_mode    Transpose mode applied
+  @param[in]     eval_mode Evaluation mode applied
+  @param[in,out] timer     Timer from CeedProfileBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileEndBasis(CeedBasis basis, CeedInt num_elem, CeedTransposeMode t_mode, CeedEvalMode eval_mode, CeedProfileTimer *timer) {
+  CeedInt  dim, num_comp, num_nodes, num_qpts, q_comp;
+  CeedSize flops, e_size = 0, q_size = 0;
+
+  if (!timer->is_active) return CeedProfileEnd(timer, 0, 0);
+  CeedCall(CeedBasisGetFlopsEstimate(basis, t_mode, eval_mode, &flops));
+  CeedCall(CeedBasisGetDimension(basis, &dim));
+  CeedCall(CeedBasisGetNumComponents(basis, &num_comp));
+  CeedCall(CeedBasisGetNumNodes(basis, &num_nodes));
+  CeedCall(CeedBasisGetNumQuadraturePoints(basis, &num_qpts));
+  CeedCall(CeedBasisGetNumQuadratureComponents(basis, &q_comp));
+  switch (eval_mode) {
+    case CEED_EVAL_NONE:
+      break;
+    case CEED_EVAL_INTERP:
+      e_size = num_nodes * num_comp;
+      q_size = num_qpts * num_comp * q_comp;
+      break;
+    case CEED_EVAL_GRAD:
+      e_size = num_nodes * num_comp;
+      q_size = num_qpts * num_comp * dim;
+      break;
+    case CEED_EVAL_DIV:
+      e_size = num_nodes * num_comp;
+      q_size = num_qpts * num_comp;
+      break;
+    case CEED_EVAL_CURL:
+      e_size = num_nodes * num_comp;
+      q_size = num_qpts * num_comp * dim;
+      break;
+    case CEED_EVAL_WEIGHT:
+      q_size = num_qpts;
+      break;
+  }
+  CeedCall(CeedProfileEnd(timer, flops * num_elem, (e_size + q_size) * num_elem * sizeof(CeedScalar)));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Stop timing a CeedQFunction application
+
+  Floating point operations are only counted if set with CeedQFunctionSetUserFlopsEstimate().
+  Memory traffic is estimated as a read of each input and a write of each output.
+
+  @param[in]     qf    CeedQFunction applied
+  @param[in]     Q     Number of quadrature points applied
+  @param[in,out] timer Timer from CeedProfileBegin()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileEndQFunction(CeedQFunction qf, CeedInt Q, CeedProfileTimer *timer) {
+  CeedSize size = 0;
+
+  if (!timer->is_active) return CeedProfileEnd(timer, 0, 0);
+  for (CeedInt i = 0; i < qf->num_input_fields; i++) size += qf->input_fields[i]->size;
+  for (CeedInt i = 0; i < qf->num_output_fields; i++) size += qf->output_fields[i]->size;
+  CeedCall(CeedProfileEnd(timer, qf->user_flop_estimate > 0 ? (CeedSize)qf->user_flop_estimate * Q : 0, size * Q * sizeof(CeedScalar)));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Write profiling data at Ceed destruction, if requested, and free it
+
+  @param[in,out] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedProfileDestroy(Ceed ceed) {
+  CeedProfile profile = ceed->profile;
+
+  if (!profile) return CEED_ERROR_SUCCESS;
+  // Delegate and fallback Ceeds record into their parent, so only the root Ceed writes the data
+  if (profile->format != CEED_PROFILE_NONE && !ceed->parent && !ceed->op_fallback_parent) {
+    CeedCall(CeedProfileView(ceed, profile->format, stdout));
+  }
+  for (CeedInt i = 0; i < profile->num_entries; i++) CeedCall(CeedFree(&profile->entries[i].name));
+  CeedCall(CeedFree(&profile->entries));
+  CeedCall(CeedFree(&ceed->profile));
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedProfile Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedBackend
+/// @{
+
+/**
+  @brief Get whether a Ceed is collecting profiling data
+
+  Backends may bypass fused code paths while profiling so that phases inside CeedOperator application are recorded.
+
+  @param[in]  ceed         Ceed context
+  @param[out] is_profiling Variable to store profiling status
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedIsProfiling(Ceed ceed, bool *is_profiling) {
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  *is_profiling = ceed->profile && ceed->profile->format != CEED_PROFILE_NONE;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Suspend profiling of phases inside CeedOperator application
+
+  Backends applying the restriction, basis, or QFunction through the libCEED interface from several threads must suspend profiling first, since the
+    profiling data is not thread safe.
+  The phases applied while suspended are included in the time of the enclosing CeedOperator application.
+  Calls must be matched by CeedProfileResume().
+
+  @param[in] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileSuspend(Ceed ceed) {
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  if (ceed->profile) ceed->profile->num_suspended++;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Resume profiling suspended with CeedProfileSuspend()
+
+  @param[in] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedProfileResume(Ceed ceed) {
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  if (ceed->profile && ceed->profile->num_suspended > 0) ceed->profile->num_suspended--;
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedProfile Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedUser
+/// @{
+
+/**
+  @brief Collect timing and counter data for CeedOperator application and assembly
+
+  For each CeedOperator name, set with CeedOperatorSetName(), the wall time, number of calls, estimated floating point operations, and estimated
+    bytes moved are recorded for operator application and assembly and for the element restriction, basis, and QFunction phases inside them.
+  The data is written to `stdout` in the requested format when @a ceed is destroyed.
+  Profiling may also be enabled with the environment variable `CEED_PROFILE`, set to `json` for JSON output or to any other value for a table.
+
+  Note: Phases inside CeedOperator application are only recorded by backends that apply the restriction, basis, and QFunction through the
+    libCEED interface; fused backends only record the application as a whole, and threaded backends do not record the phases applied by their
+    threads.
+  Profiling adds a timer query to each recorded call, so it should be disabled for production runs.
+
+  @param[in,out] ceed   Ceed context
+  @param[in]     format Output format, or @ref CEED_PROFILE_NONE to stop collecting data
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetProfiling(Ceed ceed, CeedProfileFormat format) {
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  if (!ceed->profile) {
+    CeedCall(CeedCalloc(1, &ceed->profile));
+    ceed->profile->current = -1;
+  }
+  ceed->profile->format = format;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief View profiling data collected by a Ceed
+
+  Rates are computed from the estimated floating point operations and bytes moved over the wall time of each phase.
+  Times for nested phases are included in the times for the phases that contain them.
+
+  @param[in] ceed   Ceed context
+  @param[in] format Output format, @ref CEED_PROFILE_TABLE or @ref CEED_PROFILE_JSON
+  @param[in] stream Filestream to write to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedProfileView(Ceed ceed, CeedProfileFormat format, FILE *stream) {
+  CeedProfile profile;
+
+  CeedCall(CeedProfileGetCeed(ceed, &ceed));
+  profile = ceed->profile;
+  if (format == CEED_PROFILE_JSON) {
+    bool is_first_entry = true;
+
+    fprintf(stream, "{\n  \"operators\": [");
+    for (CeedInt i = 0; profile && i < profile->num_entries; i++) {
+      bool is_first_phase = true;
+
+      fprintf(stream, "%s\n    {\"name\": ", is_first_entry ? "" : ",");
+      CeedProfileWriteJSONString(profile->entries[i].name, stream);
+      fprintf(stream, ", \"phases\": {");
+      for (CeedInt j = 0; j < CEED_PROFILE_NUM_PHASES; j++) {
+        CeedProfileStage *stage = &profile->entries[i].stages[j];
+
+        if (!stage->num_calls) continue;
+        fprintf(stream, "%s\n      \"%s\": {\"calls\": %td, \"time\": %.6e, \"flops\": %td, \"bytes\": %td}", is_first_phase ? "" : ",",
+                CeedProfilePhases[j], stage->num_calls, stage->time, stage->flops, stage->bytes);
+        is_first_phase = false;
+      }
+      fprintf(stream, "\n    }}");
+      is_first_entry = false;
+    }
+    fprintf(stream, "\n  ]\n}\n");
+  } else if (format == CEED_PROFILE_TABLE) {
+    fprintf(stream, "Ceed profile: %s\n", ceed->resource);
+    fprintf(stream, "  %-30s %12s %12s %12s %12s\n", "Operator / phase", "Calls", "Time (s)", "GFLOP/s", "GB/s");
+    for (CeedInt i = 0; profile && i < profile->num_entries; i++) {
+      fprintf(stream, "  %s\n", profile->entries[i].name);
+      for (CeedInt j = 0; j < CEED_PROFILE_NUM_PHASES; j++) {
+        CeedProfileStage *stage = &profile->entries[i].stages[j];
+
+        if (!stage->num_calls) continue;
+        fprintf(stream, "    %-28s %12td %12.4e", CeedProfilePhases[j], stage->num_calls, stage->time);
+        if (stage->flops > 0 && stage->time > 0) fprintf(stream, " %12.3f", 1e-9 * stage->flops / stage->time);
+        else fprintf(stream, " %12s", "-");
+        if (stage->bytes > 0 && stage->time > 0) fprintf(stream, " %12.3f\n", 1e-9 * stage->bytes / stage->time);
+        else fprintf(stream, " %12s\n", "-");
+      }
+    }
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
@@ -370,6 +370,8 @@ int CeedQFunctionRestoreContextData(CeedQFunction qf, void *data) {
     CeedCall(CeedQFunctionIsContextWritable(qf, &is_writable));
     if (is_writable) {
       CeedCall(CeedQFunctionContextRestoreData(ctx, data));
+      // Backend access is not a user change to the context, see CeedOperatorLinearAssembleQFunctionBuildOrUpdate()
+      ctx->backend_state += 2;
     } else {
       CeedCall(CeedQFunctionContextRestoreDataRead(ctx, data));
     }
@@ -394,6 +396,7 @@ int CeedQFunctionGetInnerContext(CeedQFunction qf, CeedQFunctionContext *ctx) {
     CeedCall(CeedQFunctionContextGetData(qf->ctx, CEED_MEM_HOST, &fortran_ctx));
     *ctx = fortran_ctx->inner_ctx;
     CeedCall(CeedQFunctionContextRestoreData(qf->ctx, (void *)&fortran_ctx));
+    qf->ctx->backend_state += 2;
   } else {
     *ctx = qf->ctx;
   }
@@ -449,6 +452,8 @@ int CeedQFunctionRestoreInnerContextData(CeedQFunction qf, void *data) {
     CeedCall(CeedQFunctionIsContextWritable(qf, &is_writable));
     if (is_writable) {
       CeedCall(CeedQFunctionContextRestoreData(ctx, data));
+      // Backend access is not a user change to the context, see CeedOperatorLinearAssembleQFunctionBuildOrUpdate()
+      ctx->backend_state += 2;
     } else {
       CeedCall(CeedQFunctionContextRestoreDataRead(ctx, data));
     }
@@ -1010,8 +1015,12 @@ int CeedQFunctionApply(CeedQFunction qf, CeedInt Q, CeedVector *u, CeedVector *v
                      qf->vec_length);
     // LCOV_EXCL_STOP
   }
+  CeedProfileTimer timer;
+
   qf->is_immutable = true;
-  CeedCall(qf->Apply(qf, Q, u, v));
+  CeedCall(CeedProfileBegin(qf->ceed, NULL, CEED_PROFILE_PHASE_QFUNCTION, &timer));
+  CeedProfileCall(&timer, qf->Apply(qf, Q, u, v));
+  CeedCall(CeedProfileEndQFunction(qf, Q, &timer));
   return CEED_ERROR_SUCCESS;
 }
 
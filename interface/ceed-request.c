@@ -0,0 +1,365 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#define _POSIX_C_SOURCE 200809L
+#include <ceed-impl.h>
+#include <ceed/backend.h>
+#include <ceed/ceed.h>
+#include <stdbool.h>
+#ifdef CEED_USE_PTHREAD
+#include <pthread.h>
+#endif
+
+/// @file
+/// Implementation of CeedRequest for non-blocking CeedOperator application on host backends
+
+#ifdef CEED_USE_PTHREAD
+/// @cond DOXYGEN_SKIP
+struct CeedRequestQueue_private {
+  pthread_t       thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t  submitted, completed;
+  CeedRequest     head, tail;
+  bool            is_stopping;
+};
+
+struct CeedThreadMutex_private {
+  pthread_mutex_t mutex;
+};
+
+// Serializes the lazy creation of the thread locks
+static pthread_mutex_t ceed_thread_mutex_create = PTHREAD_MUTEX_INITIALIZER;
+/// @endcond
+#endif
+
+/// ----------------------------------------------------------------------------
+/// CeedRequest Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedDeveloper
+/// @{
+
+/**
+  @brief Get the Ceed that owns the request queue and thread lock for a Ceed and its delegates
+
+  @param[in]  ceed      Ceed context
+  @param[out] root_ceed Variable to store the root Ceed
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedRequestQueueGetCeed(Ceed ceed, Ceed *root_ceed) {
+  *root_ceed = ceed;
+  while ((*root_ceed)->parent || (*root_ceed)->op_fallback_parent) {
+    *root_ceed = (*root_ceed)->parent ? (*root_ceed)->parent : (*root_ceed)->op_fallback_parent;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+#ifdef CEED_USE_PTHREAD
+/**
+  @brief Worker thread, applies queued CeedOperators in submission order
+
+  The request at the head of the queue stays in the queue until its application completes, so an empty queue means no pending work.
+
+  @param[in] data CeedRequestQueue to process
+
+  @return NULL
+
+  @ref Developer
+**/
+static void *CeedRequestQueueWorker(void *data) {
+  CeedRequestQueue queue = (CeedRequestQueue)data;
+
+  pthread_mutex_lock(&queue->mutex);
+  while (true) {
+    CeedRequest request;
+
+    while (!queue->head && !queue->is_stopping) pthread_cond_wait(&queue->submitted, &queue->mutex);
+    if (!queue->head) break;
+    request = queue->head;
+    pthread_mutex_unlock(&queue->mutex);
+
+    request->error_code = request->Apply(request->op, request->in, request->out, CEED_REQUEST_IMMEDIATE);
+
+    pthread_mutex_lock(&queue->mutex);
+    queue->head = request->next;
+    if (!queue->head) queue->tail = NULL;
+    request->is_done = true;
+    pthread_cond_broadcast(&queue->completed);
+  }
+  pthread_mutex_unlock(&queue->mutex);
+  return NULL;
+}
+#endif
+
+/**
+  @brief Queue CeedOperator application on a worker thread for non-blocking requests on host backends
+
+  The CeedOperator and CeedVectors are referenced until the request is completed with CeedRequestWait().
+  The worker thread does not lock the objects it uses, so the caller must not use the Ceed, or any object created from it, until the request is
+    completed.
+  In particular, CeedElemRestrictionApply() and CeedBasisApply() do not wait for queued applications, and the reference count of the Ceed is not
+    atomic.
+  Backends that prefer device memory, or builds without POSIX threads, do not queue the application and @a request is set to NULL.
+  Blocking applications with @ref CEED_REQUEST_IMMEDIATE or @ref CEED_REQUEST_ORDERED first wait for all queued applications to complete.
+
+  @param[in]  op        CeedOperator to apply
+  @param[in]  apply     Function applying the CeedOperator, such as CeedOperatorApply() or CeedOperatorApplyAdd()
+  @param[in]  in        CeedVector containing input state or @ref CEED_VECTOR_NONE
+  @param[out] out       CeedVector to store or sum into the result or @ref CEED_VECTOR_NONE
+  @param[out] request   Address of CeedRequest passed to @a apply
+  @param[out] is_queued Variable to store whether the application was queued
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedOperatorApplyQueued(CeedOperator op, int (*apply)(CeedOperator, CeedVector, CeedVector, CeedRequest *), CeedVector in, CeedVector out,
+                            CeedRequest *request, bool *is_queued) {
+  *is_queued = false;
+  if (request == CEED_REQUEST_IMMEDIATE || request == CEED_REQUEST_ORDERED) {
+    CeedCall(CeedRequestQueueWait(op->ceed));
+    return CEED_ERROR_SUCCESS;
+  }
+  *request = NULL;
+#ifdef CEED_USE_PTHREAD
+  Ceed        ceed;
+  CeedMemType mem_type;
+
+  CeedCall(CeedGetPreferredMemType(op->ceed, &mem_type));
+  if (mem_type != CEED_MEM_HOST) return CEED_ERROR_SUCCESS;
+  CeedCall(CeedRequestQueueGetCeed(op->ceed, &ceed));
+
+  // Start worker on first use
+  if (!ceed->request_queue) {
+    CeedRequestQueue queue;
+
+    CeedCall(CeedCalloc(1, &queue));
+    pthread_mutex_init(&queue->mutex, NULL);
+    pthread_cond_init(&queue->submitted, NULL);
+    pthread_cond_init(&queue->completed, NULL);
+    if (pthread_create(&queue->thread, NULL, CeedRequestQueueWorker, queue)) {
+      // LCOV_EXCL_START
+      pthread_mutex_destroy(&queue->mutex);
+      pthread_cond_destroy(&queue->submitted);
+      pthread_cond_destroy(&queue->completed);
+      CeedCall(CeedFree(&queue));
+      return CEED_ERROR_SUCCESS;
+      // LCOV_EXCL_STOP
+    }
+    ceed->request_queue = queue;
+  }
+
+  // Create request
+  CeedCall(CeedCalloc(1, request));
+  (*request)->queue = ceed->request_queue;
+  (*request)->Apply = apply;
+  CeedCall(CeedOperatorReferenceCopy(op, &(*request)->op));
+  (*request)->in  = in;
+  (*request)->out = out;
+  if (in != CEED_VECTOR_NONE) CeedCall(CeedVectorReference(in));
+  if (out != CEED_VECTOR_NONE) CeedCall(CeedVectorReference(out));
+
+  // Submit
+  pthread_mutex_lock(&ceed->request_queue->mutex);
+  if (ceed->request_queue->tail) ceed->request_queue->tail->next = *request;
+  else ceed->request_queue->head = *request;
+  ceed->request_queue->tail = *request;
+  pthread_cond_signal(&ceed->request_queue->submitted);
+  pthread_mutex_unlock(&ceed->request_queue->mutex);
+  *is_queued = true;
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Wait for all queued CeedOperator applications on a Ceed to complete
+
+  This is a no-op when called from the worker thread.
+
+  @param[in] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestQueueWait(Ceed ceed) {
+#ifdef CEED_USE_PTHREAD
+  CeedCall(CeedRequestQueueGetCeed(ceed, &ceed));
+  CeedRequestQueue queue = ceed->request_queue;
+
+  if (!queue || pthread_equal(pthread_self(), queue->thread)) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->mutex);
+  while (queue->head) pthread_cond_wait(&queue->completed, &queue->mutex);
+  pthread_mutex_unlock(&queue->mutex);
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Complete queued CeedOperator applications and stop the worker thread
+
+  @param[in,out] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedRequestQueueDestroy(Ceed ceed) {
+#ifdef CEED_USE_PTHREAD
+  CeedRequestQueue queue = ceed->request_queue;
+
+  if (!queue) return CEED_ERROR_SUCCESS;
+  pthread_mutex_lock(&queue->mutex);
+  queue->is_stopping = true;
+  pthread_cond_signal(&queue->submitted);
+  pthread_mutex_unlock(&queue->mutex);
+  pthread_join(queue->thread, NULL);
+  pthread_mutex_destroy(&queue->mutex);
+  pthread_cond_destroy(&queue->submitted);
+  pthread_cond_destroy(&queue->completed);
+  CeedCall(CeedFree(&ceed->request_queue));
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy the thread lock of a Ceed
+
+  @param[in,out] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+int CeedThreadLockDestroy(Ceed ceed) {
+#ifdef CEED_USE_PTHREAD
+  if (!ceed->thread_mutex) return CEED_ERROR_SUCCESS;
+  pthread_mutex_destroy(&ceed->thread_mutex->mutex);
+  CeedCall(CeedFree(&ceed->thread_mutex));
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedRequest Backend API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedBackend
+/// @{
+
+/**
+  @brief Lock the Ceed shared by a Ceed and its delegates against other threads
+
+  Backends applying a CeedOperator concurrently from several user threads, such as with CeedOperatorApplyAddRange(), hold this lock while they
+    access CeedVector, CeedQFunctionContext, or other libCEED objects shared between the threads, since their access counters are not atomic.
+  The lock is recursive, so a thread holding it may lock it again, and each call must be matched by CeedThreadUnlock().
+  Builds without POSIX threads do not lock.
+
+  @param[in] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedThreadLock(Ceed ceed) {
+#ifdef CEED_USE_PTHREAD
+  CeedCall(CeedRequestQueueGetCeed(ceed, &ceed));
+
+  // Create lock on first use
+  pthread_mutex_lock(&ceed_thread_mutex_create);
+  if (!ceed->thread_mutex) {
+    CeedThreadMutex     thread_mutex;
+    pthread_mutexattr_t attr;
+    int                 ierr;
+
+    ierr = CeedCalloc(1, &thread_mutex);
+    if (ierr) {
+      // LCOV_EXCL_START
+      pthread_mutex_unlock(&ceed_thread_mutex_create);
+      return CeedError(ceed, CEED_ERROR_MAJOR, "Failed to allocate thread lock");
+      // LCOV_EXCL_STOP
+    }
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&thread_mutex->mutex, &attr);
+    pthread_mutexattr_destroy(&attr);
+    ceed->thread_mutex = thread_mutex;
+  }
+  pthread_mutex_unlock(&ceed_thread_mutex_create);
+  pthread_mutex_lock(&ceed->thread_mutex->mutex);
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Unlock the Ceed locked with CeedThreadLock()
+
+  @param[in] ceed Ceed context
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedThreadUnlock(Ceed ceed) {
+#ifdef CEED_USE_PTHREAD
+  CeedCall(CeedRequestQueueGetCeed(ceed, &ceed));
+  pthread_mutex_unlock(&ceed->thread_mutex->mutex);
+#endif
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
+/// ----------------------------------------------------------------------------
+/// CeedRequest Public API
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedUser
+/// @{
+
+/**
+  @brief Wait for a CeedRequest to complete.
+
+  Calling CeedRequestWait on a NULL request is a no-op.
+  While a request is pending, the only libCEED functions that may be called with its Ceed, or with any object created from that Ceed, are
+    CeedRequestWait() and further non-blocking CeedOperator applications, which are queued in order.
+  This covers the CeedOperator and CeedVectors of the request, the CeedElemRestriction, CeedBasis, CeedQFunction, and CeedQFunctionContext objects
+    they use, and the creation or destruction of other objects on the Ceed.
+  The pending application may be overlapped with work outside of libCEED, such as MPI communication.
+
+  @param req Address of CeedRequest to wait for; zeroed on completion.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedRequestWait(CeedRequest *req) {
+  if (!*req) return CEED_ERROR_SUCCESS;
+#ifdef CEED_USE_PTHREAD
+  CeedRequest request = *req;
+  int         error_code;
+
+  pthread_mutex_lock(&request->queue->mutex);
+  while (!request->is_done) pthread_cond_wait(&request->queue->completed, &request->queue->mutex);
+  pthread_mutex_unlock(&request->queue->mutex);
+
+  error_code = request->error_code;
+  if (request->in != CEED_VECTOR_NONE) CeedCall(CeedVectorDestroy(&request->in));
+  if (request->out != CEED_VECTOR_NONE) CeedCall(CeedVectorDestroy(&request->out));
+  CeedCall(CeedOperatorDestroy(&request->op));
+  CeedCall(CeedFree(req));
+  return error_code;
+#else
+  // LCOV_EXCL_START
+  return CeedError(NULL, CEED_ERROR_UNSUPPORTED, "CeedRequestWait not implemented");
+  // LCOV_EXCL_STOP
+#endif
+}
+
+/// @}
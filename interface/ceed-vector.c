@@ -32,6 +32,50 @@ const CeedVector CEED_VECTOR_NONE = &ceed_vector_none;
 
 /// @}
 
+/// ----------------------------------------------------------------------------
+/// CeedVector Library Internal Functions
+/// ----------------------------------------------------------------------------
+/// @addtogroup CeedVectorDeveloper
+/// @{
+
+/**
+  @brief Check that a CeedVector may be combined with another CeedVector in a vector operation
+
+  @param[in] vec       CeedVector to check
+  @param[in] vec_other CeedVector combined with @a vec
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedVectorCheckCompatible(CeedVector vec, CeedVector vec_other) {
+  bool has_valid_array = true;
+  Ceed ceed_parent, ceed_parent_other;
+
+  if (vec->length != vec_other->length) {
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, CEED_ERROR_UNSUPPORTED, "Cannot combine vectors of different lengths");
+    // LCOV_EXCL_STOP
+  }
+  CeedCall(CeedGetParent(vec->ceed, &ceed_parent));
+  CeedCall(CeedGetParent(vec_other->ceed, &ceed_parent_other));
+  if (ceed_parent != ceed_parent_other) {
+    // LCOV_EXCL_START
+    return CeedError(vec->ceed, CEED_ERROR_INCOMPATIBLE, "Vectors must be created by the same Ceed context");
+    // LCOV_EXCL_STOP
+  }
+  CeedCall(CeedVectorHasValidArray(vec_other, &has_valid_array));
+  if (!has_valid_array) {
+    // LCOV_EXCL_START
+    return CeedError(vec_other->ceed, CEED_ERROR_BACKEND,
+                     "CeedVector has no valid data, must set data with CeedVectorSetValue or CeedVectorSetArray");
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/// @}
+
 /// ----------------------------------------------------------------------------
 /// CeedVector Backend API
 /// ----------------------------------------------------------------------------
@@ -317,7 +361,7 @@ int CeedVectorSetValue(CeedVector vec, CeedScalar value) {
   } else {
     CeedScalar *array;
     CeedCall(CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &array));
-    for (CeedInt i = 0; i < vec->length; i++) array[i] = value;
+    for (CeedSize i = 0; i < vec->length; i++) array[i] = value;
     CeedCall(CeedVectorRestoreArray(vec, &array));
   }
   vec->state += 2;
@@ -603,17 +647,17 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   *norm = 0.;
   switch (norm_type) {
     case CEED_NORM_1:
-      for (CeedInt i = 0; i < vec->length; i++) {
+      for (CeedSize i = 0; i < vec->length; i++) {
         *norm += fabs(array[i]);
       }
       break;
     case CEED_NORM_2:
-      for (CeedInt i = 0; i < vec->length; i++) {
+      for (CeedSize i = 0; i < vec->length; i++) {
         *norm += fabs(array[i]) * fabs(array[i]);
       }
       break;
     case CEED_NORM_MAX:
-      for (CeedInt i = 0; i < vec->length; i++) {
+      for (CeedSize i = 0; i < vec->length; i++) {
         const CeedScalar abs_v_i = fabs(array[i]);
         *norm                    = *norm > abs_v_i ? *norm : abs_v_i;
       }
@@ -624,6 +668,86 @@ int CeedVectorNorm(CeedVector vec, CeedNormType norm_type, CeedScalar *norm) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute the dot product of two CeedVectors
+
+  Note: This operation is local to the CeedVector, see CeedVectorNorm().
+
+  @param[in]  x      First vector
+  @param[in]  y      Second vector, may be the same as @a x
+  @param[out] result Variable to store the dot product
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorDot(CeedVector x, CeedVector y, CeedScalar *result) {
+  const CeedScalar *x_array = NULL, *y_array = NULL;
+
+  CeedCall(CeedVectorCheckCompatible(x, x));
+  CeedCall(CeedVectorCheckCompatible(x, y));
+
+  // Backend implementation
+  if (x->Dot) return x->Dot(x, y, result);
+
+  // Default implementation
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  CeedCall(CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array));
+
+  *result = 0.;
+  for (CeedSize i = 0; i < x->length; i++) *result += x_array[i] * y_array[i];
+
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedVectorRestoreArrayRead(y, &y_array));
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Compute the dot products of a CeedVector with several CeedVectors in a single pass over @a x
+
+  The squared 2-norm of @a x is computed in the same pass by including @a x in @a y.
+
+  Note: This operation is local to the CeedVector, see CeedVectorNorm().
+
+  @param[in]  x        First vector
+  @param[in]  num_vecs Number of vectors in @a y
+  @param[in]  y        Array of vectors to take the dot product with @a x
+  @param[out] results  Array of length @a num_vecs to store the dot products
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMDot(CeedVector x, CeedInt num_vecs, CeedVector *y, CeedScalar *results) {
+  const CeedScalar  *x_array = NULL;
+  const CeedScalar **y_arrays;
+
+  CeedCall(CeedVectorCheckCompatible(x, x));
+  for (CeedInt j = 0; j < num_vecs; j++) CeedCall(CeedVectorCheckCompatible(x, y[j]));
+
+  // Backend implementation
+  if (x->MDot) return x->MDot(x, num_vecs, y, results);
+
+  // Default implementation
+  CeedCall(CeedCalloc(num_vecs, &y_arrays));
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  for (CeedInt j = 0; j < num_vecs; j++) {
+    CeedCall(CeedVectorGetArrayRead(y[j], CEED_MEM_HOST, &y_arrays[j]));
+    results[j] = 0.;
+  }
+
+  for (CeedSize i = 0; i < x->length; i++) {
+    const CeedScalar x_i = x_array[i];
+
+    for (CeedInt j = 0; j < num_vecs; j++) results[j] += x_i * y_arrays[j][i];
+  }
+
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  for (CeedInt j = 0; j < num_vecs; j++) CeedCall(CeedVectorRestoreArrayRead(y[j], &y_arrays[j]));
+  CeedCall(CeedFree(&y_arrays));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute x = alpha x
 
@@ -654,7 +778,7 @@ int CeedVectorScale(CeedVector x, CeedScalar alpha) {
 
   // Default implementation
   CeedCall(CeedVectorGetArrayWrite(x, CEED_MEM_HOST, &x_array));
-  for (CeedInt i = 0; i < n_x; i++) x_array[i] *= alpha;
+  for (CeedSize i = 0; i < n_x; i++) x_array[i] *= alpha;
   CeedCall(CeedVectorRestoreArray(x, &x_array));
 
   return CEED_ERROR_SUCCESS;
@@ -725,7 +849,7 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   assert(x_array);
   assert(y_array);
 
-  for (CeedInt i = 0; i < n_y; i++) y_array[i] += alpha * x_array[i];
+  for (CeedSize i = 0; i < n_y; i++) y_array[i] += alpha * x_array[i];
 
   CeedCall(CeedVectorRestoreArray(y, &y_array));
   CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
@@ -733,6 +857,53 @@ int CeedVectorAXPY(CeedVector y, CeedScalar alpha, CeedVector x) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute y = sum_j alpha_j x_j + y in a single pass over @a y
+
+  @param[in,out] y        Target vector for sum
+  @param[in]     num_vecs Number of vectors in @a x
+  @param[in]     alpha    Array of @a num_vecs scaling factors
+  @param[in]     x        Array of vectors to add, must be different than y
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorMAXPY(CeedVector y, CeedInt num_vecs, const CeedScalar *alpha, CeedVector *x) {
+  CeedScalar        *y_array = NULL;
+  const CeedScalar **x_arrays;
+
+  CeedCall(CeedVectorCheckCompatible(y, y));
+  for (CeedInt j = 0; j < num_vecs; j++) {
+    if (x[j] == y) {
+      // LCOV_EXCL_START
+      return CeedError(y->ceed, CEED_ERROR_UNSUPPORTED, "Cannot use same vector for x and y in CeedVectorMAXPY");
+      // LCOV_EXCL_STOP
+    }
+    CeedCall(CeedVectorCheckCompatible(y, x[j]));
+  }
+
+  // Backend implementation
+  if (y->MAXPY) return y->MAXPY(y, num_vecs, alpha, x);
+
+  // Default implementation
+  CeedCall(CeedCalloc(num_vecs, &x_arrays));
+  CeedCall(CeedVectorGetArray(y, CEED_MEM_HOST, &y_array));
+  for (CeedInt j = 0; j < num_vecs; j++) CeedCall(CeedVectorGetArrayRead(x[j], CEED_MEM_HOST, &x_arrays[j]));
+
+  for (CeedSize i = 0; i < y->length; i++) {
+    CeedScalar y_i = y_array[i];
+
+    for (CeedInt j = 0; j < num_vecs; j++) y_i += alpha[j] * x_arrays[j][i];
+    y_array[i] = y_i;
+  }
+
+  CeedCall(CeedVectorRestoreArray(y, &y_array));
+  for (CeedInt j = 0; j < num_vecs; j++) CeedCall(CeedVectorRestoreArrayRead(x[j], &x_arrays[j]));
+  CeedCall(CeedFree(&x_arrays));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute y = alpha x + beta y
 
@@ -799,7 +970,7 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   assert(x_array);
   assert(y_array);
 
-  for (CeedInt i = 0; i < n_y; i++) y_array[i] += alpha * x_array[i] + beta * y_array[i];
+  for (CeedSize i = 0; i < n_y; i++) y_array[i] += alpha * x_array[i] + beta * y_array[i];
 
   CeedCall(CeedVectorRestoreArray(y, &y_array));
   CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
@@ -807,6 +978,56 @@ int CeedVectorAXPBY(CeedVector y, CeedScalar alpha, CeedScalar beta, CeedVector
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Compute z = alpha x + beta y + gamma z in a single pass over @a z
+
+  If @a gamma is zero, the values of @a z are not read.
+
+  @param[in,out] z     Target vector for sum
+  @param[in]     alpha First scaling factor
+  @param[in]     beta  Second scaling factor
+  @param[in]     gamma Third scaling factor
+  @param[in]     x     First vector, must be different than z
+  @param[in]     y     Second vector, must be different than z
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedVectorAXPBYPCZ(CeedVector z, CeedScalar alpha, CeedScalar beta, CeedScalar gamma, CeedVector x, CeedVector y) {
+  CeedScalar       *z_array = NULL;
+  const CeedScalar *x_array = NULL, *y_array = NULL;
+
+  if (x == z || y == z) {
+    // LCOV_EXCL_START
+    return CeedError(z->ceed, CEED_ERROR_UNSUPPORTED, "Cannot use same vector for x or y and z in CeedVectorAXPBYPCZ");
+    // LCOV_EXCL_STOP
+  }
+  if (gamma != 0.0) CeedCall(CeedVectorCheckCompatible(z, z));
+  CeedCall(CeedVectorCheckCompatible(z, x));
+  CeedCall(CeedVectorCheckCompatible(z, y));
+
+  // Backend implementation
+  if (z->AXPBYPCZ) return z->AXPBYPCZ(z, alpha, beta, gamma, x, y);
+
+  // Default implementation
+  if (gamma == 0.0) CeedCall(CeedVectorGetArrayWrite(z, CEED_MEM_HOST, &z_array));
+  else CeedCall(CeedVectorGetArray(z, CEED_MEM_HOST, &z_array));
+  CeedCall(CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array));
+  CeedCall(CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array));
+
+  if (gamma == 0.0) {
+    for (CeedSize i = 0; i < z->length; i++) z_array[i] = alpha * x_array[i] + beta * y_array[i];
+  } else {
+    for (CeedSize i = 0; i < z->length; i++) z_array[i] = alpha * x_array[i] + beta * y_array[i] + gamma * z_array[i];
+  }
+
+  CeedCall(CeedVectorRestoreArray(z, &z_array));
+  CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
+  CeedCall(CeedVectorRestoreArrayRead(y, &y_array));
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Compute the pointwise multiplication w = x .* y.
            Any subset of x, y, and w may be the same vector.
@@ -884,7 +1105,7 @@ int CeedVectorPointwiseMult(CeedVector w, CeedVector x, CeedVector y) {
   assert(x_array);
   assert(y_array);
 
-  for (CeedInt i = 0; i < n_w; i++) w_array[i] = x_array[i] * y_array[i];
+  for (CeedSize i = 0; i < n_w; i++) w_array[i] = x_array[i] * y_array[i];
 
   if (y != w && y != x) CeedCall(CeedVectorRestoreArrayRead(y, &y_array));
   if (x != w) CeedCall(CeedVectorRestoreArrayRead(x, &x_array));
@@ -929,7 +1150,7 @@ int CeedVectorReciprocal(CeedVector vec) {
   CeedCall(CeedVectorGetLength(vec, &len));
   CeedScalar *array;
   CeedCall(CeedVectorGetArrayWrite(vec, CEED_MEM_HOST, &array));
-  for (CeedInt i = 0; i < len; i++) {
+  for (CeedSize i = 0; i < len; i++) {
     if (fabs(array[i]) > CEED_EPSILON) array[i] = 1. / array[i];
   }
 
@@ -955,7 +1176,7 @@ int CeedVectorView(CeedVector vec, const char *fp_fmt, FILE *stream) {
   char fmt[1024];
   fprintf(stream, "CeedVector length %ld\n", (long)vec->length);
   snprintf(fmt, sizeof fmt, "  %s\n", fp_fmt ? fp_fmt : "%g");
-  for (CeedInt i = 0; i < vec->length; i++) fprintf(stream, fmt, x[i]);
+  for (CeedSize i = 0; i < vec->length; i++) fprintf(stream, fmt, x[i]);
 
   CeedCall(CeedVectorRestoreArrayRead(vec, &x));
   return CEED_ERROR_SUCCESS;
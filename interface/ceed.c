@@ -6,6 +6,7 @@
 // This file is part of CEED:  http://github.com/ceed
 
 #define _POSIX_C_SOURCE 200112
+#define _DEFAULT_SOURCE
 #include <ceed-impl.h>
 #include <ceed/backend.h>
 #include <ceed/ceed.h>
@@ -15,8 +16,10 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 
 /// @cond DOXYGEN_SKIP
+#define CEED_HUGE_PAGE_SIZE (2 * 1024 * 1024)
 static CeedRequest ceed_request_immediate;
 static CeedRequest ceed_request_ordered;
 
@@ -77,28 +80,14 @@ CeedRequest *const CEED_REQUEST_IMMEDIATE = &ceed_request_immediate;
 
   which allows the sequence to complete asynchronously but does not start `op2` until `op1` has completed.
 
-  @todo The current implementation is overly strict, offering equivalent semantics to @ref CEED_REQUEST_IMMEDIATE.
+  On host backends, pending requests are completed before an ordered operation is performed.
+
+  @todo The current implementation is overly strict, performing the ordered operation synchronously after pending requests complete.
 
   @sa CEED_REQUEST_IMMEDIATE
  */
 CeedRequest *const CEED_REQUEST_ORDERED = &ceed_request_ordered;
 
-/**
-  @brief Wait for a CeedRequest to complete.
-
-  Calling CeedRequestWait on a NULL request is a no-op.
-
-  @param req Address of CeedRequest to wait for; zeroed on completion.
-
-  @return An error code: 0 - success, otherwise - failure
-
-  @ref User
-**/
-int CeedRequestWait(CeedRequest *req) {
-  if (!*req) return CEED_ERROR_SUCCESS;
-  return CeedError(NULL, CEED_ERROR_UNSUPPORTED, "CeedRequestWait not implemented");
-}
-
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -136,6 +125,53 @@ int CeedRegisterImpl(const char *prefix, int (*init)(const char *, Ceed), unsign
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the number of references to a Ceed context held by its unused work vectors
+
+  @param[in]  ceed     Ceed context
+  @param[out] num_refs Variable to store the number of references
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsGetNumReferences(Ceed ceed, CeedInt *num_refs) {
+  *num_refs = 0;
+  for (CeedInt i = 0; i < ceed->work_vectors.num_vecs; i++) {
+    if (!ceed->work_vectors.is_in_use[i] && ceed->work_vectors.vecs[i]->ceed == ceed) (*num_refs)++;
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Destroy the unused work vectors of a Ceed context with length at least `min_len`
+
+  @param[in,out] ceed    Ceed context whose work vectors are destroyed
+  @param[in]     min_len Minimum length of the work vectors to destroy
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Developer
+**/
+static int CeedWorkVectorsClear(Ceed ceed, CeedSize min_len) {
+  CeedWorkVectors *work_vectors = &ceed->work_vectors;
+
+  for (CeedInt i = 0; i < work_vectors->num_vecs;) {
+    CeedVector vec = work_vectors->vecs[i];
+
+    if (work_vectors->is_in_use[i] || vec->length < min_len) {
+      i++;
+      continue;
+    }
+    // Remove the work vector from the pool before destroying it, as destroying it releases a reference to the Ceed, see CeedDestroy()
+    work_vectors->num_vecs--;
+    work_vectors->vecs[i]      = work_vectors->vecs[work_vectors->num_vecs];
+    work_vectors->is_in_use[i] = work_vectors->is_in_use[work_vectors->num_vecs];
+    CeedCall(CeedVectorDestroy(&vec));
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -243,6 +279,53 @@ int CeedCallocArray(size_t n, size_t unit, void *p) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Allocate a cleared (zeroed) array on the host following the host memory policy of a Ceed; use CeedHostCalloc()
+
+  With @ref CEED_HOST_MEMORY_HUGE_PAGES, arrays of at least 2 MiB are aligned to 2 MiB and advised to use transparent huge pages.
+  With @ref CEED_HOST_MEMORY_FIRST_TOUCH, the array is zeroed by the "HostFirstTouch" backend function of the parent Ceed, if set, so that
+    threaded backends place each page on the NUMA node of the thread that works on it.
+  Otherwise the array is zeroed by the calling thread, and without a policy this is CeedCallocArray().
+
+  @param[in]  ceed Ceed context whose parent holds the host memory policy
+  @param[in]  n    Number of units to allocate
+  @param[in]  unit Size of each unit
+  @param[out] p    Address of pointer to hold the result.
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @sa CeedFree()
+
+  @ref Backend
+**/
+int CeedHostCallocArray(Ceed ceed, size_t n, size_t unit, void *p) {
+  Ceed         ceed_parent;
+  const size_t bytes = n * unit;
+  bool         use_huge_pages;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  if (ceed_parent->host_memory_policy == CEED_HOST_MEMORY_DEFAULT) return CeedCallocArray(n, unit, p);
+
+  use_huge_pages = (ceed_parent->host_memory_policy & CEED_HOST_MEMORY_HUGE_PAGES) && bytes >= CEED_HUGE_PAGE_SIZE;
+  if (posix_memalign((void **)p, use_huge_pages ? CEED_HUGE_PAGE_SIZE : CEED_ALIGN, bytes)) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_MAJOR, "posix_memalign failed to allocate %zd members of size %zd\n", n, unit);
+    // LCOV_EXCL_STOP
+  }
+#ifdef MADV_HUGEPAGE
+  // Advice only, so failure is not an error
+  if (use_huge_pages) madvise(*(void **)p, bytes, MADV_HUGEPAGE);
+#endif
+
+  // Pages are placed on first write
+  if ((ceed_parent->host_memory_policy & CEED_HOST_MEMORY_FIRST_TOUCH) && ceed_parent->HostFirstTouch) {
+    CeedCall(ceed_parent->HostFirstTouch(ceed_parent, *(void **)p, bytes));
+  } else {
+    memset(*(void **)p, 0, bytes);
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Reallocate an array on the host; use CeedRealloc()
 
@@ -448,6 +531,52 @@ int CeedSetObjectDelegate(Ceed ceed, Ceed delegate, const char *obj_name) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get the root of the requested resource
+
+  The resource root is the requested resource up to, but not including, the first delineator, such as ":" for backend options.
+
+  @param[in]  ceed          Ceed context to get resource name of
+  @param[in]  resource      Full user specified resource
+  @param[in]  delineator    Delineator to break resource root and options
+  @param[out] resource_root Variable to store resource root, caller must free with CeedFree()
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetResourceRoot(Ceed ceed, const char *resource, const char *delineator, char **resource_root) {
+  const char *option_spec       = strstr(resource, delineator);
+  size_t      resource_root_len = option_spec ? (size_t)(option_spec - resource) + 1 : strlen(resource) + 1;
+  CeedCall(CeedCalloc(resource_root_len, resource_root));
+  memcpy(*resource_root, resource, resource_root_len - 1);
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the element block size requested with the resource option ":blk_size=N"
+
+  @param[in]  ceed             Ceed context for error handling
+  @param[in]  resource         Full user specified resource
+  @param[in]  default_blk_size Block size to use if the resource does not select one
+  @param[out] blk_size         Variable to store block size
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetResourceBlockSize(Ceed ceed, const char *resource, CeedInt default_blk_size, CeedInt *blk_size) {
+  const char *blk_size_spec = strstr(resource, ":blk_size=");
+
+  *blk_size = blk_size_spec ? atoi(blk_size_spec + strlen(":blk_size=")) : default_blk_size;
+  if (*blk_size < 1) {
+    // LCOV_EXCL_START
+    return CeedError(ceed, CEED_ERROR_BACKEND, "Backend cannot use block size %" CeedInt_FMT " from resource: %s", *blk_size, resource);
+    // LCOV_EXCL_STOP
+  }
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief Get the fallback resource for CeedOperators
 
@@ -642,6 +771,104 @@ int CeedReference(Ceed ceed) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Get a work CeedVector of a given length from the pool of the parent Ceed context.
+
+  Work vectors are bucketed by length and recycled, so repeated temporaries of the same size, such as in operator assembly, are only allocated once.
+  The values of the work vector are not initialized.
+  The work vector must be returned with CeedRestoreWorkVector().
+  Unused work vectors are kept until CeedClearWorkVectors() or the destruction of the Ceed context.
+
+  @param[in]  ceed Ceed context
+  @param[in]  len  Length of the work vector
+  @param[out] vec  Address to save the work vector to
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedGetWorkVector(Ceed ceed, CeedSize len, CeedVector *vec) {
+  Ceed             ceed_parent;
+  CeedWorkVectors *work_vectors;
+  CeedInt          i;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  work_vectors = &ceed_parent->work_vectors;
+
+  // Find an unused work vector of matching length
+  for (i = 0; i < work_vectors->num_vecs; i++) {
+    if (!work_vectors->is_in_use[i] && work_vectors->vecs[i]->length == len) break;
+  }
+
+  // Create a new work vector
+  if (i == work_vectors->num_vecs) {
+    if (work_vectors->num_vecs == work_vectors->max_vecs) {
+      work_vectors->max_vecs = work_vectors->max_vecs ? 2 * work_vectors->max_vecs : 4;
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->vecs));
+      CeedCall(CeedRealloc(work_vectors->max_vecs, &work_vectors->is_in_use));
+    }
+    CeedCall(CeedVectorCreate(ceed_parent, len, &work_vectors->vecs[i]));
+    work_vectors->num_vecs++;
+  }
+  work_vectors->is_in_use[i] = true;
+  *vec                       = work_vectors->vecs[i];
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Return a work CeedVector obtained with CeedGetWorkVector() to the pool of the parent Ceed context
+
+  @param[in]     ceed Ceed context
+  @param[in,out] vec  Work vector to return, set to NULL on return
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedRestoreWorkVector(Ceed ceed, CeedVector *vec) {
+  Ceed             ceed_parent;
+  CeedWorkVectors *work_vectors;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  work_vectors = &ceed_parent->work_vectors;
+  for (CeedInt i = 0; i < work_vectors->num_vecs; i++) {
+    if (work_vectors->vecs[i] == *vec) {
+      if (!work_vectors->is_in_use[i]) {
+        // LCOV_EXCL_START
+        return CeedError(ceed, CEED_ERROR_ACCESS, "Work vector has already been restored");
+        // LCOV_EXCL_STOP
+      }
+      work_vectors->is_in_use[i] = false;
+      *vec                       = NULL;
+      return CEED_ERROR_SUCCESS;
+    }
+  }
+  // LCOV_EXCL_START
+  return CeedError(ceed, CEED_ERROR_INCOMPATIBLE, "CeedVector is not a work vector of this Ceed");
+  // LCOV_EXCL_STOP
+}
+
+/**
+  @brief Destroy the unused work CeedVectors in the pool of the parent Ceed context with length at least `min_len`
+
+  Use this to release large work vectors, such as after operator assembly, that are not needed again.
+  Work vectors obtained with CeedGetWorkVector() and not yet restored are kept.
+
+  @param[in] ceed    Ceed context
+  @param[in] min_len Minimum length of the work vectors to destroy, 0 destroys all unused work vectors
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref Backend
+**/
+int CeedClearWorkVectors(Ceed ceed, CeedSize min_len) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  CeedCall(CeedWorkVectorsClear(ceed_parent, min_len));
+  return CEED_ERROR_SUCCESS;
+}
+
 /// @}
 
 /// ----------------------------------------------------------------------------
@@ -816,6 +1043,8 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateOriented),
       CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked),
+      CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreate64),
+      CEED_FTABLE_ENTRY(Ceed, ElemRestrictionCreateBlocked64),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateTensorH1),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateH1),
       CEED_FTABLE_ENTRY(Ceed, BasisCreateHdiv),
@@ -824,6 +1053,7 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(Ceed, QFunctionContextCreate),
       CEED_FTABLE_ENTRY(Ceed, OperatorCreate),
       CEED_FTABLE_ENTRY(Ceed, CompositeOperatorCreate),
+      CEED_FTABLE_ENTRY(Ceed, HostFirstTouch),
       CEED_FTABLE_ENTRY(CeedVector, HasValidArray),
       CEED_FTABLE_ENTRY(CeedVector, HasBorrowedArrayOfType),
       CEED_FTABLE_ENTRY(CeedVector, SetArray),
@@ -836,15 +1066,21 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedVector, RestoreArray),
       CEED_FTABLE_ENTRY(CeedVector, RestoreArrayRead),
       CEED_FTABLE_ENTRY(CeedVector, Norm),
+      CEED_FTABLE_ENTRY(CeedVector, Dot),
+      CEED_FTABLE_ENTRY(CeedVector, MDot),
       CEED_FTABLE_ENTRY(CeedVector, Scale),
       CEED_FTABLE_ENTRY(CeedVector, AXPY),
+      CEED_FTABLE_ENTRY(CeedVector, MAXPY),
       CEED_FTABLE_ENTRY(CeedVector, AXPBY),
+      CEED_FTABLE_ENTRY(CeedVector, AXPBYPCZ),
       CEED_FTABLE_ENTRY(CeedVector, PointwiseMult),
       CEED_FTABLE_ENTRY(CeedVector, Reciprocal),
       CEED_FTABLE_ENTRY(CeedVector, Destroy),
       CEED_FTABLE_ENTRY(CeedElemRestriction, Apply),
       CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlock),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, ApplyBlockRange),
       CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets),
+      CEED_FTABLE_ENTRY(CeedElemRestriction, GetOffsets64),
       CEED_FTABLE_ENTRY(CeedElemRestriction, Destroy),
       CEED_FTABLE_ENTRY(CeedBasis, Apply),
       CEED_FTABLE_ENTRY(CeedBasis, Destroy),
@@ -878,7 +1114,9 @@ int CeedInit(const char *resource, Ceed *ceed) {
       CEED_FTABLE_ENTRY(CeedOperator, ApplyComposite),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAdd),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyAddComposite),
+      CEED_FTABLE_ENTRY(CeedOperator, ApplyAddRange),
       CEED_FTABLE_ENTRY(CeedOperator, ApplyJacobian),
+      CEED_FTABLE_ENTRY(CeedOperator, SetPrecision),
       CEED_FTABLE_ENTRY(CeedOperator, Destroy),
       {NULL, 0}  // End of lookup table - used in SetBackendFunction loop
   };
@@ -900,6 +1138,21 @@ int CeedInit(const char *resource, Ceed *ceed) {
   // Note: there will always be the default root for every Ceed but all additional paths are added to the top-most parent
   CeedCall(CeedAddJitSourceRoot(*ceed, (char *)CeedJitSourceRootDefault));
 
+  // Set JiT cache directory from env variable CEED_JIT_CACHE_DIR, if any
+  const char *jit_cache_dir = getenv("CEED_JIT_CACHE_DIR");
+  if (jit_cache_dir && jit_cache_dir[0]) CeedCall(CeedSetJitCacheDirectory(*ceed, jit_cache_dir));
+
+  // Enable profiling from env variable CEED_PROFILE, if any
+  const char *profile = getenv("CEED_PROFILE");
+  if (profile && profile[0]) CeedCall(CeedSetProfiling(*ceed, strcmp(profile, "json") ? CEED_PROFILE_TABLE : CEED_PROFILE_JSON));
+
+  // Set host memory policy from env variable CEED_HOST_MEMORY, if any
+  const char *host_memory = getenv("CEED_HOST_MEMORY");
+  if (host_memory && host_memory[0]) {
+    CeedCall(CeedSetHostMemoryPolicy(*ceed, (strstr(host_memory, "hugepages") ? CEED_HOST_MEMORY_HUGE_PAGES : 0) |
+                                                (strstr(host_memory, "firsttouch") ? CEED_HOST_MEMORY_FIRST_TOUCH : 0)));
+  }
+
   // Backend specific setup
   CeedCall(backends[match_index].init(&resource[match_help], *ceed));
 
@@ -1008,6 +1261,70 @@ int CeedAddJitSourceRoot(Ceed ceed, const char *jit_source_root) {
   return CEED_ERROR_SUCCESS;
 }
 
+/**
+  @brief Set directory for caching compiled JiT kernels between runs.
+           Backends that compile kernels at runtime store them in this directory, keyed on the kernel source, compiler options, and compiler.
+           The directory is created if needed and may be shared by concurrent processes.
+           The default is the value of the environment variable `CEED_JIT_CACHE_DIR`; if it is unset, compiled kernels are not cached.
+
+  @param[in,out] ceed          Ceed
+  @param[in]     jit_cache_dir Path to JiT cache directory, or NULL to disable caching
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetJitCacheDirectory(Ceed ceed, const char *jit_cache_dir) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  CeedCall(CeedFree(&ceed_parent->jit_cache_dir));
+  if (jit_cache_dir) CeedCall(CeedStringAllocCopy(jit_cache_dir, &ceed_parent->jit_cache_dir));
+
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Set the policy for allocating host arrays of CeedVectors.
+           The policy applies to arrays allocated by the backend after this call, including E-vectors and assembled CeedQFunction data.
+           The default is the value of the environment variable `CEED_HOST_MEMORY`, a comma separated list of `hugepages` and `firsttouch`.
+
+  Note: With @ref CEED_HOST_MEMORY_FIRST_TOUCH, threaded backends zero new arrays in parallel with the same static partition as their element
+    loops, so threads should be bound to cores, e.g. with `OMP_PROC_BIND`, for the pages to stay on the NUMA node that uses them.
+
+  @param[in,out] ceed   Ceed
+  @param[in]     policy Bitwise or of @ref CeedHostMemoryPolicy values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedSetHostMemoryPolicy(Ceed ceed, int policy) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  ceed_parent->host_memory_policy = policy;
+  return CEED_ERROR_SUCCESS;
+}
+
+/**
+  @brief Get the policy for allocating host arrays of CeedVectors
+
+  @param[in]  ceed   Ceed
+  @param[out] policy Variable to store bitwise or of @ref CeedHostMemoryPolicy values
+
+  @return An error code: 0 - success, otherwise - failure
+
+  @ref User
+**/
+int CeedGetHostMemoryPolicy(Ceed ceed, int *policy) {
+  Ceed ceed_parent;
+
+  CeedCall(CeedGetParent(ceed, &ceed_parent));
+  *policy = ceed_parent->host_memory_policy;
+  return CEED_ERROR_SUCCESS;
+}
+
 /**
   @brief View a Ceed
 
@@ -1041,10 +1358,23 @@ int CeedView(Ceed ceed, FILE *stream) {
   @ref User
 **/
 int CeedDestroy(Ceed *ceed) {
-  if (!*ceed || --(*ceed)->ref_count > 0) {
+  if (!*ceed) return CEED_ERROR_SUCCESS;
+  // Unused work vectors hold references to the Ceed, so they are destroyed once they hold all references besides this one
+  if ((*ceed)->work_vectors.num_vecs > 0) {
+    CeedInt num_work_refs;
+
+    CeedCall(CeedWorkVectorsGetNumReferences(*ceed, &num_work_refs));
+    if ((*ceed)->ref_count == 1 + num_work_refs) CeedCall(CeedWorkVectorsClear(*ceed, 0));
+  }
+  if (--(*ceed)->ref_count > 0) {
     *ceed = NULL;
     return CEED_ERROR_SUCCESS;
   }
+  CeedCall(CeedFree(&(*ceed)->work_vectors.is_in_use));
+  CeedCall(CeedFree(&(*ceed)->work_vectors.vecs));
+  CeedCall(CeedRequestQueueDestroy(*ceed));
+  CeedCall(CeedThreadLockDestroy(*ceed));
+  CeedCall(CeedProfileDestroy(*ceed));
   if ((*ceed)->delegate) CeedCall(CeedDestroy(&(*ceed)->delegate));
 
   if ((*ceed)->obj_delegate_count > 0) {
@@ -1061,6 +1391,7 @@ int CeedDestroy(Ceed *ceed) {
     CeedCall(CeedFree(&(*ceed)->jit_source_roots[i]));
   }
   CeedCall(CeedFree(&(*ceed)->jit_source_roots));
+  CeedCall(CeedFree(&(*ceed)->jit_cache_dir));
 
   CeedCall(CeedFree(&(*ceed)->f_offsets));
   CeedCall(CeedFree(&(*ceed)->resource));
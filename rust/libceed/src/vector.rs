@@ -594,6 +594,65 @@ impl<'a> Vector<'a> {
         Ok(res)
     }
 
+    /// Return the dot product of two Vectors
+    ///
+    /// # arguments
+    ///
+    /// * `y` - second vector, may be the same as self
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # fn main() -> libceed::Result<()> {
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let x = ceed.vector_from_slice(&[1., 2., 3., 4.])?;
+    /// let y = ceed.vector_from_slice(&[1., 1., 1., 1.])?;
+    ///
+    /// let dot = x.dot(&y)?;
+    /// assert_eq!(dot, 10., "Incorrect dot product");
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn dot(&self, y: &crate::Vector) -> crate::Result<crate::Scalar> {
+        let mut res: crate::Scalar = 0.0;
+        let ierr = unsafe { bind_ceed::CeedVectorDot(self.ptr, y.ptr, &mut res) };
+        self.check_error(ierr)?;
+        Ok(res)
+    }
+
+    /// Return the dot products of a Vector with several Vectors in a single
+    /// pass over self
+    ///
+    /// # arguments
+    ///
+    /// * `y` - vectors to take the dot product with self
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # fn main() -> libceed::Result<()> {
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let x = ceed.vector_from_slice(&[1., 2., 3., 4.])?;
+    /// let y = ceed.vector_from_slice(&[1., 1., 1., 1.])?;
+    ///
+    /// let dots = x.mdot(&[&y, &x])?;
+    /// assert_eq!(dots, vec![10., 30.], "Incorrect dot products");
+    /// # Ok(())
+    /// # }
+    /// ```
+    pub fn mdot(&self, y: &[&crate::Vector]) -> crate::Result<Vec<crate::Scalar>> {
+        let mut res: Vec<crate::Scalar> = vec![0.0; y.len()];
+        let mut y_ptrs: Vec<bind_ceed::CeedVector> = y.iter().map(|v| v.ptr).collect();
+        let ierr = unsafe {
+            bind_ceed::CeedVectorMDot(
+                self.ptr,
+                i32::try_from(y.len()).unwrap(),
+                y_ptrs.as_mut_ptr(),
+                res.as_mut_ptr(),
+            )
+        };
+        self.check_error(ierr)?;
+        Ok(res)
+    }
+
     /// Compute x = alpha x for a Vector
     ///
     /// # arguments
@@ -648,6 +707,49 @@ impl<'a> Vector<'a> {
         Ok(self)
     }
 
+    /// Compute y = sum_j alpha_j x_j + y for several Vectors in a single pass
+    /// over self
+    ///
+    /// # arguments
+    ///
+    /// * `alpha` - scaling factors
+    /// * `x`     - vectors to add, must be different than self
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # fn main() -> libceed::Result<()> {
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let x_0 = ceed.vector_from_slice(&[0., 1., 2., 3., 4.])?;
+    /// let x_1 = ceed.vector_from_slice(&[1., 1., 1., 1., 1.])?;
+    /// let mut y = ceed.vector_from_slice(&[0., 1., 2., 3., 4.])?;
+    ///
+    /// y = y.maxpy(&[2.0, -1.0], &[&x_0, &x_1])?;
+    /// for (i, y) in y.view()?.iter().enumerate() {
+    ///     assert_eq!(*y, (i as Scalar) * 3.0 - 1.0, "Value not set correctly");
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    #[allow(unused_mut)]
+    pub fn maxpy(mut self, alpha: &[crate::Scalar], x: &[&crate::Vector]) -> crate::Result<Self> {
+        assert_eq!(
+            alpha.len(),
+            x.len(),
+            "Number of scaling factors and vectors must match"
+        );
+        let mut x_ptrs: Vec<bind_ceed::CeedVector> = x.iter().map(|v| v.ptr).collect();
+        let ierr = unsafe {
+            bind_ceed::CeedVectorMAXPY(
+                self.ptr,
+                i32::try_from(x.len()).unwrap(),
+                alpha.as_ptr(),
+                x_ptrs.as_mut_ptr(),
+            )
+        };
+        self.check_error(ierr)?;
+        Ok(self)
+    }
+
     /// Compute y = alpha x + beta y for a pair of Vectors
     ///
     /// # arguments
@@ -682,6 +784,47 @@ impl<'a> Vector<'a> {
         Ok(self)
     }
 
+    /// Compute z = alpha x + beta y + gamma z for three Vectors in a single
+    /// pass over self
+    ///
+    /// # arguments
+    ///
+    /// * `alpha` - first scaling factor
+    /// * `beta`  - second scaling factor
+    /// * `gamma` - third scaling factor, self is not read if zero
+    /// * `x`     - first vector, must be different than self
+    /// * `y`     - second vector, must be different than self
+    ///
+    /// ```
+    /// # use libceed::prelude::*;
+    /// # fn main() -> libceed::Result<()> {
+    /// # let ceed = libceed::Ceed::default_init();
+    /// let x = ceed.vector_from_slice(&[0., 1., 2., 3., 4.])?;
+    /// let y = ceed.vector_from_slice(&[1., 1., 1., 1., 1.])?;
+    /// let mut z = ceed.vector_from_slice(&[0., 1., 2., 3., 4.])?;
+    ///
+    /// z = z.axpbypcz(2.0, -1.0, 0.5, &x, &y)?;
+    /// for (i, z) in z.view()?.iter().enumerate() {
+    ///     assert_eq!(*z, (i as Scalar) * 2.5 - 1.0, "Value not set correctly");
+    /// }
+    /// # Ok(())
+    /// # }
+    /// ```
+    #[allow(unused_mut)]
+    pub fn axpbypcz(
+        mut self,
+        alpha: crate::Scalar,
+        beta: crate::Scalar,
+        gamma: crate::Scalar,
+        x: &crate::Vector,
+        y: &crate::Vector,
+    ) -> crate::Result<Self> {
+        let ierr =
+            unsafe { bind_ceed::CeedVectorAXPBYPCZ(self.ptr, alpha, beta, gamma, x.ptr, y.ptr) };
+        self.check_error(ierr)?;
+        Ok(self)
+    }
+
     /// Compute the pointwise multiplication w = x .* y for Vectors
     ///
     /// # arguments
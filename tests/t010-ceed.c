@@ -0,0 +1,73 @@
+/// @file
+/// Test JiT cache of compiled kernels
+/// \test Test JiT cache of compiled kernels
+#define _POSIX_C_SOURCE 200809L
+#include <ceed.h>
+#include <ceed/jit-tools.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+  Ceed        ceed;
+  char        cache_dir[] = "/tmp/ceed-t010-XXXXXX";
+  char       *cache_path, *cache_path_2, *buffer;
+  size_t      buffer_size;
+  const char *source = "int kernel(void) { return 0; }", *compiled = "mock compiler output";
+
+  CeedInit(argv[1], &ceed);
+  if (!mkdtemp(cache_dir)) {
+    // LCOV_EXCL_START
+    printf("Could not create temporary directory\n");
+    return 1;
+    // LCOV_EXCL_STOP
+  }
+  CeedSetJitCacheDirectory(ceed, cache_dir);
+
+  // Empty cache
+  CeedGetJitCachePath(ceed, source, "-O2", "mock 1.0", ".bin", &cache_path);
+  if (!cache_path) printf("No JiT cache path with cache directory set\n");
+  CeedReadJitCache(ceed, cache_path, &buffer, &buffer_size);
+  if (buffer) printf("Kernel found in empty JiT cache\n");
+
+  // Write and read back
+  CeedWriteJitCache(ceed, cache_path, compiled, strlen(compiled));
+  CeedReadJitCache(ceed, cache_path, &buffer, &buffer_size);
+  if (!buffer) {
+    // LCOV_EXCL_START
+    printf("Kernel not found in JiT cache after write\n");
+    // LCOV_EXCL_STOP
+  } else if (buffer_size != strlen(compiled) || memcmp(buffer, compiled, buffer_size)) {
+    // LCOV_EXCL_START
+    printf("Incorrect kernel read from JiT cache\n");
+    // LCOV_EXCL_STOP
+  }
+  free(buffer);
+
+  // Same key gives same path
+  CeedGetJitCachePath(ceed, source, "-O2", "mock 1.0", ".bin", &cache_path_2);
+  if (strcmp(cache_path, cache_path_2)) printf("JiT cache path differs for identical kernels\n");
+  free(cache_path_2);
+
+  // Different options or compiler give different paths
+  CeedGetJitCachePath(ceed, source, "-O3", "mock 1.0", ".bin", &cache_path_2);
+  if (!strcmp(cache_path, cache_path_2)) printf("JiT cache path does not depend on options\n");
+  free(cache_path_2);
+  CeedGetJitCachePath(ceed, source, "-O2", "mock 1.1", ".bin", &cache_path_2);
+  if (!strcmp(cache_path, cache_path_2)) printf("JiT cache path does not depend on compiler\n");
+  CeedReadJitCache(ceed, cache_path_2, &buffer, &buffer_size);
+  if (buffer) printf("Kernel found in JiT cache for different compiler\n");
+  free(cache_path_2);
+
+  // Disable cache
+  CeedSetJitCacheDirectory(ceed, NULL);
+  CeedGetJitCachePath(ceed, source, "-O2", "mock 1.0", ".bin", &cache_path_2);
+  if (cache_path_2) printf("JiT cache path without cache directory\n");
+
+  remove(cache_path);
+  free(cache_path);
+  rmdir(cache_dir);
+  CeedDestroy(&ceed);
+  return 0;
+}
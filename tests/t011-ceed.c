@@ -0,0 +1,55 @@
+/// @file
+/// Test host memory policy for CeedVector arrays
+/// \test Test host memory policy for CeedVector arrays
+#include <ceed.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y;
+  CeedInt    len_small = 10, len_large = 1 << 19;
+  int        policy;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedSetHostMemoryPolicy(ceed, CEED_HOST_MEMORY_HUGE_PAGES | CEED_HOST_MEMORY_FIRST_TOUCH);
+  CeedGetHostMemoryPolicy(ceed, &policy);
+  if (policy != (CEED_HOST_MEMORY_HUGE_PAGES | CEED_HOST_MEMORY_FIRST_TOUCH)) printf("Incorrect host memory policy: %d\n", policy);
+
+  // Arrays below and above the huge page size
+  CeedVectorCreate(ceed, len_small, &x);
+  CeedVectorCreate(ceed, len_large, &y);
+  CeedVectorSetValue(x, 1.0);
+  {
+    const CeedScalar *read_array;
+    CeedScalar       *write_array;
+
+    CeedVectorGetArrayWrite(y, CEED_MEM_HOST, &write_array);
+    for (CeedInt i = 0; i < len_large; i++) write_array[i] = i;
+    CeedVectorRestoreArray(y, &write_array);
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len_small; i++) {
+      if (read_array[i] != 1.0) {
+        // LCOV_EXCL_START
+        printf("Error reading array x[%" CeedInt_FMT "] = %f\n", i, (CeedScalar)read_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &read_array);
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len_large; i++) {
+      if (read_array[i] != i) {
+        // LCOV_EXCL_START
+        printf("Error reading array y[%" CeedInt_FMT "] = %f\n", i, (CeedScalar)read_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &read_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedDestroy(&ceed);
+  return 0;
+}
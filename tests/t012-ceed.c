@@ -0,0 +1,48 @@
+/// @file
+/// Test work vector reuse, clearing, and destruction with the Ceed context
+/// \test Test work vector reuse, clearing, and destruction with the Ceed context
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, work_1, work_2, work_large, saved_1, saved_2;
+
+  CeedInit(argv[1], &ceed);
+
+  // Restored work vectors are reused for the same length
+  CeedGetWorkVector(ceed, 10, &work_1);
+  saved_1 = work_1;
+  CeedRestoreWorkVector(ceed, &work_1);
+  if (work_1) printf("Work vector not set to NULL on restore\n");
+  CeedGetWorkVector(ceed, 10, &work_1);
+  if (work_1 != saved_1) printf("Restored work vector not reused\n");
+
+  // Work vectors in use are not shared
+  CeedGetWorkVector(ceed, 10, &work_2);
+  if (work_2 == work_1) printf("Work vector in use handed out twice\n");
+  saved_2 = work_2;
+  CeedGetWorkVector(ceed, 20, &work_large);
+  CeedVectorSetValue(work_large, 1.0);
+  CeedRestoreWorkVector(ceed, &work_1);
+  CeedRestoreWorkVector(ceed, &work_2);
+  CeedRestoreWorkVector(ceed, &work_large);
+
+  // Clearing long work vectors keeps the shorter ones
+  CeedClearWorkVectors(ceed, 15);
+  CeedGetWorkVector(ceed, 10, &work_1);
+  CeedGetWorkVector(ceed, 10, &work_2);
+  if ((work_1 != saved_1 || work_2 != saved_2) && (work_1 != saved_2 || work_2 != saved_1)) printf("Short work vectors not kept on clear\n");
+  CeedRestoreWorkVector(ceed, &work_1);
+  CeedRestoreWorkVector(ceed, &work_2);
+
+  // The Ceed context and its work vectors are destroyed with the last CeedVector
+  CeedVectorCreate(ceed, 10, &x);
+  CeedVectorSetValue(x, 1.0);
+  CeedGetWorkVector(ceed, 20, &work_large);
+  CeedRestoreWorkVector(ceed, &work_large);
+  CeedDestroy(&ceed);
+  CeedVectorDestroy(&x);
+  return 0;
+}
@@ -0,0 +1,93 @@
+/// @file
+/// Test dot products and fused multi-vector sums
+/// \test Test dot products and fused multi-vector sums
+#include <ceed.h>
+#include <math.h>
+
+int main(int argc, char **argv) {
+  Ceed       ceed;
+  CeedVector x, y, z, vecs[2];
+  CeedInt    len = 10;
+  CeedScalar dot, dots[2], alpha[2] = {2.0, -1.0};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, len, &x);
+  CeedVectorCreate(ceed, len, &y);
+  CeedVectorCreate(ceed, len, &z);
+  {
+    CeedScalar array[len];
+
+    for (CeedInt i = 0; i < len; i++) array[i] = 10 + i;
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, array);
+    for (CeedInt i = 0; i < len; i++) array[i] = i;
+    CeedVectorSetArray(y, CEED_MEM_HOST, CEED_COPY_VALUES, array);
+  }
+
+  // Dot products, sum_i (10 + i) i = 735 and sum_i (10 + i)^2 = 2185
+  CeedVectorDot(x, y, &dot);
+  if (fabs(dot - 735.) > 1e-12) printf("Error in x . y, computed: %f actual: %f\n", dot, 735.);
+  vecs[0] = y;
+  vecs[1] = x;
+  CeedVectorMDot(x, 2, vecs, dots);
+  if (fabs(dots[0] - 735.) > 1e-12 || fabs(dots[1] - 2185.) > 1e-12) {
+    // LCOV_EXCL_START
+    printf("Error in x . [y, x], computed: [%f, %f] actual: [%f, %f]\n", dots[0], dots[1], 735., 2185.);
+    // LCOV_EXCL_STOP
+  }
+
+  // z = 2 x - y + z
+  CeedVectorSetValue(z, 1.0);
+  vecs[0] = x;
+  vecs[1] = y;
+  CeedVectorMAXPY(z, 2, alpha, vecs);
+  {
+    const CeedScalar *read_array;
+
+    CeedVectorGetArrayRead(z, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len; i++) {
+      if (fabs(read_array[i] - (21.0 + i)) > 1e-14) {
+        // LCOV_EXCL_START
+        printf("Error in sum alpha_j x_j + y at index %" CeedInt_FMT ", computed: %f actual: %f\n", i, read_array[i], 21.0 + i);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(z, &read_array);
+  }
+
+  // z = 0.5 x + 2 y - z, then z = x - y with z not read
+  CeedVectorAXPBYPCZ(z, 0.5, 2.0, -1.0, x, y);
+  {
+    const CeedScalar *read_array;
+
+    CeedVectorGetArrayRead(z, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len; i++) {
+      if (fabs(read_array[i] - (1.5 * i - 16.0)) > 1e-14) {
+        // LCOV_EXCL_START
+        printf("Error in alpha x + beta y + gamma z at index %" CeedInt_FMT ", computed: %f actual: %f\n", i, read_array[i], 1.5 * i - 16.0);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(z, &read_array);
+  }
+  CeedVectorAXPBYPCZ(z, 1.0, -1.0, 0.0, x, y);
+  {
+    const CeedScalar *read_array;
+
+    CeedVectorGetArrayRead(z, CEED_MEM_HOST, &read_array);
+    for (CeedInt i = 0; i < len; i++) {
+      if (fabs(read_array[i] - 10.0) > 1e-14) {
+        // LCOV_EXCL_START
+        printf("Error in alpha x + beta y at index %" CeedInt_FMT ", computed: %f actual: %f\n", i, read_array[i], 10.0);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(z, &read_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedVectorDestroy(&z);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,80 @@
+/// @file
+/// Test creation, use, and destruction of a multi-component element restriction with 64-bit offsets
+/// \test Test creation, use, and destruction of a multi-component element restriction with 64-bit offsets
+#include <ceed.h>
+#include <ceed/backend.h>
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedVector          x, y;
+  CeedInt             num_elem = 3, num_comp = 2;
+  CeedSize            num_nodes = num_elem + 1;
+  CeedSize            ind[2 * num_elem];
+  CeedScalar          x_array[num_comp * (num_elem + 1)];
+  CeedInt             layout[3];
+  CeedElemRestriction elem_restriction;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_comp * num_nodes, &x);
+  for (CeedInt i = 0; i < num_comp * num_nodes; i++) x_array[i] = 10 + i;
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_comp * num_elem * 2, &y);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind[2 * i + 0] = i;
+    ind[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate64(ceed, num_elem, 2, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                              &elem_restriction);
+
+  // NoTranspose
+  CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *y_array;
+
+    CeedVectorGetArrayRead(y, CEED_MEM_HOST, &y_array);
+    CeedElemRestrictionGetELayout(elem_restriction, &layout);
+    for (CeedInt i = 0; i < 2; i++) {             // Node
+      for (CeedInt j = 0; j < num_comp; j++) {    // Component
+        for (CeedInt k = 0; k < num_elem; k++) {  // Element
+          CeedInt index = i * layout[0] + j * layout[1] + k * layout[2];
+          if (y_array[index] != x_array[ind[k * 2 + i] + j * num_nodes]) {
+            // LCOV_EXCL_START
+            printf("Error in restricted array y[%" CeedInt_FMT "][%" CeedInt_FMT "][%" CeedInt_FMT "] = %f\n", i, j, k, (double)y_array[index]);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(y, &y_array);
+  }
+
+  // Transpose
+  CeedVectorSetValue(x, 0);
+  CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+  {
+    const CeedScalar *x_array;
+
+    CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+    for (CeedInt j = 0; j < num_comp; j++) {
+      for (CeedInt i = 0; i < num_nodes; i++) {
+        CeedScalar expected = (10 + i + j * num_nodes) * (i > 0 && i < num_elem ? 2.0 : 1.0);
+        if (x_array[i + j * num_nodes] != expected) {
+          // LCOV_EXCL_START
+          printf("Error in restricted array x[%" CeedInt_FMT "][%" CeedInt_FMT "] = %f != %f\n", j, i, (double)x_array[i + j * num_nodes],
+                 (double)expected);
+          // LCOV_EXCL_STOP
+        }
+      }
+    }
+    CeedVectorRestoreArrayRead(x, &x_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&y);
+  CeedElemRestrictionDestroy(&elem_restriction);
+  CeedDestroy(&ceed);
+  return 0;
+}
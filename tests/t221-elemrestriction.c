@@ -0,0 +1,66 @@
+/// @file
+/// Test blocked element restrictions with specialized and generic block sizes
+/// \test Test blocked element restrictions with specialized and generic block sizes
+#include <ceed.h>
+
+int main(int argc, char **argv) {
+  Ceed    ceed;
+  CeedInt num_elem = 20, elem_size = 2;
+  // Block size 16 uses specialized kernels, while 11 components with block size 6 must use the generic kernel
+  CeedInt num_comps[2] = {3, 11}, blk_sizes[2] = {16, 6};
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt t = 0; t < 2; t++) {
+    CeedVector          x, y;
+    CeedInt             num_comp = num_comps[t], blk_size = blk_sizes[t], num_nodes = num_elem + 1;
+    CeedInt             ind[elem_size * num_elem];
+    CeedElemRestriction elem_restriction;
+
+    CeedVectorCreate(ceed, num_nodes * num_comp, &x);
+    {
+      CeedScalar x_array[num_nodes * num_comp];
+
+      for (CeedInt i = 0; i < num_nodes * num_comp; i++) x_array[i] = 10 + i;
+      CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+    }
+
+    for (CeedInt i = 0; i < num_elem; i++) {
+      ind[2 * i + 0] = i;
+      ind[2 * i + 1] = i + 1;
+    }
+    CeedElemRestrictionCreateBlocked(ceed, num_elem, elem_size, blk_size, num_comp, num_nodes, num_nodes * num_comp, CEED_MEM_HOST,
+                                     CEED_USE_POINTER, ind, &elem_restriction);
+    CeedElemRestrictionCreateVector(elem_restriction, NULL, &y);
+
+    // NoTranspose followed by Transpose sums the values of each node over its elements
+    CeedElemRestrictionApply(elem_restriction, CEED_NOTRANSPOSE, x, y, CEED_REQUEST_IMMEDIATE);
+    CeedVectorSetValue(x, 0);
+    CeedElemRestrictionApply(elem_restriction, CEED_TRANSPOSE, y, x, CEED_REQUEST_IMMEDIATE);
+    {
+      const CeedScalar *x_array;
+
+      CeedVectorGetArrayRead(x, CEED_MEM_HOST, &x_array);
+      for (CeedInt k = 0; k < num_comp; k++) {
+        for (CeedInt i = 0; i < num_nodes; i++) {
+          CeedInt index = i + k * num_nodes;
+
+          if (x_array[index] != (10 + index) * (i > 0 && i < num_elem ? 2.0 : 1.0)) {
+            // LCOV_EXCL_START
+            printf("Error in restricted array x[%" CeedInt_FMT "] = %f for %" CeedInt_FMT " components and block size %" CeedInt_FMT "\n", index,
+                   (double)x_array[index], num_comp, blk_size);
+            // LCOV_EXCL_STOP
+          }
+        }
+      }
+      CeedVectorRestoreArrayRead(x, &x_array);
+    }
+
+    CeedVectorDestroy(&x);
+    CeedVectorDestroy(&y);
+    CeedElemRestrictionDestroy(&elem_restriction);
+  }
+
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,164 @@
+/// @file
+/// Test application of mass matrix operator split into interior and ghost elements
+/// \test Test application of mass matrix operator split into interior and ghost elements
+#include <ceed.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v, v_split, ghost_mask;
+  CeedRequest         request;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedInt             num_ghost_elem, ghost_elems[num_elem];
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_split);
+  CeedVectorCreate(ceed, num_nodes_u, &ghost_mask);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Ghost nodes only in first and last elements
+  {
+    CeedScalar mask_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) mask_array[i] = (i < p - 1 || i == num_nodes_u - 1) ? 1.0 : 0.0;
+    CeedVectorSetArray(ghost_mask, CEED_MEM_HOST, CEED_COPY_VALUES, mask_array);
+  }
+  CeedElemRestrictionGetGhostElements(elem_restriction_u, ghost_mask, &num_ghost_elem, ghost_elems);
+  if (num_ghost_elem != 2 || ghost_elems[0] != 0 || ghost_elems[1] != num_elem - 1) {
+    // LCOV_EXCL_START
+    printf("Incorrect ghost elements:");
+    for (CeedInt i = 0; i < num_ghost_elem; i++) printf(" %" CeedInt_FMT, ghost_elems[i]);
+    printf("\n");
+    // LCOV_EXCL_STOP
+  }
+  CeedOperatorSetGhostElements(op_mass, num_ghost_elem, ghost_elems);
+
+  // Reference application
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = (CeedScalar)i / (num_nodes_u - 1);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Interior elements with invalid ghost values, then ghost elements with valid ghost values
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (i < p - 1 || i == num_nodes_u - 1) u_array[i] = NAN;
+    }
+    CeedVectorRestoreArray(u, &u_array);
+  }
+  CeedOperatorApplyInterior(op_mass, u, v_split, &request);
+  CeedRequestWait(&request);
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArray(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = (CeedScalar)i / (num_nodes_u - 1);
+    CeedVectorRestoreArray(u, &u_array);
+  }
+  CeedOperatorApplyAddGhost(op_mass, u, v_split, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_split_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_split, CEED_MEM_HOST, &v_split_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (!(fabs(v_array[i] - v_split_array[i]) <= 100. * CEED_EPSILON)) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Interior and ghost value %f != full value %f\n", i, v_split_array[i], v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_split, &v_split_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_split);
+  CeedVectorDestroy(&ghost_mask);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,177 @@
+/// @file
+/// Test application of mass matrix operator on ranges of elements
+/// \test Test application of mass matrix operator on ranges of elements
+#include <ceed.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+
+typedef struct {
+  CeedOperator op;
+  CeedInt      elem_start, elem_stop;
+  CeedVector   u, v;
+} RangeApply;
+
+static void *apply_range(void *arg) {
+  RangeApply *range = arg;
+
+  CeedOperatorApplyAddRange(range->op, range->elem_start, range->elem_stop, range->u, range->v, CEED_REQUEST_IMMEDIATE);
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v, v_range, v_threads[3];
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedInt             elem_ranges[4] = {0, 4, 11, num_elem};
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_range);
+  for (CeedInt i = 0; i < 3; i++) CeedVectorCreate(ceed, num_nodes_u, &v_threads[i]);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Reference application
+  {
+    CeedScalar u_array[num_nodes_u];
+
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = (CeedScalar)i / (num_nodes_u - 1);
+    CeedVectorSetArray(u, CEED_MEM_HOST, CEED_COPY_VALUES, u_array);
+  }
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+
+  // Sum of element ranges, not aligned with backend block sizes, applied twice to reuse any per-range data
+  CeedVectorSetValue(v_range, 0.0);
+  for (CeedInt k = 0; k < 2; k++) {
+    for (CeedInt i = 0; i < 3; i++) CeedOperatorApplyAddRange(op_mass, elem_ranges[i], elem_ranges[i + 1], u, v_range, CEED_REQUEST_IMMEDIATE);
+  }
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_range_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_range, CEED_MEM_HOST, &v_range_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (!(fabs(2 * v_array[i] - v_range_array[i]) <= 200. * CEED_EPSILON)) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Sum of ranges value %f != twice full value %f\n", i, v_range_array[i], 2 * v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_range, &v_range_array);
+  }
+
+  // Concurrent application of element ranges, each thread sums into its own output vector
+  for (CeedInt i = 0; i < 3; i++) CeedVectorSetValue(v_threads[i], 0.0);
+  for (CeedInt k = 0; k < 2; k++) {
+    pthread_t  threads[3];
+    RangeApply ranges[3];
+
+    for (CeedInt i = 0; i < 3; i++) {
+      ranges[i] = (RangeApply){op_mass, elem_ranges[i], elem_ranges[i + 1], u, v_threads[i]};
+      pthread_create(&threads[i], NULL, apply_range, &ranges[i]);
+    }
+    for (CeedInt i = 0; i < 3; i++) pthread_join(threads[i], NULL);
+  }
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_threads_array[3];
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < 3; i++) CeedVectorGetArrayRead(v_threads[i], CEED_MEM_HOST, &v_threads_array[i]);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      const CeedScalar v_sum = v_threads_array[0][i] + v_threads_array[1][i] + v_threads_array[2][i];
+
+      if (!(fabs(2 * v_array[i] - v_sum) <= 200. * CEED_EPSILON)) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Sum of concurrent ranges value %f != twice full value %f\n", i, v_sum, 2 * v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    for (CeedInt i = 0; i < 3; i++) CeedVectorRestoreArrayRead(v_threads[i], &v_threads_array[i]);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_range);
+  for (CeedInt i = 0; i < 3; i++) CeedVectorDestroy(&v_threads[i]);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,157 @@
+/// @file
+/// Test profiling of mass matrix operator application and diagonal assembly
+/// \test Test profiling of mass matrix operator application and diagonal assembly
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "t500-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass;
+  CeedOperator        op_setup, op_mass;
+  CeedVector          q_data, x, u, v, v_diag;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+
+  CeedInit(argv[1], &ceed);
+  CeedSetProfiling(ceed, CEED_PROFILE_TABLE);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  {
+    CeedScalar x_array[num_nodes_x];
+
+    for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_diag);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorSetField(op_mass, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetName(op_mass, "mass");
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Profiled application and assembly
+  CeedVectorSetValue(u, 1.0);
+  for (CeedInt i = 0; i < 3; i++) CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorLinearAssembleDiagonal(op_mass, v_diag, CEED_REQUEST_IMMEDIATE);
+
+  // Failed basis application is not recorded and does not stop later applications from being recorded
+  {
+    const char *err_msg;
+    CeedScalar *u_e_array;
+    CeedVector  u_e, u_q;
+
+    CeedVectorCreate(ceed, p, &u_e);
+    CeedVectorCreate(ceed, q, &u_q);
+    CeedVectorSetValue(u_e, 1.0);
+    CeedBasisApply(basis_u, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u_e, u_q);
+    CeedSetErrorHandler(ceed, CeedErrorStore);
+    CeedVectorGetArray(u_e, CEED_MEM_HOST, &u_e_array);
+    if (!CeedBasisApply(basis_u, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u_e, u_q)) printf("Basis application with inaccessible input did not fail\n");
+    CeedVectorRestoreArray(u_e, &u_e_array);
+    CeedResetErrorMessage(ceed, &err_msg);
+    CeedSetErrorHandler(ceed, CeedErrorAbort);
+    CeedBasisApply(basis_u, 1, CEED_NOTRANSPOSE, CEED_EVAL_INTERP, u_e, u_q);
+    CeedVectorDestroy(&u_e);
+    CeedVectorDestroy(&u_q);
+  }
+
+  // Check profile
+  {
+    FILE *stream = tmpfile();
+    char  buffer[8192] = {0};
+
+    CeedProfileView(ceed, CEED_PROFILE_JSON, stream);
+    rewind(stream);
+    fread(buffer, 1, sizeof(buffer) - 1, stream);
+    fclose(stream);
+    if (!strstr(buffer, "\"name\": \"mass\"")) printf("Operator name missing from profile\n");
+    if (!strstr(buffer, "\"apply\": {\"calls\": 3,")) printf("Operator application calls missing from profile\n");
+    if (!strstr(buffer, "\"assemble diagonal\": {\"calls\": 1,")) printf("Diagonal assembly missing from profile\n");
+    if (!strstr(buffer, "\"name\": \"(no operator)\", \"phases\": {\n      \"basis\": {\"calls\": 2,")) {
+      printf("Basis applications outside of operator missing from profile\n");
+    }
+  }
+
+  // Profiling does not change results
+  {
+    CeedScalar        sum = 0.0;
+    const CeedScalar *v_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) sum += v_array[i];
+    CeedVectorRestoreArrayRead(v, &v_array);
+    if (fabs(sum - 1.) > 1000. * CEED_EPSILON) printf("Computed Area: %f != True Area: 1.0\n", sum);
+  }
+
+  // Disable output at CeedDestroy
+  CeedSetProfiling(ceed, CEED_PROFILE_NONE);
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_diag);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedDestroy(&ceed);
+  return 0;
+}
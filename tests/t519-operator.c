@@ -0,0 +1,183 @@
+/// @file
+/// Test composite operators with sub-operators and active inputs sharing element restrictions
+/// \test Test composite operators with sub-operators and active inputs sharing element restrictions
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t500-operator.h"
+#include "t519-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_x, elem_restriction_u, elem_restriction_q_data;
+  CeedBasis           basis_x, basis_u;
+  CeedQFunction       qf_setup, qf_mass, qf_mass_diff;
+  CeedOperator        op_setup, op_mass, op_mass_1, op_mass_2, op_mass_diff, op_composite, op_composite_diff;
+  CeedVector          q_data, x, u, v, v_composite, v_diff, v_diff_composite;
+  CeedInt             num_elem = 15, p = 5, q = 8;
+  CeedInt             num_nodes_x = num_elem + 1, num_nodes_u = num_elem * (p - 1) + 1;
+  CeedInt             ind_x[num_elem * 2], ind_u[num_elem * p];
+  CeedScalar          x_array[num_nodes_x];
+
+  CeedInit(argv[1], &ceed);
+
+  for (CeedInt i = 0; i < num_nodes_x; i++) x_array[i] = (CeedScalar)i / (num_nodes_x - 1);
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_nodes_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) {
+      ind_u[p * i + j] = i * (p - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, 1, 1, num_nodes_u, CEED_MEM_HOST, CEED_USE_POINTER, ind_u, &elem_restriction_u);
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p, q, CEED_GAUSS, &basis_u);
+
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "rho", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass, mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionCreateInterior(ceed, 1, mass_diff, mass_diff_loc, &qf_mass_diff);
+  CeedQFunctionAddInput(qf_mass_diff, "rho", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass_diff, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddInput(qf_mass_diff, "du", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_mass_diff, "v", 1, CEED_EVAL_INTERP);
+
+  CeedVectorCreate(ceed, num_nodes_x, &x);
+  CeedVectorSetArray(x, CEED_MEM_HOST, CEED_USE_POINTER, x_array);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Reference operator and two sub-operators with the same active element restriction
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_1);
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_2);
+  CeedOperator ops[3] = {op_mass, op_mass_1, op_mass_2};
+  for (CeedInt i = 0; i < 3; i++) {
+    CeedOperatorSetField(ops[i], "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+    CeedOperatorSetField(ops[i], "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+    CeedOperatorSetField(ops[i], "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  }
+
+  CeedCompositeOperatorCreate(ceed, &op_composite);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_1);
+  CeedCompositeOperatorAddSub(op_composite, op_mass_2);
+
+  // Sub-operator with two active inputs on the same element restriction
+  CeedOperatorCreate(ceed, qf_mass_diff, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_diff);
+  CeedOperatorSetField(op_mass_diff, "rho", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass_diff, "u", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_diff, "du", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_diff, "v", elem_restriction_u, basis_u, CEED_VECTOR_ACTIVE);
+
+  CeedCompositeOperatorCreate(ceed, &op_composite_diff);
+  CeedCompositeOperatorAddSub(op_composite_diff, op_mass_1);
+  CeedCompositeOperatorAddSub(op_composite_diff, op_mass_diff);
+
+  CeedVectorCreate(ceed, num_nodes_u, &u);
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArrayWrite(u, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) u_array[i] = 1. + sin((CeedScalar)i);
+    CeedVectorRestoreArray(u, &u_array);
+  }
+  CeedVectorCreate(ceed, num_nodes_u, &v);
+  CeedVectorCreate(ceed, num_nodes_u, &v_composite);
+  CeedVectorCreate(ceed, num_nodes_u, &v_diff);
+  CeedVectorCreate(ceed, num_nodes_u, &v_diff_composite);
+
+  CeedOperatorApply(op_mass, u, v, CEED_REQUEST_IMMEDIATE);
+  // Apply twice, so the second application reuses the shared E-vectors, then add a third application
+  CeedOperatorApply(op_composite, u, v_composite, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_composite, u, v_composite, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_composite, u, v_composite, CEED_REQUEST_IMMEDIATE);
+
+  // The composite application must leave the sub-operator usable on its own
+  CeedOperatorApply(op_mass_diff, u, v_diff, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApply(op_composite_diff, u, v_diff_composite, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_mass_diff, u, v_diff, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_composite_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_composite, CEED_MEM_HOST, &v_composite_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      if (fabs(v_composite_array[i] - 4. * v_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Composite v %f != %f\n", i, v_composite_array[i], 4. * v_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_composite, &v_composite_array);
+  }
+  {
+    const CeedScalar *v_array, *v_diff_array, *v_diff_composite_array;
+
+    // Composite output is mass + diff, while the sub-operator alone was applied twice
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_diff, CEED_MEM_HOST, &v_diff_array);
+    CeedVectorGetArrayRead(v_diff_composite, CEED_MEM_HOST, &v_diff_composite_array);
+    for (CeedInt i = 0; i < num_nodes_u; i++) {
+      CeedScalar expected = v_array[i] + 0.5 * v_diff_array[i];
+
+      if (fabs(v_diff_composite_array[i] - expected) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Composite v with shared active inputs %f != %f\n", i, v_diff_composite_array[i], expected);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_diff, &v_diff_array);
+    CeedVectorRestoreArrayRead(v_diff_composite, &v_diff_composite_array);
+  }
+
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&u);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_composite);
+  CeedVectorDestroy(&v_diff);
+  CeedVectorDestroy(&v_diff_composite);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_x);
+  CeedBasisDestroy(&basis_u);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionDestroy(&qf_mass_diff);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass);
+  CeedOperatorDestroy(&op_mass_1);
+  CeedOperatorDestroy(&op_mass_2);
+  CeedOperatorDestroy(&op_mass_diff);
+  CeedOperatorDestroy(&op_composite);
+  CeedOperatorDestroy(&op_composite_diff);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,17 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+
+CEED_QFUNCTION(mass_diff)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *rho = in[0], *u = in[1], *du = in[2];
+  CeedScalar       *v = out[0];
+  for (CeedInt i = 0; i < Q; i++) {
+    v[i] = rho[i] * (u[i] + du[i]);
+  }
+  return 0;
+}
@@ -0,0 +1,104 @@
+/// @file
+/// Test operator output transpose restriction against the scatter of CeedElemRestrictionApply, with a partial last element block
+/// \test Test operator output transpose restriction against the scatter of CeedElemRestrictionApply, with a partial last element block
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "t527-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                ceed;
+  CeedElemRestriction elem_restriction_e, elem_restriction_u, elem_restriction_e_blk, elem_restriction_u_blk;
+  CeedQFunction       qf_scale;
+  CeedOperator        op_scale;
+  CeedVector          u_e, e_blk, v, v_scatter, v_scatter_blk;
+  // 13 elements do not fill the last block of 8, so the blocked restrictions have padding elements
+  CeedInt             num_elem = 13, p = 3, num_comp = 2, blk_size = 8;
+  CeedInt             num_nodes = num_elem * (p - 1), e_size = num_elem * p * num_comp;
+  CeedInt             ind[num_elem * p], strides[3] = {1, p, p * num_comp};
+
+  CeedInit(argv[1], &ceed);
+
+  // Periodic mesh, so every L-vector node is shared by two elements
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p; j++) ind[p * i + j] = (i * (p - 1) + j) % num_nodes;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind, &elem_restriction_u);
+  CeedElemRestrictionCreateBlocked(ceed, num_elem, p, blk_size, num_comp, num_nodes, num_comp * num_nodes, CEED_MEM_HOST, CEED_USE_POINTER, ind,
+                                   &elem_restriction_u_blk);
+  CeedElemRestrictionCreateStrided(ceed, num_elem, p, num_comp, e_size, strides, &elem_restriction_e);
+  CeedElemRestrictionCreateBlockedStrided(ceed, num_elem, p, blk_size, num_comp, e_size, strides, &elem_restriction_e_blk);
+
+  CeedQFunctionCreateInterior(ceed, 1, scale_two, scale_two_loc, &qf_scale);
+  CeedQFunctionAddInput(qf_scale, "u", num_comp, CEED_EVAL_NONE);
+  CeedQFunctionAddOutput(qf_scale, "v", num_comp, CEED_EVAL_NONE);
+
+  // Operator from element data to the L-vector, so its output is a transpose restriction
+  CeedOperatorCreate(ceed, qf_scale, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_scale);
+  CeedOperatorSetField(op_scale, "u", elem_restriction_e, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_scale, "v", elem_restriction_u, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetNumQuadraturePoints(op_scale, p);
+
+  CeedVectorCreate(ceed, e_size, &u_e);
+  {
+    CeedScalar *u_array;
+
+    CeedVectorGetArrayWrite(u_e, CEED_MEM_HOST, &u_array);
+    for (CeedInt i = 0; i < e_size; i++) u_array[i] = 1. + sin((CeedScalar)i);
+    CeedVectorRestoreArray(u_e, &u_array);
+  }
+  CeedVectorCreate(ceed, num_comp * num_nodes, &v);
+  CeedVectorCreate(ceed, num_comp * num_nodes, &v_scatter);
+  CeedVectorCreate(ceed, num_comp * num_nodes, &v_scatter_blk);
+  CeedElemRestrictionCreateVector(elem_restriction_e_blk, NULL, &e_blk);
+
+  // Operator output, applied and then added, so the restriction must add to the existing values
+  CeedOperatorApply(op_scale, u_e, v, CEED_REQUEST_IMMEDIATE);
+  CeedOperatorApplyAdd(op_scale, u_e, v, CEED_REQUEST_IMMEDIATE);
+
+  // Transpose restriction of the element data, directly and through the blocked restrictions
+  CeedVectorSetValue(v_scatter, 0.0);
+  CeedElemRestrictionApply(elem_restriction_u, CEED_TRANSPOSE, u_e, v_scatter, CEED_REQUEST_IMMEDIATE);
+  CeedElemRestrictionApply(elem_restriction_e_blk, CEED_NOTRANSPOSE, u_e, e_blk, CEED_REQUEST_IMMEDIATE);
+  CeedVectorSetValue(v_scatter_blk, 0.0);
+  CeedElemRestrictionApply(elem_restriction_u_blk, CEED_TRANSPOSE, e_blk, v_scatter_blk, CEED_REQUEST_IMMEDIATE);
+
+  // Check output
+  {
+    const CeedScalar *v_array, *v_scatter_array, *v_scatter_blk_array;
+
+    CeedVectorGetArrayRead(v, CEED_MEM_HOST, &v_array);
+    CeedVectorGetArrayRead(v_scatter, CEED_MEM_HOST, &v_scatter_array);
+    CeedVectorGetArrayRead(v_scatter_blk, CEED_MEM_HOST, &v_scatter_blk_array);
+    for (CeedInt i = 0; i < num_comp * num_nodes; i++) {
+      if (fabs(v_array[i] - 4. * v_scatter_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Operator v %f != %f\n", i, v_array[i], 4. * v_scatter_array[i]);
+        // LCOV_EXCL_STOP
+      }
+      if (fabs(v_scatter_blk_array[i] - v_scatter_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Blocked restriction v %f != %f\n", i, v_scatter_blk_array[i], v_scatter_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(v, &v_array);
+    CeedVectorRestoreArrayRead(v_scatter, &v_scatter_array);
+    CeedVectorRestoreArrayRead(v_scatter_blk, &v_scatter_blk_array);
+  }
+
+  CeedVectorDestroy(&u_e);
+  CeedVectorDestroy(&e_blk);
+  CeedVectorDestroy(&v);
+  CeedVectorDestroy(&v_scatter);
+  CeedVectorDestroy(&v_scatter_blk);
+  CeedElemRestrictionDestroy(&elem_restriction_e);
+  CeedElemRestrictionDestroy(&elem_restriction_u);
+  CeedElemRestrictionDestroy(&elem_restriction_e_blk);
+  CeedElemRestrictionDestroy(&elem_restriction_u_blk);
+  CeedQFunctionDestroy(&qf_scale);
+  CeedOperatorDestroy(&op_scale);
+  CeedDestroy(&ceed);
+  return 0;
+}
@@ -0,0 +1,205 @@
+/// @file
+/// Test reuse of cached multigrid level and CeedQFunction assembly for mass matrix operator
+/// \test Test reuse of cached multigrid level and CeedQFunction assembly for mass matrix operator
+#include <ceed.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "t555-operator.h"
+
+int main(int argc, char **argv) {
+  Ceed                  ceed;
+  CeedElemRestriction   elem_restriction_x, elem_restriction_q_data, elem_restriction_u_coarse, elem_restriction_u_fine;
+  CeedBasis             basis_x, basis_u_coarse, basis_u_fine;
+  CeedQFunction         qf_setup, qf_mass;
+  CeedQFunctionContext  qf_ctx;
+  CeedContextFieldLabel scale_label;
+  CeedOperator          op_setup, op_mass_coarse, op_mass_fine, op_prolong, op_restrict;
+  CeedOperator          op_mass_coarse_2, op_prolong_2, op_restrict_2;
+  CeedVector            q_data, x, u_coarse, v_coarse, p_mult_fine, diag_1, diag_2;
+  CeedInt               num_elem = 15, p_coarse = 3, p_fine = 5, q = 8;
+  CeedInt               num_dofs_x = num_elem + 1, num_dofs_u_coarse = num_elem * (p_coarse - 1) + 1, num_dofs_u_fine = num_elem * (p_fine - 1) + 1;
+  CeedInt               ind_u_coarse[num_elem * p_coarse], ind_u_fine[num_elem * p_fine], ind_x[num_elem * 2];
+  double                scale = 1.0, context[2] = {1.0, 0.0}, num_calls;
+
+  CeedInit(argv[1], &ceed);
+
+  CeedVectorCreate(ceed, num_dofs_x, &x);
+  {
+    CeedScalar x_array[num_dofs_x];
+
+    for (CeedInt i = 0; i < num_dofs_x; i++) x_array[i] = (CeedScalar)i / (num_dofs_x - 1);
+    CeedVectorSetArray(x, CEED_MEM_HOST, CEED_COPY_VALUES, x_array);
+  }
+  CeedVectorCreate(ceed, num_dofs_u_fine, &p_mult_fine);
+  CeedVectorCreate(ceed, num_dofs_u_coarse, &diag_1);
+  CeedVectorCreate(ceed, num_dofs_u_coarse, &diag_2);
+  CeedVectorCreate(ceed, num_dofs_u_coarse, &u_coarse);
+  CeedVectorCreate(ceed, num_dofs_u_coarse, &v_coarse);
+  CeedVectorSetValue(u_coarse, 1.0);
+  CeedVectorCreate(ceed, num_elem * q, &q_data);
+
+  // Restrictions
+  for (CeedInt i = 0; i < num_elem; i++) {
+    ind_x[2 * i + 0] = i;
+    ind_x[2 * i + 1] = i + 1;
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, 2, 1, 1, num_dofs_x, CEED_MEM_HOST, CEED_USE_POINTER, ind_x, &elem_restriction_x);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p_coarse; j++) {
+      ind_u_coarse[p_coarse * i + j] = i * (p_coarse - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p_coarse, 1, 1, num_dofs_u_coarse, CEED_MEM_HOST, CEED_USE_POINTER, ind_u_coarse,
+                            &elem_restriction_u_coarse);
+
+  for (CeedInt i = 0; i < num_elem; i++) {
+    for (CeedInt j = 0; j < p_fine; j++) {
+      ind_u_fine[p_fine * i + j] = i * (p_fine - 1) + j;
+    }
+  }
+  CeedElemRestrictionCreate(ceed, num_elem, p_fine, 1, 1, num_dofs_u_fine, CEED_MEM_HOST, CEED_USE_POINTER, ind_u_fine, &elem_restriction_u_fine);
+
+  CeedInt strides_q_data[3] = {1, q, q};
+  CeedElemRestrictionCreateStrided(ceed, num_elem, q, 1, q * num_elem, strides_q_data, &elem_restriction_q_data);
+
+  // Bases
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, 2, q, CEED_GAUSS, &basis_x);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p_coarse, q, CEED_GAUSS, &basis_u_coarse);
+  CeedBasisCreateTensorH1Lagrange(ceed, 1, 1, p_fine, q, CEED_GAUSS, &basis_u_fine);
+
+  // QFunctions
+  CeedQFunctionCreateInterior(ceed, 1, setup, setup_loc, &qf_setup);
+  CeedQFunctionAddInput(qf_setup, "weight", 1, CEED_EVAL_WEIGHT);
+  CeedQFunctionAddInput(qf_setup, "dx", 1, CEED_EVAL_GRAD);
+  CeedQFunctionAddOutput(qf_setup, "q data", 1, CEED_EVAL_NONE);
+
+  CeedQFunctionCreateInterior(ceed, 1, scaled_mass, scaled_mass_loc, &qf_mass);
+  CeedQFunctionAddInput(qf_mass, "q data", 1, CEED_EVAL_NONE);
+  CeedQFunctionAddInput(qf_mass, "u", 1, CEED_EVAL_INTERP);
+  CeedQFunctionAddOutput(qf_mass, "v", 1, CEED_EVAL_INTERP);
+
+  CeedQFunctionContextCreate(ceed, &qf_ctx);
+  CeedQFunctionContextSetData(qf_ctx, CEED_MEM_HOST, CEED_COPY_VALUES, sizeof(context), &context);
+  CeedQFunctionContextRegisterDouble(qf_ctx, "scale", 0, 1, "mass matrix scaling");
+  CeedQFunctionSetContext(qf_mass, qf_ctx);
+
+  // Operators
+  CeedOperatorCreate(ceed, qf_setup, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_setup);
+  CeedOperatorSetField(op_setup, "weight", CEED_ELEMRESTRICTION_NONE, basis_x, CEED_VECTOR_NONE);
+  CeedOperatorSetField(op_setup, "dx", elem_restriction_x, basis_x, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_setup, "q data", elem_restriction_q_data, CEED_BASIS_COLLOCATED, CEED_VECTOR_ACTIVE);
+
+  CeedOperatorCreate(ceed, qf_mass, CEED_QFUNCTION_NONE, CEED_QFUNCTION_NONE, &op_mass_fine);
+  CeedOperatorSetField(op_mass_fine, "q data", elem_restriction_q_data, CEED_BASIS_COLLOCATED, q_data);
+  CeedOperatorSetField(op_mass_fine, "u", elem_restriction_u_fine, basis_u_fine, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetField(op_mass_fine, "v", elem_restriction_u_fine, basis_u_fine, CEED_VECTOR_ACTIVE);
+  CeedOperatorSetQFunctionAssemblyReuse(op_mass_fine, true);
+
+  CeedOperatorApply(op_setup, x, q_data, CEED_REQUEST_IMMEDIATE);
+
+  // Create multigrid level twice
+  CeedVectorSetValue(p_mult_fine, 1.0);
+  CeedOperatorMultigridLevelCreate(op_mass_fine, p_mult_fine, elem_restriction_u_coarse, basis_u_coarse, &op_mass_coarse, &op_prolong, &op_restrict);
+  CeedOperatorMultigridLevelCreate(op_mass_fine, p_mult_fine, elem_restriction_u_coarse, basis_u_coarse, &op_mass_coarse_2, &op_prolong_2,
+                                   &op_restrict_2);
+  if (op_mass_coarse_2 != op_mass_coarse || op_prolong_2 != op_prolong || op_restrict_2 != op_restrict) {
+    // LCOV_EXCL_START
+    printf("Multigrid level not reused for the same coarse grid\n");
+    // LCOV_EXCL_STOP
+  }
+
+  // Changed multiplicity requires new level transfer operators
+  CeedOperatorDestroy(&op_mass_coarse_2);
+  CeedOperatorDestroy(&op_prolong_2);
+  CeedOperatorDestroy(&op_restrict_2);
+  CeedVectorSetValue(p_mult_fine, 1.0);
+  CeedOperatorMultigridLevelCreate(op_mass_fine, p_mult_fine, elem_restriction_u_coarse, basis_u_coarse, &op_mass_coarse_2, &op_prolong_2,
+                                   &op_restrict_2);
+  if (op_prolong_2 == op_prolong || op_restrict_2 == op_restrict) {
+    // LCOV_EXCL_START
+    printf("Multigrid level reused after fine grid multiplicity changed\n");
+    // LCOV_EXCL_STOP
+  }
+
+  // Assembled CeedQFunction is reused until the context changes
+  CeedOperatorLinearAssembleDiagonal(op_mass_coarse, diag_1, CEED_REQUEST_IMMEDIATE);
+
+  // Applying the operator writes the context, which is not a change that requires re-assembly
+  CeedOperatorApply(op_mass_coarse, u_coarse, v_coarse, CEED_REQUEST_IMMEDIATE);
+  {
+    const double *context_data;
+
+    CeedQFunctionContextGetDataRead(qf_ctx, CEED_MEM_HOST, &context_data);
+    num_calls = context_data[1];
+    CeedQFunctionContextRestoreDataRead(qf_ctx, &context_data);
+  }
+  CeedOperatorLinearAssembleDiagonal(op_mass_coarse, diag_2, CEED_REQUEST_IMMEDIATE);
+  {
+    const double *context_data;
+
+    CeedQFunctionContextGetDataRead(qf_ctx, CEED_MEM_HOST, &context_data);
+    if (context_data[1] != num_calls) printf("CeedQFunction re-assembled with unchanged context\n");
+    CeedQFunctionContextRestoreDataRead(qf_ctx, &context_data);
+  }
+
+  CeedOperatorGetContextFieldLabel(op_mass_fine, "scale", &scale_label);
+  scale = 2.0;
+  CeedOperatorSetContextDouble(op_mass_fine, scale_label, &scale);
+  CeedOperatorLinearAssembleDiagonal(op_mass_coarse_2, diag_2, CEED_REQUEST_IMMEDIATE);
+  {
+    const double *context_data;
+
+    CeedQFunctionContextGetDataRead(qf_ctx, CEED_MEM_HOST, &context_data);
+    if (context_data[1] == num_calls) printf("CeedQFunction not re-assembled after context update\n");
+    CeedQFunctionContextRestoreDataRead(qf_ctx, &context_data);
+  }
+
+  // Check output
+  {
+    const CeedScalar *diag_1_array, *diag_2_array;
+
+    CeedVectorGetArrayRead(diag_1, CEED_MEM_HOST, &diag_1_array);
+    CeedVectorGetArrayRead(diag_2, CEED_MEM_HOST, &diag_2_array);
+    for (CeedInt i = 0; i < num_dofs_u_coarse; i++) {
+      if (fabs(diag_2_array[i] - 2. * diag_1_array[i]) > 100. * CEED_EPSILON) {
+        // LCOV_EXCL_START
+        printf("[%" CeedInt_FMT "] Diagonal after context update %f != %f\n", i, diag_2_array[i], 2. * diag_1_array[i]);
+        // LCOV_EXCL_STOP
+      }
+    }
+    CeedVectorRestoreArrayRead(diag_1, &diag_1_array);
+    CeedVectorRestoreArrayRead(diag_2, &diag_2_array);
+  }
+
+  // Cleanup
+  CeedVectorDestroy(&x);
+  CeedVectorDestroy(&p_mult_fine);
+  CeedVectorDestroy(&diag_1);
+  CeedVectorDestroy(&diag_2);
+  CeedVectorDestroy(&u_coarse);
+  CeedVectorDestroy(&v_coarse);
+  CeedVectorDestroy(&q_data);
+  CeedElemRestrictionDestroy(&elem_restriction_u_coarse);
+  CeedElemRestrictionDestroy(&elem_restriction_u_fine);
+  CeedElemRestrictionDestroy(&elem_restriction_x);
+  CeedElemRestrictionDestroy(&elem_restriction_q_data);
+  CeedBasisDestroy(&basis_u_coarse);
+  CeedBasisDestroy(&basis_u_fine);
+  CeedBasisDestroy(&basis_x);
+  CeedQFunctionDestroy(&qf_setup);
+  CeedQFunctionDestroy(&qf_mass);
+  CeedQFunctionContextDestroy(&qf_ctx);
+  CeedOperatorDestroy(&op_setup);
+  CeedOperatorDestroy(&op_mass_coarse);
+  CeedOperatorDestroy(&op_mass_coarse_2);
+  CeedOperatorDestroy(&op_mass_fine);
+  CeedOperatorDestroy(&op_prolong);
+  CeedOperatorDestroy(&op_prolong_2);
+  CeedOperatorDestroy(&op_restrict);
+  CeedOperatorDestroy(&op_restrict_2);
+  CeedDestroy(&ceed);
+  return 0;
+}
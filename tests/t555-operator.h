@@ -0,0 +1,31 @@
+// Copyright (c) 2017-2022, Lawrence Livermore National Security, LLC and other CEED contributors.
+// All Rights Reserved. See the top-level LICENSE and NOTICE files for details.
+//
+// SPDX-License-Identifier: BSD-2-Clause
+//
+// This file is part of CEED:  http://github.com/ceed
+
+#include <ceed.h>
+
+CEED_QFUNCTION(setup)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  const CeedScalar *weight = in[0], *dxdX = in[1];
+  CeedScalar       *rho = out[0];
+
+  for (CeedInt i = 0; i < Q; i++) {
+    rho[i] = weight[i] * dxdX[i];
+  }
+  return 0;
+}
+
+// Context holds the scaling and a count of the CeedQFunction calls
+CEED_QFUNCTION(scaled_mass)(void *ctx, const CeedInt Q, const CeedScalar *const *in, CeedScalar *const *out) {
+  double           *context = (double *)ctx;
+  const CeedScalar *rho = in[0], *u = in[1];
+  CeedScalar       *v = out[0];
+
+  context[1] += 1;
+  for (CeedInt i = 0; i < Q; i++) {
+    v[i] = context[0] * rho[i] * u[i];
+  }
+  return 0;
+}